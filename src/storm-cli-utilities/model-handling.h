@@ -877,7 +877,8 @@ inline void generateCounterexamples<double>(std::shared_ptr<storm::models::Model
             STORM_LOG_THROW(sparseModel->isOfType(storm::models::ModelType::Dtmc), storm::exceptions::NotSupportedException,
                             "Counterexample generation using shortest paths is currently only supported for DTMCs.");
             counterexample = storm::api::computeKShortestPathCounterexample(sparseModel->template as<storm::models::sparse::Dtmc<ValueType>>(),
-                                                                            property.getRawFormula(), counterexampleSettings.getShortestPathMaxK());
+                                                                            property.getRawFormula(), counterexampleSettings.getShortestPathMaxK(),
+                                                                            counterexampleSettings.getShortestPathThreads());
             watch.stop();
             printCounterexample(counterexample, &watch);
         }
@@ -22,7 +22,7 @@ std::shared_ptr<storm::counterexamples::Counterexample> computeHighLevelCountere
 
 std::shared_ptr<storm::counterexamples::Counterexample> computeKShortestPathCounterexample(std::shared_ptr<storm::models::sparse::Model<double>> model,
                                                                                            std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                                           size_t maxK) {
+                                                                                           size_t maxK, uint64_t numberOfThreads) {
     // Only accept formulas of the form "P </<= x [F target]
     STORM_LOG_THROW(formula->isProbabilityOperatorFormula(), storm::exceptions::InvalidPropertyException,
                     "Counterexample generation does not support this kind of formula. Expecting a probability operator as the outermost formula element.");
@@ -58,18 +58,21 @@ std::shared_ptr<storm::counterexamples::Counterexample> computeKShortestPathCoun
 
     auto generator = storm::utility::ksp::ShortestPathsGenerator<double>(*model, subQualitativeResult.getTruthValuesVector());
     storm::counterexamples::PathCounterexample<double> cex(model);
-    double probability = 0;
+    // Enumerate paths until the accumulated probability mass is enough
+    size_t numberOfPaths = generator.computeUntilMass(threshold, strictBound, maxK);
     bool thresholdExceeded = false;
-    for (size_t k = 1; k <= maxK; ++k) {
-        cex.addPath(generator.getPathAsList(k), k);
-        probability += generator.getDistance(k);
-        // Check if accumulated probability mass is already enough
-        if ((probability > threshold) || (strictBound && probability >= threshold && strictBound)) {
-            thresholdExceeded = true;
-            break;
-        }
+    if (numberOfPaths > 0) {
+        double probability = generator.getAccumulatedDistance(numberOfPaths);
+        thresholdExceeded = (probability > threshold) || (strictBound && probability >= threshold);
+    }
+    STORM_LOG_WARN_COND(thresholdExceeded, "Aborted computation because maximal number of paths was reached or no further paths exist. "
+                                           "Probability threshold is not yet exceeded.");
+
+    // The paths are only extracted from the path tree, which can be done in parallel
+    auto paths = generator.getPathsAsLists(1, numberOfPaths, numberOfThreads);
+    for (size_t k = 1; k <= numberOfPaths; ++k) {
+        cex.addPath(paths[k - 1], k);
     }
-    STORM_LOG_WARN_COND(thresholdExceeded, "Aborted computation because maximal number of paths was reached. Probability threshold is not yet exceeded.");
 
     return std::make_shared<storm::counterexamples::PathCounterexample<double>>(cex);
 }
@@ -17,7 +17,7 @@ std::shared_ptr<storm::counterexamples::Counterexample> computeHighLevelCountere
 
 std::shared_ptr<storm::counterexamples::Counterexample> computeKShortestPathCounterexample(std::shared_ptr<storm::models::sparse::Model<double>> model,
                                                                                            std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                                           size_t maxK);
+                                                                                           size_t maxK, uint64_t numberOfThreads = 1);
 
 }  // namespace api
 }  // namespace storm
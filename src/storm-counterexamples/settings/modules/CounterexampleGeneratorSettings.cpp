@@ -17,6 +17,7 @@ const std::string CounterexampleGeneratorSettings::counterexampleOptionName = "c
 const std::string CounterexampleGeneratorSettings::counterexampleOptionShortName = "cex";
 const std::string CounterexampleGeneratorSettings::counterexampleTypeOptionName = "cextype";
 const std::string CounterexampleGeneratorSettings::shortestPathMaxKOptionName = "shortestpath-maxk";
+const std::string CounterexampleGeneratorSettings::shortestPathThreadsOptionName = "shortestpath-threads";
 const std::string CounterexampleGeneratorSettings::minimalCommandMethodOptionName = "mincmdmethod";
 const std::string CounterexampleGeneratorSettings::encodeReachabilityOptionName = "encreach";
 const std::string CounterexampleGeneratorSettings::schedulerCutsOptionName = "schedcuts";
@@ -43,6 +44,14 @@ CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSetti
                                          .setDefaultValueUnsignedInteger(10)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, shortestPathThreadsOptionName, false,
+                                                   "Number of threads used to extract the paths of a shortest path counterexample.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. 0 means one thread per core.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
     std::vector<std::string> method = {"maxsat", "milp"};
     this->addOption(storm::settings::OptionBuilder(moduleName, minimalCommandMethodOptionName, true,
                                                    "Sets which method is used to derive the counterexample in terms of a minimal command/edge set.")
@@ -86,6 +95,10 @@ size_t CounterexampleGeneratorSettings::getShortestPathMaxK() const {
     return this->getOption(shortestPathMaxKOptionName).getArgumentByName("maxk").getValueAsUnsignedInteger();
 }
 
+uint_fast64_t CounterexampleGeneratorSettings::getShortestPathThreads() const {
+    return this->getOption(shortestPathThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool CounterexampleGeneratorSettings::isUseMilpBasedMinimalCommandSetGenerationSet() const {
     return this->getOption(minimalCommandMethodOptionName).getArgumentByName("method").getValueAsString() == "milp";
 }
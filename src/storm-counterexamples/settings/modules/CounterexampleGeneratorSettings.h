@@ -52,6 +52,13 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
      */
     size_t getShortestPathMaxK() const;
 
+    /*!
+     * Retrieves the number of threads used to extract the shortest paths.
+     *
+     * @return The number of threads (0 means one thread per core).
+     */
+    uint_fast64_t getShortestPathThreads() const;
+
     /*!
      * Retrieves whether the MILP-based technique is to be used to generate a minimal command set
      * counterexample.
@@ -102,6 +109,7 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
     static const std::string counterexampleOptionShortName;
     static const std::string counterexampleTypeOptionName;
     static const std::string shortestPathMaxKOptionName;
+    static const std::string shortestPathThreadsOptionName;
     static const std::string minimalCommandMethodOptionName;
     static const std::string encodeReachabilityOptionName;
     static const std::string schedulerCutsOptionName;
@@ -161,6 +161,22 @@ void processOptions() {
         }
     }
 
+    // Statistical analysis by simulation
+    if (dftIOSettings.isAnalyzeWithSimulation()) {
+        std::vector<double> timepoints{};
+        if (dftIOSettings.usePropTimepoints()) {
+            timepoints = dftIOSettings.getPropTimepoints();
+        }
+        if (dftIOSettings.usePropTimebound()) {
+            timepoints.push_back(dftIOSettings.getPropTimebound());
+        }
+        storm::dft::api::analyzeDFTSimulation<ValueType>(*dft, timepoints, faultTreeSettings.getSimulationError(), faultTreeSettings.getSimulationConfidence(),
+                                                         faultTreeSettings.getSimulationMaxTraces(), faultTreeSettings.getSimulationSeed(),
+                                                         faultTreeSettings.isSimulationSplittingSet(), faultTreeSettings.getSimulationSplittingFactor(),
+                                                         faultTreeSettings.getSimulationSplittingLevels(), true);
+        return;
+    }
+
     // From now on we analyse the DFT via model checking
 
     // Set min or max
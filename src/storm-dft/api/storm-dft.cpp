@@ -10,7 +10,9 @@
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
 #include "storm-dft/modelchecker/DftModularizationChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/simulator/ImportanceFunction.h"
 #include "storm-dft/storage/DFT.h"
+#include "storm-dft/storage/DftSymmetries.h"
 #include "storm-dft/storage/DftJsonExporter.h"
 #include "storm-dft/storage/SylvanBddManager.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
@@ -170,6 +172,45 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunct
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "BDD analysis is not supportet for this data type.");
 }
 
+template<>
+std::vector<storm::dft::simulator::SimulationEstimate> analyzeDFTSimulation(storm::dft::storage::DFT<double> const& dft,
+                                                                            std::vector<double> const& timebounds, double relativeError, double confidence,
+                                                                            uint64_t maxTraces, uint64_t seed, bool useSplitting, uint64_t splittingFactor,
+                                                                            uint64_t splittingLevels, bool printOutput) {
+    // Prepare DFT for simulation
+    std::shared_ptr<storm::dft::storage::DFT<double>> preparedDft = prepareForMarkovAnalysis(dft);
+    preparedDft->setRelevantEvents(computeRelevantEvents({}, {}), false);
+    storm::dft::storage::DftSymmetries symmetries;
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(preparedDft->buildStateGenerationInfo(symmetries));
+
+    storm::dft::simulator::DFTParallelSimulator<double> simulator(*preparedDft, stateGenerationInfo, seed);
+    if (useSplitting) {
+        if (splittingLevels == 0) {
+            splittingLevels = preparedDft->nrBasicElements() + 1;
+        }
+        simulator.setSplitting(std::make_shared<storm::dft::simulator::BECountImportanceFunction<double>>(*preparedDft), splittingFactor, splittingLevels);
+    }
+
+    std::vector<storm::dft::simulator::SimulationEstimate> estimates;
+    for (double timebound : timebounds) {
+        estimates.push_back(simulator.estimateProbability(timebound, relativeError, confidence, maxTraces));
+        if (printOutput) {
+            auto const& estimate = estimates.back();
+            std::cout << "Estimated system failure probability at timebound " << timebound << " is " << estimate.probability << " +- " << estimate.halfWidth
+                      << " (confidence " << confidence << ", " << estimate.numberOfTraces << " traces)\n";
+        }
+    }
+    return estimates;
+}
+
+template<>
+std::vector<storm::dft::simulator::SimulationEstimate> analyzeDFTSimulation(storm::dft::storage::DFT<storm::RationalFunction> const& dft,
+                                                                            std::vector<double> const& timebounds, double relativeError, double confidence,
+                                                                            uint64_t maxTraces, uint64_t seed, bool useSplitting, uint64_t splittingFactor,
+                                                                            uint64_t splittingLevels, bool printOutput) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Simulation is not supported for this data type.");
+}
+
 template<typename ValueType>
 void exportDFTToJsonFile(storm::dft::storage::DFT<ValueType> const& dft, std::string const& file) {
     storm::dft::storage::DftJsonExporter<ValueType>::toFile(dft, file);
@@ -8,6 +8,7 @@
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/parser/DFTGalileoParser.h"
 #include "storm-dft/parser/DFTJsonParser.h"
+#include "storm-dft/simulator/DFTParallelSimulator.h"
 #include "storm-dft/transformations/DftToGspnTransformator.h"
 #include "storm-dft/transformations/DftTransformer.h"
 #include "storm-dft/utility/DftValidator.h"
@@ -252,6 +253,28 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<ValueType>> const& d
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
                    std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize);
 
+/*!
+ * Estimate the probability that the DFT fails within the given time bounds by statistical simulation.
+ * The traces are simulated in parallel using the number of threads given in the FaultTreeSettings.
+ *
+ * @param dft DFT.
+ * @param timebounds Time bounds.
+ * @param relativeError Relative error (half-width of the confidence interval) which should be achieved.
+ * @param confidence Confidence level.
+ * @param maxTraces Maximal number of traces to simulate per time bound.
+ * @param seed Seed for the random number generators.
+ * @param useSplitting Whether multilevel splitting according to the number of failed BEs should be used.
+ * @param splittingFactor Number of copies created per crossed level.
+ * @param splittingLevels Number of levels. 0 means one level per number of failed BEs.
+ * @param printOutput If true, the estimates are printed.
+ * @return Estimate for each time bound.
+ */
+template<typename ValueType>
+std::vector<storm::dft::simulator::SimulationEstimate> analyzeDFTSimulation(storm::dft::storage::DFT<ValueType> const& dft,
+                                                                            std::vector<double> const& timebounds, double relativeError, double confidence,
+                                                                            uint64_t maxTraces, uint64_t seed, bool useSplitting, uint64_t splittingFactor,
+                                                                            uint64_t splittingLevels, bool printOutput);
+
 /*!
  * Analyze the DFT using the SMT encoding
  *
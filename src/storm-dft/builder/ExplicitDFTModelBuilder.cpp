@@ -13,6 +13,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/bitoperations.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
@@ -38,10 +39,12 @@ ExplicitDFTModelBuilder<ValueType, StateType>::ExplicitDFTModelBuilder(storm::df
                                                                        storm::dft::storage::DftSymmetries const& symmetries)
     : dft(dft),
       stateGenerationInfo(std::make_shared<storm::dft::storage::DFTStateGenerationInfo>(dft.buildStateGenerationInfo(symmetries))),
+      numberOfThreads(storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getExplorationThreads()),
       generator(dft, *stateGenerationInfo),
       matrixBuilder(!generator.isDeterministicModel()),
       stateStorage(dft.stateBitVectorSize()),
-      explorationQueue(1, 0, 0.9, false) {
+      explorationQueue(1, 0, 0.9, false),
+      stateStorageCapacity(stateStorage.stateToId.capacity()) {
     // Set relevant events
     STORM_LOG_DEBUG("Relevant events: " << this->dft.getRelevantEventsString());
     if (dft.getRelevantEvents().size() <= 1) {
@@ -107,6 +110,11 @@ ExplicitDFTModelBuilder<ValueType, StateType>::ExplicitDFTModelBuilder(storm::df
     }
 }
 
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    this->numberOfThreads = numberOfThreads;
+}
+
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::buildModel(size_t iteration, double approximationThreshold,
                                                                storm::dft::builder::ApproximationHeuristic approximationHeuristic) {
@@ -188,7 +196,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::buildModel(size_t iteration,
         }
 
         // Initialize heuristic values for inital state
-        STORM_LOG_ASSERT(!statesNotExplored.at(initialStateIndex).second, "Heuristic for initial state is already initialized");
+        STORM_LOG_ASSERT(!statesNotExplored.at(initialStateIndex).heuristic, "Heuristic for initial state is already initialized");
         ExplorationHeuristicPointer heuristic;
         switch (usedHeuristic) {
             case storm::dft::builder::ApproximationHeuristic::DEPTH:
@@ -204,7 +212,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::buildModel(size_t iteration,
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
         }
         heuristic->markExpand();
-        statesNotExplored[initialStateIndex].second = heuristic;
+        statesNotExplored.at(initialStateIndex).heuristic = heuristic;
         explorationQueue.push(heuristic);
     } else {
         initializeNextIteration();
@@ -266,7 +274,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
     // Push skipped states to explore queue
     // TODO: remove
     for (auto const& skippedState : skippedStates) {
-        statesNotExplored[skippedState.second.first->getId()] = skippedState.second;
+        statesNotExplored[skippedState.second.first->getId()] = UnexploredState{skippedState.second.first, 0, skippedState.second.second};
         explorationQueue.push(skippedState.second.second);
     }
 
@@ -369,151 +377,103 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
     size_t nrSkippedStates = 0;
     storm::utility::ProgressMeasurement progress("explored states");
     progress.startNewMeasurement(0);
+    uint64_t nrThreads = storm::utility::parallel::resolveNumberOfThreads(numberOfThreads, std::numeric_limits<uint64_t>::max());
+    size_t batchSize = nrThreads > 1 ? nrThreads * BATCH_SIZE_PER_THREAD : 1;
+    // Each thread uses its own generator as the generator stores the currently loaded state
+    std::vector<storm::dft::generator::DftNextStateGenerator<ValueType, StateType>> threadGenerators;
+    if (nrThreads > 1) {
+        threadGenerators.reserve(nrThreads);
+        for (uint64_t thread = 0; thread < nrThreads; ++thread) {
+            threadGenerators.push_back(generator);
+        }
+    }
+    std::vector<std::pair<ExplorationHeuristicPointer, DFTStatePointer>> batch;
+    std::vector<boost::optional<ConcurrentExpansion>> expansions;
     // TODO: do not empty queue every time but break before
     while (!explorationQueue.empty()) {
-        // Get the first state in the queue
-        ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
-        StateType currentId = currentExplorationHeuristic->getId();
-        auto itFind = statesNotExplored.find(currentId);
-        STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
-        DFTStatePointer currentState = itFind->second.first;
-        STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
-        STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
-        // Remove it from the list of not explored states
-        statesNotExplored.erase(itFind);
-        STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
-        STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
-
-        // Get concrete state if necessary
-        if (currentState->isPseudoState()) {
-            // Create concrete state from pseudo state
-            currentState->construct();
-        }
-        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-        // Remember that the current row group was actually filled with the transitions of a different state
-        matrixBuilder.setRemapping(currentId);
-
-        matrixBuilder.newRowGroup();
-
-        // Try to explore the next state
-        generator.load(currentState);
-
-        // if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
-        if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
-            // Skip the current state
-            ++nrSkippedStates;
-            STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(currentState));
-            setMarkovian(true);
-            // Add transition to target state with temporary value 0
-            // TODO: what to do when there is no unique target state?
-            // STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
-            matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
-            // Remember skipped state
-            skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
-            matrixBuilder.finishRow();
-        } else {
-            // Explore the current state
-            ++nrExpandedStates;
-            storm::generator::StateBehavior<ValueType, StateType> behavior =
-                generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
-            STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
-            setMarkovian(behavior.begin()->isMarkovian());
+        // Get the first states in the queue
+        batch.clear();
+        while (!explorationQueue.empty() && batch.size() < batchSize) {
+            ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
+            StateType currentId = currentExplorationHeuristic->getId();
+            auto itFind = statesNotExplored.find(currentId);
+            STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
+            STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.heuristic, "Exploration heuristics do not match");
+            DFTStatePointer currentState = getUnexploredState(currentId, itFind->second);
+            STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
+            // Remove it from the list of not explored states
+            statesNotExplored.erase(itFind);
+            STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
+            STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
+            batch.emplace_back(currentExplorationHeuristic, currentState);
+        }
 
-            // Now add all choices.
-            for (auto const& choice : behavior) {
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
-                    // Set transition to state id + offset. This helps in only remapping all previously skipped states.
-                    matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
-                    // Set heuristic values for reached states
-                    auto iter = statesNotExplored.find(stateProbabilityPair.first);
-                    if (iter != statesNotExplored.end()) {
-                        // Update heuristic values
-                        DFTStatePointer state = iter->second.first;
-                        if (!iter->second.second) {
-                            // Initialize heuristic values
-                            ExplorationHeuristicPointer heuristic;
-                            switch (usedHeuristic) {
-                                case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    heuristic =
-                                        std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic);
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(
-                                        stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(
-                                        stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    break;
-                                default:
-                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                            }
-
-                            iter->second.second = heuristic;
-                            // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
-                            // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
-                            // !state->getFailableElements().hasBEs())) {
-                            if (state->getFailableElements().hasDependencies() ||
-                                (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                // Do not skip absorbing state or if reached by dependencies
-                                iter->second.second->markExpand();
-                            }
-                            if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
-                                // Compute bounds for heuristic now
-                                if (state->isPseudoState()) {
-                                    // Create concrete state from pseudo state
-                                    state->construct();
-                                }
-                                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-                                // Initialize bounds
-                                // TODO: avoid hack
-                                ValueType lowerBound = getLowerBound(state);
-                                ValueType upperBound = getUpperBound(state);
-                                heuristic->setBounds(lowerBound, upperBound);
-                            }
-
-                            explorationQueue.push(heuristic);
-                        } else if (!iter->second.second->isExpand()) {
-                            bool changedPriority = false;
-                            double oldPriority = iter->second.second->getPriority();
-                            switch (usedHeuristic) {
-                                case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
-                                                                                                 /* next values are irrelevant */ stateProbabilityPair.second,
-                                                                                                 stateProbabilityPair.second);
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
-                                                                                                 choice.getTotalMass());
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
-                                                                                                 choice.getTotalMass());
-                                    break;
-                                default:
-                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                            }
-                            if (changedPriority) {
-                                // Update priority queue
-                                explorationQueue.update(iter->second.second, oldPriority);
-                            }
-                        }
-                    }
+        expansions.assign(batch.size(), boost::none);
+        if (batch.size() > 1) {
+            // Generate the successors of all states in the batch concurrently.
+            // States which would be skipped right now are not expanded here as their heuristic values might still change within the batch.
+            storm::utility::parallel::forEachTask(batch.size(), nrThreads, [&](uint64_t thread, uint64_t index) {
+                DFTStatePointer const& state = batch[index].second;
+                if (state->isPseudoState()) {
+                    // Create concrete state from pseudo state
+                    state->construct();
                 }
+                if (approximationThreshold <= 0.0 || !batch[index].first->isSkip(approximationThreshold)) {
+                    expansions[index] = expandConcurrently(state, threadGenerators[thread]);
+                }
+            });
+        }
+
+        for (size_t index = 0; index < batch.size(); ++index) {
+            ExplorationHeuristicPointer const& currentExplorationHeuristic = batch[index].first;
+            DFTStatePointer const& currentState = batch[index].second;
+            StateType currentId = currentState->getId();
+
+            // Get concrete state if necessary
+            if (currentState->isPseudoState()) {
+                // Create concrete state from pseudo state
+                currentState->construct();
+            }
+            STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+
+            // Remember that the current row group was actually filled with the transitions of a different state
+            matrixBuilder.setRemapping(currentId);
+
+            matrixBuilder.newRowGroup();
+
+            // if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
+            if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
+                // Skip the current state
+                ++nrSkippedStates;
+                STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(currentState));
+                setMarkovian(true);
+                // Add transition to target state with temporary value 0
+                // TODO: what to do when there is no unique target state?
+                // STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
+                matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
+                // Remember skipped state
+                skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
                 matrixBuilder.finishRow();
+            } else {
+                // Explore the current state
+                ++nrExpandedStates;
+                if (expansions[index]) {
+                    addBehavior(registerSuccessors(expansions[index].get()), currentExplorationHeuristic);
+                } else {
+                    // Try to explore the next state
+                    generator.load(currentState);
+                    addBehavior(generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1)),
+                                currentExplorationHeuristic);
+                }
+            }
+            // Output number of currently explored states
+            if (nrExpandedStates % 100 == 0) {
+                progress.updateProgress(nrExpandedStates);
             }
         }
         if (storm::utility::resources::isTerminate()) {
             break;
         }
-        // Output number of currently explored states
-        if (nrExpandedStates % 100 == 0) {
-            progress.updateProgress(nrExpandedStates);
-        }
     }  // end exploration
 
     STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
@@ -521,6 +481,142 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
     STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
 }
 
+template<typename ValueType, typename StateType>
+typename ExplicitDFTModelBuilder<ValueType, StateType>::ConcurrentExpansion ExplicitDFTModelBuilder<ValueType, StateType>::expandConcurrently(
+    DFTStatePointer const& state, storm::dft::generator::DftNextStateGenerator<ValueType, StateType>& generator) const {
+    ConcurrentExpansion expansion;
+    generator.load(state);
+    expansion.behavior = generator.expand([this, &expansion](DFTStatePointer const& newState) {
+        // Only perform the symmetry reduction here, the state is registered later on
+        bool changed = stateGenerationInfo->hasSymmetries() && newState->orderBySymmetry();
+        expansion.successors.emplace_back(newState, changed);
+        return static_cast<StateType>(OFFSET_UNREGISTERED_STATE + expansion.successors.size() - 1);
+    });
+    return expansion;
+}
+
+template<typename ValueType, typename StateType>
+storm::generator::StateBehavior<ValueType, StateType> ExplicitDFTModelBuilder<ValueType, StateType>::registerSuccessors(ConcurrentExpansion& expansion) {
+    // Register the successors in the order in which they were generated
+    std::vector<StateType> successorIds;
+    successorIds.reserve(expansion.successors.size());
+    for (auto const& successor : expansion.successors) {
+        successorIds.push_back(registerState(successor.first, successor.second));
+    }
+
+    // Build the behavior with the actual ids. Several successors might coincide, so their probabilities are accumulated again.
+    storm::generator::StateBehavior<ValueType, StateType> behavior;
+    for (auto const& choice : expansion.behavior) {
+        storm::generator::Choice<ValueType, StateType> newChoice(choice.getActionIndex(), choice.isMarkovian());
+        for (auto const& stateProbabilityPair : choice) {
+            StateType id = stateProbabilityPair.first;
+            if (id >= OFFSET_UNREGISTERED_STATE) {
+                STORM_LOG_ASSERT(id - OFFSET_UNREGISTERED_STATE < successorIds.size(), "Invalid index of unregistered state.");
+                id = successorIds[id - OFFSET_UNREGISTERED_STATE];
+            }
+            newChoice.addProbability(id, stateProbabilityPair.second);
+        }
+        behavior.addChoice(std::move(newChoice));
+    }
+    behavior.setExpanded(expansion.behavior.wasExpanded());
+    return behavior;
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::addBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                                                                ExplorationHeuristicPointer const& currentExplorationHeuristic) {
+    STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
+    setMarkovian(behavior.begin()->isMarkovian());
+
+    // Now add all choices.
+    for (auto const& choice : behavior) {
+        // Add the probabilistic behavior to the matrix.
+        for (auto const& stateProbabilityPair : choice) {
+            STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
+            // Set transition to state id + offset. This helps in only remapping all previously skipped states.
+            matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
+            // Set heuristic values for reached states
+            auto iter = statesNotExplored.find(stateProbabilityPair.first);
+            if (iter != statesNotExplored.end()) {
+                // Update heuristic values
+                if (!iter->second.heuristic) {
+                    // Initialize heuristic values
+                    ExplorationHeuristicPointer heuristic;
+                    switch (usedHeuristic) {
+                        case storm::dft::builder::ApproximationHeuristic::DEPTH:
+                            heuristic =
+                                std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic);
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
+                            heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(
+                                stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                            heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(
+                                stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                    }
+
+                    iter->second.heuristic = heuristic;
+                    DFTStatePointer state = getUnexploredState(stateProbabilityPair.first, iter->second);
+                    // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
+                    // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
+                    // !state->getFailableElements().hasBEs())) {
+                    if (state->getFailableElements().hasDependencies() ||
+                        (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
+                        // Do not skip absorbing state or if reached by dependencies
+                        iter->second.heuristic->markExpand();
+                    }
+                    if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
+                        // Compute bounds for heuristic now
+                        if (state->isPseudoState()) {
+                            // Create concrete state from pseudo state
+                            state->construct();
+                            iter->second.state = state;
+                        }
+                        STORM_LOG_ASSERT(!state->isPseudoState(), "State is pseudo state.");
+
+                        // Initialize bounds
+                        // TODO: avoid hack
+                        ValueType lowerBound = getLowerBound(state);
+                        ValueType upperBound = getUpperBound(state);
+                        heuristic->setBounds(lowerBound, upperBound);
+                    }
+
+                    explorationQueue.push(heuristic);
+                } else if (!iter->second.heuristic->isExpand()) {
+                    bool changedPriority = false;
+                    double oldPriority = iter->second.heuristic->getPriority();
+                    switch (usedHeuristic) {
+                        case storm::dft::builder::ApproximationHeuristic::DEPTH:
+                            changedPriority = iter->second.heuristic->updateHeuristicValues(*currentExplorationHeuristic,
+                                                                                         /* next values are irrelevant */ stateProbabilityPair.second,
+                                                                                         stateProbabilityPair.second);
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
+                            changedPriority = iter->second.heuristic->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
+                                                                                         choice.getTotalMass());
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                            changedPriority = iter->second.heuristic->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
+                                                                                         choice.getTotalMass());
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                    }
+                    if (changedPriority) {
+                        // Update priority queue
+                        explorationQueue.update(iter->second.heuristic, oldPriority);
+                    }
+                }
+            }
+        }
+        matrixBuilder.finishRow();
+    }
+}
+
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::buildLabeling() {
     bool isAddLabelsClaiming = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isAddLabelsClaiming();
@@ -912,7 +1008,6 @@ ValueType ExplicitDFTModelBuilder<ValueType, StateType>::computeMTTFAnd(std::vec
 
 template<typename ValueType, typename StateType>
 StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTStatePointer const& state) {
-    StateType stateId;
     bool changed = false;
 
     if (stateGenerationInfo->hasSymmetries()) {
@@ -921,7 +1016,12 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
         changed = state->orderBySymmetry();
         STORM_LOG_TRACE("State " << (changed ? "changed to " : "did not change") << (changed ? dft.getStateString(state) : ""));
     }
+    return registerState(state, changed);
+}
 
+template<typename ValueType, typename StateType>
+StateType ExplicitDFTModelBuilder<ValueType, StateType>::registerState(DFTStatePointer const& state, bool changed) {
+    StateType stateId;
     if (stateStorage.stateToId.contains(state->status())) {
         // State already exists
         stateId = stateStorage.stateToId.getValue(state->status());
@@ -930,14 +1030,12 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
             // Check if state is pseudo state
             // If state is explored already the possible pseudo state was already constructed
             auto iter = statesNotExplored.find(stateId);
-            if (iter != statesNotExplored.end() && iter->second.first->isPseudoState()) {
+            if (iter != statesNotExplored.end() && !iter->second.state) {
                 // Create pseudo state now
-                STORM_LOG_ASSERT(iter->second.first->getId() == stateId, "Ids do not match.");
-                STORM_LOG_ASSERT(iter->second.first->status() == state->status(), "Pseudo states do not coincide.");
+                STORM_LOG_ASSERT(stateStorage.stateToId.getBucketAndValue(iter->second.bucket).first == state->status(), "Pseudo states do not coincide.");
                 state->setId(stateId);
                 // Update mapping to map to concrete state now
-                // TODO: just change pointer?
-                statesNotExplored[stateId] = std::make_pair(state, iter->second.second);
+                iter->second.state = state;
                 // We do not push the new state on the exploration queue as the pseudo state was already pushed
                 STORM_LOG_TRACE("Created pseudo state " << dft.getStateString(state));
             }
@@ -947,11 +1045,17 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
         STORM_LOG_ASSERT(state->isPseudoState() == changed, "State type (pseudo/concrete) wrong.");
         // Create new state
         state->setId(newIndex++);
-        stateId = stateStorage.stateToId.findOrAdd(state->status(), state->getId());
+        std::pair<StateType, uint64_t> idBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state->status(), state->getId());
+        stateId = idBucketPair.first;
         STORM_LOG_ASSERT(stateId == state->getId(), "Ids do not match.");
+        if (stateStorage.stateToId.capacity() != stateStorageCapacity) {
+            // The states were moved to other buckets
+            updatePseudoStateBuckets();
+        }
         // Insert state as not yet explored
+        // Pseudo states are only kept in the state storage as their status is the only information they hold
         ExplorationHeuristicPointer nullHeuristic;
-        statesNotExplored[stateId] = std::make_pair(state, nullHeuristic);
+        statesNotExplored[stateId] = UnexploredState{state->isPseudoState() ? nullptr : state, idBucketPair.second, nullHeuristic};
         // Reserve one slot for the new state in the remapping
         matrixBuilder.stateRemapping.push_back(0);
         STORM_LOG_TRACE("New " << (state->isPseudoState() ? "pseudo" : "concrete") << " state: " << dft.getStateString(state));
@@ -959,6 +1063,28 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
     return stateId;
 }
 
+template<typename ValueType, typename StateType>
+typename ExplicitDFTModelBuilder<ValueType, StateType>::DFTStatePointer ExplicitDFTModelBuilder<ValueType, StateType>::getUnexploredState(
+    StateType id, UnexploredState const& unexploredState) const {
+    if (unexploredState.state) {
+        return unexploredState.state;
+    }
+    return std::make_shared<storm::dft::storage::DFTState<ValueType>>(stateStorage.stateToId.getBucketAndValue(unexploredState.bucket).first, dft,
+                                                                      *stateGenerationInfo, id);
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::updatePseudoStateBuckets() {
+    stateStorageCapacity = stateStorage.stateToId.capacity();
+    for (auto const& stateIdPair : stateStorage.stateToId) {
+        auto iter = statesNotExplored.find(stateIdPair.second);
+        if (iter != statesNotExplored.end() && !iter->second.state) {
+            // The state is already contained, so this only looks up its bucket
+            iter->second.bucket = stateStorage.stateToId.findOrAddAndGetBucket(stateIdPair.first, stateIdPair.second).second;
+        }
+    }
+}
+
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::setMarkovian(bool markovian) {
     if (matrixBuilder.getCurrentRowGroup() > modelComponents.markovianStates.size()) {
@@ -971,8 +1097,8 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::setMarkovian(bool markovian)
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::printNotExplored() const {
     std::cout << "states not explored:\n";
-    for (auto it : statesNotExplored) {
-        std::cout << it.first << " -> " << dft.getStateString(it.second.first) << '\n';
+    for (auto const& it : statesNotExplored) {
+        std::cout << it.first << " -> " << dft.getStateString(getUnexploredState(it.first, it.second)) << '\n';
     }
 }
 
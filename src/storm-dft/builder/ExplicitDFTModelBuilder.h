@@ -54,6 +54,28 @@ class ExplicitDFTModelBuilder {
         bool deterministicModel;
     };
 
+    // The result of expanding a state concurrently to the exploration.
+    struct ConcurrentExpansion {
+        // The behavior of the state. Successors that are not registered yet are referred to by OFFSET_UNREGISTERED_STATE + their index in successors.
+        storm::generator::StateBehavior<ValueType, StateType> behavior;
+
+        // The generated successor states together with a flag indicating whether they were changed by the symmetry reduction.
+        std::vector<std::pair<DFTStatePointer, bool>> successors;
+    };
+
+    // A state which is not yet explored.
+    // Pseudo states are not kept as objects: their status is only stored in the state storage and they are re-created when needed.
+    struct UnexploredState {
+        // The concrete state or nullptr if the state is a pseudo state.
+        DFTStatePointer state;
+
+        // Bucket of the state in the state storage (only relevant for pseudo states).
+        uint64_t bucket;
+
+        // The heuristic values of the state.
+        ExplorationHeuristicPointer heuristic;
+    };
+
     // A class holding the information for building the transition matrix.
     class MatrixBuilder {
        public:
@@ -182,6 +204,15 @@ class ExplicitDFTModelBuilder {
      */
     std::shared_ptr<storm::models::sparse::Model<ValueType>> getModelApproximation(bool lowerBound, bool expectedTime);
 
+    /*!
+     * Set the number of threads used for exploring the state space.
+     * With more than one thread, the states with highest priority are taken from the exploration queue in batches and their successors are
+     * generated concurrently. The successors are registered and the heuristic values are updated in the order of the exploration queue afterwards.
+     *
+     * @param numberOfThreads Number of threads (0 means one thread per core).
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
    private:
     /*!
      * Explore state space of DFT.
@@ -190,6 +221,33 @@ class ExplicitDFTModelBuilder {
      */
     void exploreStateSpace(double approximationThreshold);
 
+    /*!
+     * Expand the given state without registering its successors.
+     *
+     * @param state The state to expand.
+     * @param generator Next state generator used for the expansion.
+     *
+     * @return The expansion containing the behavior and the generated successors.
+     */
+    ConcurrentExpansion expandConcurrently(DFTStatePointer const& state, storm::dft::generator::DftNextStateGenerator<ValueType, StateType>& generator) const;
+
+    /*!
+     * Register the successors of a concurrent expansion and replace their temporary ids by the state ids.
+     *
+     * @param expansion The concurrent expansion.
+     *
+     * @return The behavior of the expanded state.
+     */
+    storm::generator::StateBehavior<ValueType, StateType> registerSuccessors(ConcurrentExpansion& expansion);
+
+    /*!
+     * Add the behavior of the current state to the matrix and initialize or update the heuristic values of the reached states.
+     *
+     * @param behavior Behavior of the current state.
+     * @param currentExplorationHeuristic Heuristic values of the current state.
+     */
+    void addBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationHeuristicPointer const& currentExplorationHeuristic);
+
     /*!
      * Initialize the matrix for a refinement iteration.
      */
@@ -209,6 +267,31 @@ class ExplicitDFTModelBuilder {
      */
     StateType getOrAddStateIndex(DFTStatePointer const& state);
 
+    /*!
+     * Add a state whose symmetry reduction was already performed to the explored states (if not already there). It also handles pseudo states.
+     *
+     * @param state The state to add.
+     * @param changed Flag indicating whether the symmetry reduction changed the state.
+     *
+     * @return Id of state.
+     */
+    StateType registerState(DFTStatePointer const& state, bool changed);
+
+    /*!
+     * Get a not yet explored state. Pseudo states are re-created from their status in the state storage.
+     *
+     * @param id Id of the state.
+     * @param unexploredState Information about the not yet explored state.
+     *
+     * @return The (possibly pseudo) state.
+     */
+    DFTStatePointer getUnexploredState(StateType id, UnexploredState const& unexploredState) const;
+
+    /*!
+     * Update the buckets of all not yet explored pseudo states after the state storage was resized.
+     */
+    void updatePseudoStateBuckets();
+
     /*!
      * Set markovian flag for the current state.
      *
@@ -278,6 +361,10 @@ class ExplicitDFTModelBuilder {
     const size_t INITIAL_BITVECTOR_SIZE = 20000;
     // Offset used for pseudo states.
     const StateType OFFSET_PSEUDO_STATE = std::numeric_limits<StateType>::max() / 2;
+    // Offset used for successor states which were generated concurrently but are not registered yet.
+    const StateType OFFSET_UNREGISTERED_STATE = std::numeric_limits<StateType>::max() / 4 * 3;
+    // Number of states taken from the exploration queue per thread if the state space is explored concurrently.
+    const size_t BATCH_SIZE_PER_THREAD = 16;
 
     // Dft
     storm::dft::storage::DFT<ValueType> const& dft;
@@ -292,6 +379,9 @@ class ExplicitDFTModelBuilder {
     // Current id for new state
     size_t newIndex = 0;
 
+    // Number of threads used for exploring the state space
+    uint64_t numberOfThreads;
+
     // Whether to use a unique state for all failed states
     // If used, the unique failed state has the id 0
     bool uniqueFailedState = false;
@@ -314,8 +404,11 @@ class ExplicitDFTModelBuilder {
     // A priority queue of states that still need to be explored.
     storm::dft::storage::BucketPriorityQueue<ExplorationHeuristic> explorationQueue;
 
-    // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
-    std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
+    // Capacity of the state storage when the buckets of the pseudo states were last updated.
+    uint64_t stateStorageCapacity;
+
+    // A mapping of not yet explored states from the id to the information about the state.
+    std::map<StateType, UnexploredState> statesNotExplored;
 
     // Holds all skipped states which were not yet expanded. More concretely it is a mapping from matrix indices
     // to the corresponding skipped states.
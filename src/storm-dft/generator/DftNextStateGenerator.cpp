@@ -205,7 +205,7 @@ std::pair<StateType, bool> DftNextStateGenerator<ValueType, StateType>::getNewSt
 
 template<typename ValueType, typename StateType>
 typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
-    DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency,
+    DFTStatePointer const& origState, std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> const& dependency,
     bool dependencySuccessful) const {
     // Construct new state as copy from original one
     DFTStatePointer newState = origState->copy();
@@ -231,7 +231,7 @@ typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextSta
 
 template<typename ValueType, typename StateType>
 typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
-    DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) const {
+    DFTStatePointer const& origState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& be) const {
     // Construct new state as copy from original one
     DFTStatePointer newState = origState->copy();
 
@@ -270,11 +270,11 @@ typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextSta
 }
 
 template<typename ValueType, typename StateType>
-void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePointer newState,
-                                                                   std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
+void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePointer const& newState,
+                                                                   std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& nextBE,
                                                                    storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const {
     // Propagate failure
-    for (DFTGatePointer parent : nextBE->parents()) {
+    for (DFTGatePointer const& parent : nextBE->parents()) {
         if (newState->isOperational(parent->id())) {
             queues.propagateFailure(parent);
         }
@@ -288,7 +288,7 @@ void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePoint
     }
 
     // Check restrictions
-    for (DFTRestrictionPointer restr : nextBE->restrictions()) {
+    for (DFTRestrictionPointer const& restr : nextBE->restrictions()) {
         queues.checkRestrictionLater(restr);
     }
     // Check restrictions
@@ -301,8 +301,8 @@ void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePoint
 }
 
 template<typename ValueType, typename StateType>
-void DftNextStateGenerator<ValueType, StateType>::propagateFailsafe(DFTStatePointer newState,
-                                                                    std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
+void DftNextStateGenerator<ValueType, StateType>::propagateFailsafe(DFTStatePointer const& newState,
+                                                                    std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& nextBE,
                                                                     storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const {
     // Propagate failsafe
     while (!queues.failsafePropagationDone()) {
@@ -62,7 +62,8 @@ class DftNextStateGenerator {
      *
      * @return Successor state.
      */
-    DFTStatePointer createSuccessorState(DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) const;
+    DFTStatePointer createSuccessorState(DFTStatePointer const& origState,
+                                         std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& be) const;
 
     /*!
      * Create successor state from given state by triggering the given dependency.
@@ -76,8 +77,8 @@ class DftNextStateGenerator {
      *
      * @return Successor state.
      */
-    DFTStatePointer createSuccessorState(DFTStatePointer const origState,
-                                         std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency,
+    DFTStatePointer createSuccessorState(DFTStatePointer const& origState,
+                                         std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> const& dependency,
                                          bool dependencySuccessful = true) const;
 
     /**
@@ -86,7 +87,7 @@ class DftNextStateGenerator {
      * @param newState starting state of the propagation
      * @param nextBE BE whose failure is propagated
      */
-    void propagateFailure(DFTStatePointer newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
+    void propagateFailure(DFTStatePointer const& newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& nextBE,
                           storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const;
 
     /**
@@ -95,7 +96,7 @@ class DftNextStateGenerator {
      * @param newState starting state of the propagation
      * @param nextBE BE whose failure is propagated
      */
-    void propagateFailsafe(DFTStatePointer newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
+    void propagateFailsafe(DFTStatePointer const& newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& nextBE,
                            storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const;
 
    private:
@@ -7,18 +7,24 @@
 #include "storm-dft/builder/DFTBuilder.h"
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/settings/modules/FaultTreeSettings.h"
+#include "storm-dft/storage/elements/DFTElements.h"
 #include "storm-dft/utility/DftModularizer.h"
 
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::dft {
 namespace modelchecker {
 
 template<typename ValueType>
 DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+    : dft{dft},
+      sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()},
+      numberOfThreads(storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getModuleThreads()) {
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -26,6 +32,23 @@ DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<st
 
     // Gather all dynamic modules
     populateDynamicModules(topModule);
+    computeIsomorphismClasses();
+}
+
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    this->numberOfThreads = numberOfThreads;
+}
+
+template<typename ValueType>
+size_t DftModularizationChecker<ValueType>::getNumberOfAnalysedModules() const {
+    size_t result = 0;
+    for (size_t i = 0; i < isomorphismClasses.size(); ++i) {
+        if (isomorphismClasses[i] == i) {
+            ++result;
+        }
+    }
+    return result;
 }
 
 template<typename ValueType>
@@ -41,6 +64,65 @@ void DftModularizationChecker<ValueType>::populateDynamicModules(storm::dft::sto
     }
 }
 
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::computeIsomorphismClasses() {
+    isomorphismClasses.clear();
+    if (dynamicModules.size() <= 1) {
+        isomorphismClasses.resize(dynamicModules.size(), 0);
+        return;
+    }
+    storm::dft::storage::DFTColouring<ValueType> colouring(*dft);
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        size_t isomorphismClass = i;
+        for (size_t j = 0; j < i; ++j) {
+            // Only compare with the first module of each class
+            if (isomorphismClasses[j] == j && areIsomorphic(dynamicModules[j], dynamicModules[i], colouring)) {
+                STORM_LOG_DEBUG("Dynamic module " << dft->getElement(dynamicModules[i].getRepresentative())->name() << " is isomorphic to "
+                                                  << dft->getElement(dynamicModules[j].getRepresentative())->name() << ".");
+                isomorphismClass = j;
+                break;
+            }
+        }
+        isomorphismClasses.push_back(isomorphismClass);
+    }
+}
+
+template<typename ValueType>
+bool DftModularizationChecker<ValueType>::areIsomorphic(storm::dft::storage::DftIndependentModule const& module1,
+                                                        storm::dft::storage::DftIndependentModule const& module2,
+                                                        storm::dft::storage::DFTColouring<ValueType> const& colouring) const {
+    std::set<size_t> elements1 = module1.getAllElements();
+    std::set<size_t> elements2 = module2.getAllElements();
+    if (elements1.size() != elements2.size() || dft->getElement(module1.getRepresentative())->type() != dft->getElement(module2.getRepresentative())->type()) {
+        return false;
+    }
+    auto candidates1 = colouring.colourSubdft(std::vector<size_t>(elements1.begin(), elements1.end()));
+    auto candidates2 = colouring.colourSubdft(std::vector<size_t>(elements2.begin(), elements2.end()));
+    storm::dft::storage::DFTIsomorphismCheck<ValueType> isomorphismCheck(candidates1, candidates2, *dft);
+    while (isomorphismCheck.findNextIsomorphism()) {
+        auto const& bijection = isomorphismCheck.getIsomorphism();
+        if (bijection.at(module1.getRepresentative()) != module2.getRepresentative()) {
+            continue;
+        }
+        // The colouring does not distinguish BEs given by samples
+        bool samplesEqual = true;
+        for (auto const& indexPair : bijection) {
+            if (dft->isBasicElement(indexPair.first) && dft->getBasicElement(indexPair.first)->beType() == storm::dft::storage::elements::BEType::SAMPLES) {
+                auto be1 = std::static_pointer_cast<storm::dft::storage::elements::BESamples<ValueType> const>(dft->getBasicElement(indexPair.first));
+                auto be2 = std::static_pointer_cast<storm::dft::storage::elements::BESamples<ValueType> const>(dft->getBasicElement(indexPair.second));
+                if (be1->activeSamples() != be2->activeSamples()) {
+                    samplesEqual = false;
+                    break;
+                }
+            }
+        }
+        if (samplesEqual) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template<typename ValueType>
 std::vector<ValueType> DftModularizationChecker<ValueType>::check(FormulaVector const& formulas, size_t chunksize) {
     // Gather time points
@@ -69,18 +151,61 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
 
-    // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
+    // Determine the modules which need to be analysed: one module per isomorphism class for which not all time points are cached
+    std::vector<size_t> modulesToAnalyse;
+    std::vector<std::vector<ValueType>> missingTimepoints;
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        if (isomorphismClasses[i] != i) {
+            continue;
+        }
+        auto const& cachedResults = moduleResults[i];
+        std::vector<ValueType> missing;
+        for (auto const& timebound : timepoints) {
+            if (cachedResults.find(timebound) == cachedResults.end()) {
+                missing.push_back(timebound);
+            }
+        }
+        if (!missing.empty()) {
+            modulesToAnalyse.push_back(i);
+            missingTimepoints.push_back(std::move(missing));
+        }
+    }
+
+    // Create the properties before the analysis as parsing is not thread-safe
+    std::vector<FormulaVector> properties;
+    for (auto const& moduleTimepoints : missingTimepoints) {
+        std::stringstream propertyStream{};
+        for (auto const timebound : moduleTimepoints) {
+            propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+        }
+        properties.push_back(storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str())));
+    }
+
+    // Analyse the dynamic modules (concurrently)
+    uint64_t nrThreads = storm::utility::parallel::resolveNumberOfThreads(numberOfThreads, modulesToAnalyse.size());
+    std::vector<typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results> results(modulesToAnalyse.size());
+    storm::utility::parallel::forEachTask(modulesToAnalyse.size(), nrThreads, [&](uint64_t, uint64_t task) {
+        auto const& mod = dynamicModules[modulesToAnalyse[task]];
         STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
+        // Avoid interleaved output of concurrent analyses
+        results[task] = analyseDynamicModule(mod, properties[task], nrThreads == 1);
+    });
+    for (size_t task = 0; task < modulesToAnalyse.size(); ++task) {
         // Remember probabilities for module
+        auto& cachedResults = moduleResults[modulesToAnalyse[task]];
+        for (size_t i{0}; i < missingTimepoints[task].size(); ++i) {
+            cachedResults[missingTimepoints[task][i]] = boost::get<ValueType>(results[task][i]);
+        }
+    }
+
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        // Use the results of the isomorphic module
+        auto const& cachedResults = moduleResults.at(isomorphismClasses[i]);
         std::map<ValueType, ValueType> activeSamples{};
-        for (size_t i{0}; i < timepoints.size(); ++i) {
-            auto const probability{boost::get<ValueType>(result[i])};
-            auto const timebound{timepoints[i]};
-            activeSamples[timebound] = probability;
+        for (auto const& timebound : timepoints) {
+            activeSamples[timebound] = cachedResults.at(timebound);
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        samplePoints.insert({dynamicModules[i].getRepresentative(), activeSamples});
     }
 
     // Gather all elements contained in dynamic modules
@@ -123,20 +248,15 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::storage::DftIndependentModule const& module, FormulaVector const& properties, bool printInfo) const {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
 
     auto subDft = module.getSubtree(*dft);
 
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
-    }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+    // Each analysis uses its own model checker such that analyses can run concurrently
+    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker(printInfo);
+    return modelchecker.check(subDft, properties, false, false, {});
 }
 
 // Explicitly instantiate the class.
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <vector>
 
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/storage/DFT.h"
+#include "storm-dft/storage/DFTIsomorphism.h"
 #include "storm-dft/storage/DftModule.h"
 #include "storm-dft/storage/SylvanBddManager.h"
 #include "storm/logic/Formula.h"
@@ -16,6 +18,7 @@ namespace modelchecker {
  * DFT analysis via modularization.
  * Dynamic modules are analyzed via model checking and replaced by a single BE capturing the probabilities of the module.
  * The resulting (static) fault tree is then analyzed via BDDs.
+ * Independent dynamic modules can be analyzed concurrently. Isomorphic modules are analyzed only once and the results are cached.
  *
  * @note All public functions must make sure that workDFT is set correctly and should assume workDFT to be in an erroneous state.
  */
@@ -58,6 +61,18 @@ class DftModularizationChecker {
         return getProbabilitiesAtTimepoints({timebound}).at(0);
     }
 
+    /*!
+     * Set the number of threads used for analysing dynamic modules.
+     * @param numberOfThreads Number of threads (0 means one thread per core).
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
+    /*!
+     * Get the number of dynamic modules which need to be analysed, i.e., the number of isomorphism classes of dynamic modules.
+     * @return Number of dynamic modules which are not isomorphic to each other.
+     */
+    size_t getNumberOfAnalysedModules() const;
+
    private:
     /*!
      * Recursively populate the list of dynamic modules.
@@ -65,6 +80,21 @@ class DftModularizationChecker {
      */
     void populateDynamicModules(storm::dft::storage::DftIndependentModule const &module);
 
+    /*!
+     * Partition the dynamic modules into classes of isomorphic modules.
+     */
+    void computeIsomorphismClasses();
+
+    /*!
+     * Check whether the two given modules are isomorphic such that the representatives are mapped onto each other.
+     * @param module1 First module.
+     * @param module2 Second module.
+     * @param colouring Colouring of the DFT.
+     * @return True iff both modules have the same failure behaviour.
+     */
+    bool areIsomorphic(storm::dft::storage::DftIndependentModule const &module1, storm::dft::storage::DftIndependentModule const &module2,
+                       storm::dft::storage::DFTColouring<ValueType> const &colouring) const;
+
     /*!
      * Calculate results for dynamic modules and replace them with BE's in workDFT.
      * @param timepoints Time points for which the failure probability should be computed.
@@ -75,20 +105,25 @@ class DftModularizationChecker {
     /*!
      * Analyse the given dynamic module.
      * @param module Module.
-     * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties for the failure probabilities at the considered time points.
+     * @param printInfo Whether information about the built model should be printed.
      */
     typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+                                                                                                    FormulaVector const &properties, bool printInfo) const;
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
-    // DFT modelchecker
-    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker;
     // don't reinitialize Sylvan BDD
     // temporary
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // For each dynamic module the index of the first isomorphic module. Only these modules are analysed.
+    std::vector<size_t> isomorphismClasses;
+    // Cached failure probabilities (per time point) of the analysed modules
+    std::map<size_t, std::map<ValueType, ValueType>> moduleResults;
+    // Number of threads used for analysing dynamic modules
+    uint64_t numberOfThreads;
 };
 
 }  // namespace modelchecker
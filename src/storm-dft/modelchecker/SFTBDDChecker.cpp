@@ -4,8 +4,11 @@
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/settings/modules/FaultTreeSettings.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
 #include "storm/adapters/eigen.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -235,12 +238,165 @@ Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t
     bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
     return &bddToBirnbaumFactorsElement.second;
 }
+
+/**
+ * A node of a bdd which was flattened into a vector.
+ * The children are given by their position in the vector.
+ */
+struct FlatBddNode {
+    bool isTerminal;
+    bool isOne;
+    uint32_t variable;
+    size_t thenIndex;
+    size_t elseIndex;
+};
+
+/**
+ * \returns
+ * The position of the given bdd in the flattened bdd.
+ *
+ * \param bdd
+ * The bdd to flatten
+ *
+ * \param nodes
+ * The nodes in post order, i.e., children always precede their parents
+ * and the root is the last node.
+ * Will be populated by the function.
+ *
+ * \param bddToIndex
+ * A cache mapping sub bdds to their position in nodes.
+ */
+size_t recursiveFlatten(Bdd const bdd, std::vector<FlatBddNode> &nodes, std::unordered_map<uint64_t, size_t> &bddToIndex) {
+    auto const bddId{bdd.GetBDD()};
+    auto const it{bddToIndex.find(bddId)};
+    if (it != bddToIndex.end()) {
+        return it->second;
+    }
+
+    FlatBddNode node{bdd.isTerminal(), bdd.isOne(), 0, 0, 0};
+    if (!node.isTerminal) {
+        node.variable = bdd.TopVar();
+        node.thenIndex = recursiveFlatten(bdd.Then(), nodes, bddToIndex);
+        node.elseIndex = recursiveFlatten(bdd.Else(), nodes, bddToIndex);
+    }
+    nodes.push_back(node);
+    bddToIndex[bddId] = nodes.size() - 1;
+    return nodes.size() - 1;
+}
+
+/**
+ * \returns
+ * The probabilities that the flattened bdd is true
+ * together with the birnbaum importance factors of all variables.
+ * Variables which do not occur in the bdd have no entry.
+ *
+ * The factors are computed with one backward traversal
+ * (probabilities of all nodes) and one forward traversal
+ * (probabilities of reaching each node from the root) using
+ * B(x) = sum over all nodes n labelled with x of
+ *        P(reach n) * (P(then(n)) - P(else(n)))
+ *
+ * \param chunksize
+ * The width of the Eigen Arrays
+ *
+ * \param nodes
+ * The flattened bdd
+ *
+ * \param indexToProbabilities
+ * A reference to a mapping
+ * that must map every variable in the bdd to probabilities
+ */
+std::pair<Eigen::ArrayXd, std::map<uint32_t, Eigen::ArrayXd>> allBirnbaumFactors(size_t const chunksize, std::vector<FlatBddNode> const &nodes,
+                                                                                 std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities) {
+    // Backward traversal: children precede their parents
+    std::vector<Eigen::ArrayXd> probabilities(nodes.size());
+    for (size_t i{0}; i < nodes.size(); ++i) {
+        auto const &node{nodes[i]};
+        if (node.isTerminal) {
+            probabilities[i] = Eigen::ArrayXd::Constant(chunksize, node.isOne ? 1 : 0);
+        } else {
+            auto const &currentProbabilities{indexToProbabilities.at(node.variable)};
+            probabilities[i] = currentProbabilities * probabilities[node.thenIndex] + (1 - currentProbabilities) * probabilities[node.elseIndex];
+        }
+    }
+
+    // Forward traversal: parents precede their children
+    std::vector<Eigen::ArrayXd> reachProbabilities(nodes.size(), Eigen::ArrayXd::Zero(chunksize));
+    reachProbabilities.back() = Eigen::ArrayXd::Ones(chunksize);
+    std::map<uint32_t, Eigen::ArrayXd> birnbaumFactors{};
+    for (size_t i{nodes.size()}; i-- > 0;) {
+        auto const &node{nodes[i]};
+        if (node.isTerminal) {
+            continue;
+        }
+        auto const &currentProbabilities{indexToProbabilities.at(node.variable)};
+        auto const &reachProbability{reachProbabilities[i]};
+
+        auto const it{birnbaumFactors.find(node.variable)};
+        if (it == birnbaumFactors.end()) {
+            birnbaumFactors[node.variable] = reachProbability * (probabilities[node.thenIndex] - probabilities[node.elseIndex]);
+        } else {
+            it->second += reachProbability * (probabilities[node.thenIndex] - probabilities[node.elseIndex]);
+        }
+        reachProbabilities[node.thenIndex] += reachProbability * currentProbabilities;
+        reachProbabilities[node.elseIndex] += reachProbability * (1 - currentProbabilities);
+    }
+
+    return {std::move(probabilities.back()), std::move(birnbaumFactors)};
+}
+
+/**
+ * Sets the probabilities of the basic elements at the given timepoints.
+ *
+ * \param basicElements
+ * The basic elements
+ *
+ * \param beIndices
+ * The indices of the basic elements in the bdd manager
+ *
+ * \param timepointsArray
+ * The current timepoints
+ *
+ * \param indexToProbabilities
+ * A mapping from bdd indices to probabilities.
+ * Will be populated by the function.
+ */
+void updateBasicElementProbabilities(std::vector<std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>> const &basicElements,
+                                     std::vector<uint32_t> const &beIndices, Eigen::ArrayXd const &timepointsArray,
+                                     std::map<uint32_t, Eigen::ArrayXd> &indexToProbabilities) {
+    for (size_t i{0}; i < basicElements.size(); ++i) {
+        auto const &be{basicElements[i]};
+        auto const beIndex{beIndices[i]};
+        // Vectorize known BETypes
+        // fallback to getUnreliability() otherwise
+        if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
+            auto const failureRate{std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType> const>(be)->activeFailureRate()};
+
+            // exponential distribution
+            // p(T <= t) = 1 - exp(-lambda*t)
+            indexToProbabilities[beIndex] = 1 - (-failureRate * timepointsArray).exp();
+        } else {
+            auto probabilities{timepointsArray};
+            for (Eigen::Index j{0}; j < timepointsArray.size(); ++j) {
+                probabilities(j) = be->getUnreliability(timepointsArray(j));
+            }
+            indexToProbabilities[beIndex] = probabilities;
+        }
+    }
+}
 }  // namespace
 
 SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager)
-    : transformator{std::make_shared<storm::dft::transformations::SftToBddTransformator<ValueType>>(dft, sylvanBddManager)} {}
+    : transformator{std::make_shared<storm::dft::transformations::SftToBddTransformator<ValueType>>(dft, sylvanBddManager)},
+      numberOfThreads{storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getImportanceThreads()} {}
 
-SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::transformations::SftToBddTransformator<ValueType>> transformator) : transformator{transformator} {}
+SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::transformations::SftToBddTransformator<ValueType>> transformator)
+    : transformator{transformator},
+      numberOfThreads{storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getImportanceThreads()} {}
+
+void SFTBDDChecker::setNumberOfThreads(uint64_t numberOfThreads) noexcept {
+    this->numberOfThreads = numberOfThreads;
+}
 
 Bdd SFTBDDChecker::getTopLevelElementBdd() {
     return transformator->transformTopLevel();
@@ -293,6 +449,11 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
 
     // caches
     auto const basicElements{getDFT()->getBasicElements()};
+    std::vector<uint32_t> beIndices{};
+    beIndices.reserve(basicElements.size());
+    for (auto const &be : basicElements) {
+        beIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
+    }
     std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
 
     // The current timepoints we calculate with
@@ -311,24 +472,7 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
         }
 
         // Update the probabilities of the basic elements
-        for (auto const &be : basicElements) {
-            auto const beIndex{getSylvanBddManager()->getIndex(be->name())};
-            // Vectorize known BETypes
-            // fallback to getUnreliability() otherwise
-            if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
-                auto const failureRate{std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType> const>(be)->activeFailureRate()};
-
-                // exponential distribution
-                // p(T <= t) = 1 - exp(-lambda*t)
-                indexToProbabilities[beIndex] = 1 - (-failureRate * timepointsArray).exp();
-            } else {
-                auto probabilities{timepointsArray};
-                for (size_t i{0}; i < chunksize; ++i) {
-                    probabilities(i) = be->getUnreliability(timepointsArray(i));
-                }
-                indexToProbabilities[beIndex] = probabilities;
-            }
-        }
+        updateBasicElementProbabilities(basicElements, beIndices, timepointsArray, indexToProbabilities);
 
         func(chunksize, timepointsArray, indexToProbabilities);
     }
@@ -391,26 +535,12 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const resultsAtTimepoints{getAllImportanceMeasuresAtTimepoints({timebound}, 1, func)};
 
     std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
-
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
-
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
-        resultVector.push_back(func(beProbability, probability, birnbaumFactor));
+    resultVector.reserve(resultsAtTimepoints.size());
+    for (auto const &results : resultsAtTimepoints) {
+        resultVector.push_back(results.front());
     }
     return resultVector;
 }
@@ -454,45 +584,55 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
     auto const basicElements{getDFT()->getBasicElements()};
+    std::vector<uint32_t> beIndices{};
+    beIndices.reserve(basicElements.size());
+    for (auto const &be : basicElements) {
+        beIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
+    }
 
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<std::vector<ValueType>> resultVector{};
-    resultVector.resize(getDFT()->getBasicElements().size());
-    for (auto &i : resultVector) {
-        i.reserve(timepoints.size());
+    // Flatten the bdd once such that the chunks can be processed
+    // concurrently without accessing sylvan
+    std::vector<FlatBddNode> nodes{};
+    std::unordered_map<uint64_t, size_t> bddToIndex{};
+    recursiveFlatten(getTopLevelElementBdd(), nodes, bddToIndex);
+
+    std::vector<std::vector<ValueType>> resultVector(basicElements.size(), std::vector<ValueType>(timepoints.size()));
+
+    auto const nrThreads{storm::utility::parallel::resolveNumberOfThreads(numberOfThreads, timepoints.size())};
+    if (chunksize == 0) {
+        // Give each thread one chunk
+        chunksize = (timepoints.size() + nrThreads - 1) / nrThreads;
     }
+    auto const nrChunks{chunksize == 0 ? 0 : (timepoints.size() + chunksize - 1) / chunksize};
 
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
+    storm::utility::parallel::forEachTask(nrChunks, nrThreads, [&](uint64_t, uint64_t chunk) {
+        auto const firstIndex{chunk * chunksize};
+        auto const currentChunksize{std::min(chunksize, timepoints.size() - firstIndex)};
+
+        Eigen::ArrayXd timepointsArray{currentChunksize};
+        for (size_t i{0}; i < currentChunksize; ++i) {
+            timepointsArray(i) = timepoints[firstIndex + i];
         }
+        std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
+        updateBasicElementProbabilities(basicElements, beIndices, timepointsArray, indexToProbabilities);
 
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+        // One backward and one forward traversal yield all birnbaum factors
+        auto const [probabilitiesArray, birnbaumFactors]{allBirnbaumFactors(currentChunksize, nodes, indexToProbabilities)};
+        Eigen::ArrayXd const zeroArray{Eigen::ArrayXd::Zero(currentChunksize)};
 
         for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
-            auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
-            auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
+            auto const index{beIndices[basicElementIndex]};
+            auto const it{birnbaumFactors.find(index)};
+            // Basic elements which do not occur in the bdd have no influence
+            auto const &birnbaumFactorsArray{it != birnbaumFactors.end() ? it->second : zeroArray};
             auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
 
             auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
 
             // Update result Probabilities
             for (size_t i{0}; i < currentChunksize; ++i) {
-                resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
+                resultVector[basicElementIndex][firstIndex + i] = ImportanceMeasureArray(i);
             }
         }
     });
@@ -29,6 +29,17 @@ class SFTBDDChecker {
 
     SFTBDDChecker(std::shared_ptr<storm::dft::transformations::SftToBddTransformator<ValueType>> transformator);
 
+    /**
+     * Sets the number of threads used for computing the importance measures
+     * of all basic events at several timepoints.
+     * The timepoints are distributed over the threads in chunks.
+     * If no chunksize is given, each thread processes one chunk.
+     *
+     * \param numberOfThreads
+     * The number of threads. 0 means one thread per core.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads) noexcept;
+
     /**
      * \return The internal DFT
      */
@@ -380,6 +391,8 @@ class SFTBDDChecker {
     Bdd getTopLevelElementBdd();
 
     std::shared_ptr<storm::dft::transformations::SftToBddTransformator<ValueType>> transformator;
+
+    uint64_t numberOfThreads;
 };
 
 }  // namespace modelchecker
@@ -26,6 +26,7 @@ const std::string DftIOSettings::minValueOptionName = "min";
 const std::string DftIOSettings::maxValueOptionName = "max";
 const std::string DftIOSettings::analyzeWithBdds = "bdd";
 const std::string DftIOSettings::minimalCutSets = "mcs";
+const std::string DftIOSettings::analyzeWithSimulation = "simulate";
 const std::string DftIOSettings::exportToJsonOptionName = "export-json";
 const std::string DftIOSettings::exportToSmtOptionName = "export-smt";
 const std::string DftIOSettings::exportToBddDotOptionName = "export-bdd-dot";
@@ -80,6 +81,9 @@ DftIOSettings::DftIOSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, analyzeWithBdds, false, "Try to use Bdds for the analysis. Unsupportet properties will be ignored.")
             .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, minimalCutSets, false, "Calculate minimal cut sets.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, analyzeWithSimulation, false,
+                                                   "Estimate the failure probabilities for the given timebound or timepoints by statistical simulation.")
+                        .build());
 
     this->addOption(storm::settings::OptionBuilder(moduleName, exportToJsonOptionName, false, "Export the model to the Cytoscape JSON format.")
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the JSON file to export to.").build())
@@ -171,6 +175,10 @@ bool DftIOSettings::isMinimalCutSets() const {
     return this->getOption(minimalCutSets).getHasOptionBeenSet();
 }
 
+bool DftIOSettings::isAnalyzeWithSimulation() const {
+    return this->getOption(analyzeWithSimulation).getHasOptionBeenSet();
+}
+
 bool DftIOSettings::isExportToJson() const {
     return this->getOption(exportToJsonOptionName).getHasOptionBeenSet();
 }
@@ -223,6 +231,9 @@ bool DftIOSettings::check() const {
                     "The DFT may be either given in Galileo or JSON format, but not both.");
     // Ensure that at most one of min or max is set
     STORM_LOG_THROW(!isComputeMinimalValue() || !isComputeMaximalValue(), storm::exceptions::InvalidSettingsException, "Min and max can not both be set.");
+    // Simulation only supports time-bounded properties
+    STORM_LOG_THROW(!isAnalyzeWithSimulation() || usePropTimebound() || usePropTimepoints(), storm::exceptions::InvalidSettingsException,
+                    "Simulation requires a timebound or timepoints.");
     return true;
 }
 
@@ -128,6 +128,13 @@ class DftIOSettings : public storm::settings::modules::ModuleSettings {
      */
     bool isMinimalCutSets() const;
 
+    /*!
+     * Retrieves whether the analyze with simulation option was set.
+     *
+     * @return True if the analyze with simulation option was set.
+     */
+    bool isAnalyzeWithSimulation() const;
+
     /*!
      * Retrieves whether the export to Bdd Dot file option was set.
      *
@@ -212,6 +219,7 @@ class DftIOSettings : public storm::settings::modules::ModuleSettings {
     static const std::string maxValueOptionName;
     static const std::string analyzeWithBdds;
     static const std::string minimalCutSets;
+    static const std::string analyzeWithSimulation;
     static const std::string exportToJsonOptionName;
     static const std::string exportToSmtOptionName;
     static const std::string exportToBddDotOptionName;
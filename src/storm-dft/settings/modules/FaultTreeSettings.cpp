@@ -26,6 +26,15 @@ const std::string FaultTreeSettings::approximationErrorOptionName = "approximati
 const std::string FaultTreeSettings::approximationErrorOptionShortName = "approx";
 const std::string FaultTreeSettings::approximationHeuristicOptionName = "approximationheuristic";
 const std::string FaultTreeSettings::maxDepthOptionName = "maxdepth";
+const std::string FaultTreeSettings::explorationThreadsOptionName = "explorationthreads";
+const std::string FaultTreeSettings::moduleThreadsOptionName = "modulethreads";
+const std::string FaultTreeSettings::importanceThreadsOptionName = "importancethreads";
+const std::string FaultTreeSettings::simulationThreadsOptionName = "simulation-threads";
+const std::string FaultTreeSettings::simulationErrorOptionName = "simulation-error";
+const std::string FaultTreeSettings::simulationConfidenceOptionName = "simulation-confidence";
+const std::string FaultTreeSettings::simulationMaxTracesOptionName = "simulation-maxtraces";
+const std::string FaultTreeSettings::simulationSeedOptionName = "simulation-seed";
+const std::string FaultTreeSettings::simulationSplittingOptionName = "simulation-splitting";
 const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
 const std::string FaultTreeSettings::uniqueFailedBEOptionName = "uniquefailedbe";
 #ifdef STORM_HAVE_Z3
@@ -72,6 +81,75 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, maxDepthOptionName, false, "Maximal depth for state space exploration.")
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth", "The maximal depth.").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "Sets the number of threads used for generating successor states during state space exploration.")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 means one thread per core.")
+                                .setDefaultValueUnsignedInteger(1)
+                                .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, moduleThreadsOptionName, false,
+                                                   "Sets the number of threads used for analysing independent dynamic modules during modularisation.")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 means one thread per core.")
+                                .setDefaultValueUnsignedInteger(1)
+                                .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, importanceThreadsOptionName, false,
+                                                   "Sets the number of threads used for computing importance measures on the BDD.")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 means one thread per core.")
+                                .setDefaultValueUnsignedInteger(1)
+                                .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationThreadsOptionName, false, "Sets the number of threads used for simulating traces.")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 means one thread per core.")
+                                .setDefaultValueUnsignedInteger(1)
+                                .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationErrorOptionName, false,
+                                                   "The relative error (half-width of the confidence interval) which the simulation should achieve.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("error", "The relative error.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationConfidenceOptionName, false, "The confidence level used for the simulation.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence level.")
+                                         .setDefaultValueDouble(0.95)
+                                         .addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationMaxTracesOptionName, false, "The maximal number of traces to simulate.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal number of traces.")
+                                         .setDefaultValueUnsignedInteger(10000000)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, simulationSeedOptionName, false, "The seed for the random number generators of the simulation.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("seed", "The seed.").setDefaultValueUnsignedInteger(5).build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationSplittingOptionName, false,
+                                                   "Use multilevel splitting according to the number of failed BEs during simulation.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("factor",
+                                                                                                     "The number of copies created per crossed level.")
+                                         .setDefaultValueUnsignedInteger(2)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "levels", "The number of levels. 0 means one level per number of failed BEs.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, uniqueFailedBEOptionName, false, "Use a unique constantly failed BE.").build());
 #ifdef STORM_HAVE_Z3
     this->addOption(storm::settings::OptionBuilder(moduleName, solveWithSmtOptionName, true, "Solve the DFT with SMT.").build());
@@ -165,6 +243,50 @@ uint_fast64_t FaultTreeSettings::getMaxDepth() const {
     return this->getOption(maxDepthOptionName).getArgumentByName("depth").getValueAsUnsignedInteger();
 }
 
+uint_fast64_t FaultTreeSettings::getExplorationThreads() const {
+    return this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint_fast64_t FaultTreeSettings::getModuleThreads() const {
+    return this->getOption(moduleThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint_fast64_t FaultTreeSettings::getImportanceThreads() const {
+    return this->getOption(importanceThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint_fast64_t FaultTreeSettings::getSimulationThreads() const {
+    return this->getOption(simulationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+double FaultTreeSettings::getSimulationError() const {
+    return this->getOption(simulationErrorOptionName).getArgumentByName("error").getValueAsDouble();
+}
+
+double FaultTreeSettings::getSimulationConfidence() const {
+    return this->getOption(simulationConfidenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint_fast64_t FaultTreeSettings::getSimulationMaxTraces() const {
+    return this->getOption(simulationMaxTracesOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint_fast64_t FaultTreeSettings::getSimulationSeed() const {
+    return this->getOption(simulationSeedOptionName).getArgumentByName("seed").getValueAsUnsignedInteger();
+}
+
+bool FaultTreeSettings::isSimulationSplittingSet() const {
+    return this->getOption(simulationSplittingOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t FaultTreeSettings::getSimulationSplittingFactor() const {
+    return this->getOption(simulationSplittingOptionName).getArgumentByName("factor").getValueAsUnsignedInteger();
+}
+
+uint_fast64_t FaultTreeSettings::getSimulationSplittingLevels() const {
+    return this->getOption(simulationSplittingOptionName).getArgumentByName("levels").getValueAsUnsignedInteger();
+}
+
 bool FaultTreeSettings::isTakeFirstDependency() const {
     return this->getOption(firstDependencyOptionName).getHasOptionBeenSet();
 }
@@ -102,6 +102,83 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     uint_fast64_t getMaxDepth() const;
 
+    /*!
+     * Retrieves the number of threads used for generating successor states during state space exploration.
+     *
+     * @return The number of threads (0 means one thread per core).
+     */
+    uint_fast64_t getExplorationThreads() const;
+
+    /*!
+     * Retrieves the number of threads used for analysing independent dynamic modules during modularisation.
+     *
+     * @return The number of threads (0 means one thread per core).
+     */
+    uint_fast64_t getModuleThreads() const;
+
+    /*!
+     * Retrieves the number of threads used for computing importance measures on the BDD.
+     *
+     * @return The number of threads (0 means one thread per core).
+     */
+    uint_fast64_t getImportanceThreads() const;
+
+    /*!
+     * Retrieves the number of threads used for simulating traces.
+     *
+     * @return The number of threads (0 means one thread per core).
+     */
+    uint_fast64_t getSimulationThreads() const;
+
+    /*!
+     * Retrieves the relative error which the simulation should achieve.
+     *
+     * @return The relative error.
+     */
+    double getSimulationError() const;
+
+    /*!
+     * Retrieves the confidence level used for the simulation.
+     *
+     * @return The confidence level.
+     */
+    double getSimulationConfidence() const;
+
+    /*!
+     * Retrieves the maximal number of traces to simulate.
+     *
+     * @return The maximal number of traces.
+     */
+    uint_fast64_t getSimulationMaxTraces() const;
+
+    /*!
+     * Retrieves the seed for the random number generators of the simulation.
+     *
+     * @return The seed.
+     */
+    uint_fast64_t getSimulationSeed() const;
+
+    /*!
+     * Retrieves whether multilevel splitting should be used during simulation.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSimulationSplittingSet() const;
+
+    /*!
+     * Retrieves the number of copies created per crossed level during splitting.
+     *
+     * @return The splitting factor.
+     */
+    uint_fast64_t getSimulationSplittingFactor() const;
+
+    /*!
+     * Retrieves the number of levels used for splitting.
+     *
+     * @return The number of levels (0 means one level per number of failed BEs).
+     */
+    uint_fast64_t getSimulationSplittingLevels() const;
+
     /*!
      * Retrieves whether the non-determinism should be avoided by always taking the first possible dependency.
      *
@@ -187,6 +264,15 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string approximationErrorOptionShortName;
     static const std::string approximationHeuristicOptionName;
     static const std::string maxDepthOptionName;
+    static const std::string explorationThreadsOptionName;
+    static const std::string moduleThreadsOptionName;
+    static const std::string importanceThreadsOptionName;
+    static const std::string simulationThreadsOptionName;
+    static const std::string simulationErrorOptionName;
+    static const std::string simulationConfidenceOptionName;
+    static const std::string simulationMaxTracesOptionName;
+    static const std::string simulationSeedOptionName;
+    static const std::string simulationSplittingOptionName;
     static const std::string firstDependencyOptionName;
     static const std::string uniqueFailedBEOptionName;
 #ifdef STORM_HAVE_Z3
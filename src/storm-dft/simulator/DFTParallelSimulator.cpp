@@ -0,0 +1,202 @@
+#include "DFTParallelSimulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm-dft/settings/modules/FaultTreeSettings.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/parallel.h"
+
+namespace storm::dft {
+namespace simulator {
+
+namespace {
+
+/*!
+ * Derive the seed of the random number generator for the given batch (using the finalizer of SplitMix64).
+ * Consecutive batches therefore obtain well-separated streams and the result does not depend on which thread simulates which batch.
+ */
+uint32_t deriveBatchSeed(uint64_t seed, uint64_t batch) {
+    uint64_t z = seed + (batch + 1) * 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z = z ^ (z >> 31);
+    return static_cast<uint32_t>(z ^ (z >> 32));
+}
+
+/*!
+ * Accumulated results of simulated traces.
+ */
+struct BatchResult {
+    double sum = 0;
+    double sumOfSquares = 0;
+    uint64_t count = 0;
+};
+
+}  // namespace
+
+template<typename ValueType>
+DFTParallelSimulator<ValueType>::DFTParallelSimulator(storm::dft::storage::DFT<ValueType> const& dft,
+                                                      storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, uint64_t seed)
+    : dft(dft),
+      stateGenerationInfo(stateGenerationInfo),
+      seed(seed),
+      numberOfThreads(storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getSimulationThreads()),
+      tracesPerBatch(1000),
+      importanceFunction(nullptr),
+      splittingFactor(1),
+      numberOfLevels(1) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void DFTParallelSimulator<ValueType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    this->numberOfThreads = numberOfThreads;
+}
+
+template<typename ValueType>
+void DFTParallelSimulator<ValueType>::setTracesPerBatch(uint64_t tracesPerBatch) {
+    STORM_LOG_THROW(tracesPerBatch > 0, storm::exceptions::IllegalArgumentValueException, "Number of traces per batch must be positive.");
+    this->tracesPerBatch = tracesPerBatch;
+}
+
+template<typename ValueType>
+void DFTParallelSimulator<ValueType>::setSplitting(std::shared_ptr<ImportanceFunction<ValueType>> importanceFunction, uint64_t splittingFactor,
+                                                   uint64_t numberOfLevels) {
+    STORM_LOG_THROW(splittingFactor > 0, storm::exceptions::IllegalArgumentValueException, "Splitting factor must be positive.");
+    STORM_LOG_THROW(numberOfLevels > 0, storm::exceptions::IllegalArgumentValueException, "Number of splitting levels must be positive.");
+    this->importanceFunction = importanceFunction;
+    this->splittingFactor = splittingFactor;
+    this->numberOfLevels = numberOfLevels;
+}
+
+template<typename ValueType>
+uint64_t DFTParallelSimulator<ValueType>::getLevel(DFTStatePointer const& state) const {
+    auto [lower, upper] = importanceFunction->getImportanceRange();
+    if (upper <= lower) {
+        return 0;
+    }
+    double relativeImportance = (importanceFunction->getImportance(state) - lower) / (upper - lower);
+    uint64_t level = static_cast<uint64_t>(std::max(0.0, std::floor(relativeImportance * numberOfLevels)));
+    return std::min(level, numberOfLevels - 1);
+}
+
+template<typename ValueType>
+double DFTParallelSimulator<ValueType>::simulateTrace(DFTTraceSimulator<ValueType>& simulator, double timebound) const {
+    if (!importanceFunction) {
+        return simulator.simulateCompleteTrace(timebound) == SimulationTraceResult::SUCCESSFUL ? 1 : 0;
+    }
+
+    simulator.resetToInitial();
+    if (simulator.getCurrentState()->hasFailed(dft.getTopLevelIndex())) {
+        STORM_LOG_TRACE("DFT is initially failed");
+        return 1;
+    }
+
+    // Copies of the trace which still need to be simulated.
+    // Failure propagation always creates new states, so the copies can share their state.
+    struct SplitTrace {
+        DFTStatePointer state;
+        double time;
+        uint64_t level;
+        double weight;
+    };
+    std::vector<SplitTrace> traces;
+    traces.push_back({simulator.getCurrentState(), 0, getLevel(simulator.getCurrentState()), 1});
+    double estimate = 0;
+    while (!traces.empty()) {
+        SplitTrace trace = std::move(traces.back());
+        traces.pop_back();
+        simulator.resetToState(trace.state);
+        simulator.setTime(trace.time);
+
+        while (true) {
+            SimulationTraceResult result = simulator.simulateNextStep(timebound);
+            if (result == SimulationTraceResult::SUCCESSFUL) {
+                estimate += trace.weight;
+                break;
+            } else if (result != SimulationTraceResult::CONTINUE) {
+                break;
+            }
+
+            uint64_t level = getLevel(simulator.getCurrentState());
+            if (level > trace.level) {
+                // Split trace
+                uint64_t copies = 1;
+                for (uint64_t i = trace.level; i < level; ++i) {
+                    copies *= splittingFactor;
+                }
+                double weight = trace.weight / copies;
+                for (uint64_t i = 0; i < copies; ++i) {
+                    traces.push_back({simulator.getCurrentState(), simulator.getCurrentTime(), level, weight});
+                }
+                break;
+            }
+        }
+    }
+    return estimate;
+}
+
+template<typename ValueType>
+SimulationEstimate DFTParallelSimulator<ValueType>::estimateProbability(double timebound, double relativeError, double confidence,
+                                                                        uint64_t maxTraces) const {
+    STORM_LOG_THROW(relativeError > 0, storm::exceptions::IllegalArgumentValueException, "Relative error must be positive.");
+    STORM_LOG_THROW(confidence > 0 && confidence < 1, storm::exceptions::IllegalArgumentValueException, "Confidence must be in (0,1).");
+    STORM_LOG_THROW(maxTraces > 0, storm::exceptions::IllegalArgumentValueException, "Maximal number of traces must be positive.");
+
+    double quantile = boost::math::quantile(boost::math::normal_distribution<double>(), (1 + confidence) / 2);
+    uint64_t maxBatches = (maxTraces + tracesPerBatch - 1) / tracesPerBatch;
+    uint64_t threads = storm::utility::parallel::resolveNumberOfThreads(numberOfThreads, maxBatches);
+    // Give each thread several batches per round to balance the load.
+    uint64_t batchesPerRound = 4 * threads;
+
+    SimulationEstimate estimate;
+    BatchResult total;
+    uint64_t nextBatch = 0;
+    while (nextBatch < maxBatches) {
+        std::vector<BatchResult> results(std::min(batchesPerRound, maxBatches - nextBatch));
+        storm::utility::parallel::forEachTask(results.size(), threads, [&](uint64_t, uint64_t task) {
+            uint64_t batch = nextBatch + task;
+            boost::mt19937 generator(deriveBatchSeed(seed, batch));
+            DFTTraceSimulator<ValueType> simulator(dft, stateGenerationInfo, generator);
+            BatchResult& result = results[task];
+            result.count = std::min(tracesPerBatch, maxTraces - batch * tracesPerBatch);
+            for (uint64_t i = 0; i < result.count; ++i) {
+                double value = simulateTrace(simulator, timebound);
+                result.sum += value;
+                result.sumOfSquares += value * value;
+            }
+        });
+        nextBatch += results.size();
+
+        // Merge in a fixed order to obtain reproducible results
+        for (auto const& result : results) {
+            total.sum += result.sum;
+            total.sumOfSquares += result.sumOfSquares;
+            total.count += result.count;
+        }
+        double n = static_cast<double>(total.count);
+        estimate.numberOfTraces = total.count;
+        estimate.probability = total.sum / n;
+        estimate.variance = total.count > 1 ? std::max(0.0, (total.sumOfSquares - total.sum * estimate.probability) / (n - 1)) / n : 0;
+        estimate.halfWidth = quantile * std::sqrt(estimate.variance);
+        STORM_LOG_DEBUG("Simulated " << total.count << " traces: estimate " << estimate.probability << " +- " << estimate.halfWidth);
+
+        if (estimate.probability > 0 && estimate.halfWidth <= relativeError * estimate.probability) {
+            break;
+        }
+    }
+    STORM_LOG_WARN_COND(estimate.probability > 0 && estimate.halfWidth <= relativeError * estimate.probability,
+                        "Maximal number of traces reached before achieving the relative error of " << relativeError << ".");
+    return estimate;
+}
+
+template class DFTParallelSimulator<double>;
+template class DFTParallelSimulator<storm::RationalFunction>;
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <memory>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm-dft/simulator/ImportanceFunction.h"
+#include "storm-dft/storage/DFT.h"
+#include "storm-dft/storage/DFTState.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Statistical estimate obtained by simulation.
+ */
+struct SimulationEstimate {
+    // Estimated probability.
+    double probability = 0;
+    // Estimated variance of the estimator.
+    double variance = 0;
+    // Half-width of the confidence interval around the estimated probability.
+    double halfWidth = 0;
+    // Number of (root) traces which were simulated.
+    uint64_t numberOfTraces = 0;
+};
+
+/*!
+ * Statistical estimation of the unreliability of a DFT by simulating independent traces in parallel.
+ * The traces are simulated in batches. Each batch uses its own random number generator whose seed is derived from the given seed and the batch index.
+ * The estimators of all batches are merged after each round of batches and the simulation stops as soon as the desired relative error is reached.
+ *
+ * Optionally, fixed multilevel splitting according to an importance function can be used to estimate small probabilities.
+ * The importance range is divided into equally sized levels.
+ * Whenever a trace reaches a higher level, it is split into splittingFactor copies per crossed level and its weight is divided accordingly.
+ * The estimate of a single trace is then the sum of weights of all its successful copies.
+ */
+template<typename ValueType>
+class DFTParallelSimulator {
+    using DFTStatePointer = std::shared_ptr<storm::dft::storage::DFTState<ValueType>>;
+
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT which is prepared for simulation.
+     * @param stateGenerationInfo Info for state generation.
+     * @param seed Seed for the random number generators.
+     */
+    DFTParallelSimulator(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                         uint64_t seed);
+
+    /*!
+     * Set the number of threads used for simulating traces.
+     *
+     * @param numberOfThreads Number of threads. 0 means one thread per core.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
+    /*!
+     * Set the number of traces simulated in a single batch.
+     *
+     * @param tracesPerBatch Number of traces per batch.
+     */
+    void setTracesPerBatch(uint64_t tracesPerBatch);
+
+    /*!
+     * Use multilevel splitting according to the given importance function.
+     *
+     * @param importanceFunction Importance function.
+     * @param splittingFactor Number of copies created when a trace crosses a level.
+     * @param numberOfLevels Number of levels the importance range is divided into.
+     */
+    void setSplitting(std::shared_ptr<ImportanceFunction<ValueType>> importanceFunction, uint64_t splittingFactor, uint64_t numberOfLevels);
+
+    /*!
+     * Estimate the probability that the DFT fails within the given time bound.
+     * The simulation stops if the half-width of the confidence interval is at most relativeError times the estimated probability
+     * or if the maximal number of traces was simulated.
+     *
+     * @param timebound Time bound.
+     * @param relativeError Relative error which should be achieved.
+     * @param confidence Confidence level of the confidence interval.
+     * @param maxTraces Maximal number of traces to simulate.
+     * @return Estimate.
+     */
+    SimulationEstimate estimateProbability(double timebound, double relativeError, double confidence, uint64_t maxTraces) const;
+
+   private:
+    /*!
+     * Simulate a single trace (including all copies obtained by splitting).
+     *
+     * @param simulator Simulator to use.
+     * @param timebound Time bound.
+     * @return Estimated probability given by the trace, i.e., the sum of weights of all successful copies.
+     */
+    double simulateTrace(DFTTraceSimulator<ValueType>& simulator, double timebound) const;
+
+    /*!
+     * Get the splitting level of the given state.
+     */
+    uint64_t getLevel(DFTStatePointer const& state) const;
+
+    // The DFT to simulate.
+    storm::dft::storage::DFT<ValueType> const& dft;
+
+    // General information for the state generation.
+    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo;
+
+    uint64_t seed;
+    uint64_t numberOfThreads;
+    uint64_t tracesPerBatch;
+
+    // Importance function used for splitting (nullptr if no splitting is used).
+    std::shared_ptr<ImportanceFunction<ValueType>> importanceFunction;
+    uint64_t splittingFactor;
+    uint64_t numberOfLevels;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
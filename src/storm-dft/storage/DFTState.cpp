@@ -241,7 +241,7 @@ bool DFTState<ValueType>::updateFailableDependencies(size_t id) {
     }
 
     bool addedFailableDependency = false;
-    for (auto dependency : mDft.getElement(id)->outgoingDependencies()) {
+    for (auto const& dependency : mDft.getElement(id)->outgoingDependencies()) {
         STORM_LOG_ASSERT(dependency->triggerEvent()->id() == id, "Ids do not match.");
         if (getDependencyState(dependency->id()) == DFTDependencyState::Passive) {
             STORM_LOG_ASSERT(dependency->dependentEvents().size() == 1, "Only one dependent event is allowed.");
@@ -269,7 +269,7 @@ bool DFTState<ValueType>::updateFailableInRestrictions(size_t id) {
     }
 
     bool addedFailableEvent = false;
-    for (auto restriction : mDft.getElement(id)->restrictions()) {
+    for (auto const& restriction : mDft.getElement(id)->restrictions()) {
         STORM_LOG_ASSERT(restriction->containsChild(id), "Ids do not match.");
         if (restriction->isSeqEnforcer()) {
             for (auto it = restriction->children().cbegin(); it != restriction->children().cend(); ++it) {
@@ -298,7 +298,7 @@ bool DFTState<ValueType>::updateFailableInRestrictions(size_t id) {
 
                         // Also check if dependency triggering the BE could now fail
                         bool change = false;
-                        for (auto dependency : be->ingoingDependencies()) {
+                        for (auto const& dependency : be->ingoingDependencies()) {
                             change |= updateFailableDependencies(dependency->triggerEvent()->id());
                         }
                         if (change) {
@@ -330,7 +330,7 @@ void DFTState<ValueType>::updateDontCareDependencies(size_t id) {
     STORM_LOG_ASSERT(mDft.isBasicElement(id), "Element is no BE.");
     STORM_LOG_ASSERT(hasFailed(id), "Element has not failed.");
 
-    for (auto dependency : mDft.getBasicElement(id)->ingoingDependencies()) {
+    for (auto const& dependency : mDft.getBasicElement(id)->ingoingDependencies()) {
         assert(dependency->dependentEvents().size() == 1);
         STORM_LOG_ASSERT(dependency->dependentEvents()[0]->id() == id, "Ids do not match.");
         setDependencyDontCare(dependency->id());
@@ -354,11 +354,11 @@ ValueType DFTState<ValueType>::getBERate(size_t id) const {
 }
 
 template<typename ValueType>
-void DFTState<ValueType>::letBEFail(std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) {
+void DFTState<ValueType>::letBEFail(std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& be) {
     STORM_LOG_ASSERT(!hasFailed(be->id()), "Element " << *be << " has already failed.");
     // Check if BE can fail on its own or is triggered by dependency
     STORM_LOG_ASSERT(be->canFail() || std::any_of(be->ingoingDependencies().begin(), be->ingoingDependencies().end(),
-                                                  [this](std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType>> dep) {
+                                                  [this](std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType>> const& dep) {
                                                       return this->dependencySuccessful(dep->id());
                                                   }),
                      "Element " << *be << " cannot fail.");
@@ -368,7 +368,8 @@ void DFTState<ValueType>::letBEFail(std::shared_ptr<storm::dft::storage::element
 }
 
 template<typename ValueType>
-void DFTState<ValueType>::letDependencyTrigger(std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency, bool successful) {
+void DFTState<ValueType>::letDependencyTrigger(std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> const& dependency,
+                                               bool successful) {
     STORM_LOG_ASSERT(failableElements.hasDependencies(), "Index invalid.");
     failableElements.removeDependency(dependency->id());
     if (successful) {
@@ -555,7 +556,7 @@ bool DFTState<ValueType>::orderBySymmetry() {
     for (size_t pos = 0; pos < mStateGenerationInfo.getSymmetrySize(); ++pos) {
         // Check each symmetry
         size_t length = mStateGenerationInfo.getSymmetryLength(pos);
-        std::vector<size_t> symmetryIndices = mStateGenerationInfo.getSymmetryIndices(pos);
+        std::vector<size_t> const& symmetryIndices = mStateGenerationInfo.getSymmetryIndices(pos);
         // Sort symmetry group in decreasing order by bubble sort
         // TODO use better algorithm?
         size_t tmp;
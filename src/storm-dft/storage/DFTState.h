@@ -247,7 +247,7 @@ class DFTState {
      *
      * @param be BE to fail.
      */
-    void letBEFail(std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be);
+    void letBEFail(std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& be);
 
     /**
      * Trigger the dependency and set it as successful/unsuccessful.
@@ -255,7 +255,7 @@ class DFTState {
      * @param dependency Dependency.
      * @param successful Whether the triggering was successful.
      */
-    void letDependencyTrigger(std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency, bool successful = true);
+    void letDependencyTrigger(std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> const& dependency, bool successful = true);
 
     /**
      * Order the state in decreasing order using the symmetries.
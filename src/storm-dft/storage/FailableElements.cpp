@@ -1,5 +1,6 @@
 #include "storm-dft/storage/FailableElements.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "storm-dft/storage/DFT.h"
@@ -8,8 +9,8 @@ namespace storm::dft {
 namespace storage {
 
 FailableElements::const_iterator::const_iterator(bool dependency, bool conflicting, storm::storage::BitVector::const_iterator const& iterBE,
-                                                 std::list<size_t>::const_iterator const& iterDependency, std::list<size_t>::const_iterator nonConflictEnd,
-                                                 std::list<size_t>::const_iterator conflictBegin)
+                                                 std::vector<size_t>::const_iterator const& iterDependency,
+                                                 std::vector<size_t>::const_iterator nonConflictEnd, std::vector<size_t>::const_iterator conflictBegin)
     : dependency(dependency), conflicting(conflicting), itBE(iterBE), itDep(iterDependency), nonConflictEnd(nonConflictEnd), conflictBegin(conflictBegin) {
     STORM_LOG_ASSERT(conflicting || itDep != nonConflictEnd, "No non-conflicting dependencies present.");
 }
@@ -84,17 +85,12 @@ void FailableElements::addBE(size_t id) {
 }
 
 void FailableElements::addDependency(size_t id, bool isConflicting) {
-    std::list<size_t>& failableList = (isConflicting ? failableConflictingDependencies : failableNonconflictingDependencies);
-    for (auto it = failableList.begin(); it != failableList.end(); ++it) {
-        if (*it > id) {
-            failableList.insert(it, id);
-            return;
-        } else if (*it == id) {
-            // Dependency already contained
-            return;
-        }
+    std::vector<size_t>& failableList = (isConflicting ? failableConflictingDependencies : failableNonconflictingDependencies);
+    auto it = std::lower_bound(failableList.begin(), failableList.end(), id);
+    if (it == failableList.end() || *it != id) {
+        failableList.insert(it, id);
     }
-    failableList.push_back(id);
+    // Otherwise, the dependency is already contained
 }
 
 void FailableElements::removeBE(size_t id) {
@@ -102,13 +98,13 @@ void FailableElements::removeBE(size_t id) {
 }
 
 void FailableElements::removeDependency(size_t id) {
-    auto iter = std::find(failableConflictingDependencies.begin(), failableConflictingDependencies.end(), id);
-    if (iter != failableConflictingDependencies.end()) {
+    auto iter = std::lower_bound(failableConflictingDependencies.begin(), failableConflictingDependencies.end(), id);
+    if (iter != failableConflictingDependencies.end() && *iter == id) {
         failableConflictingDependencies.erase(iter);
         return;
     }
-    iter = std::find(failableNonconflictingDependencies.begin(), failableNonconflictingDependencies.end(), id);
-    if (iter != failableNonconflictingDependencies.end()) {
+    iter = std::lower_bound(failableNonconflictingDependencies.begin(), failableNonconflictingDependencies.end(), id);
+    if (iter != failableNonconflictingDependencies.end() && *iter == id) {
         failableNonconflictingDependencies.erase(iter);
         return;
     }
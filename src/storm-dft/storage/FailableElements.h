@@ -1,7 +1,7 @@
 #pragma once
 
-#include <list>
 #include <memory>
+#include <vector>
 
 #include "storm/storage/BitVector.h"
 
@@ -59,8 +59,8 @@ class FailableElements {
          * @param conflictBegin Iterator to begin of conflicting dependencies.
          */
         const_iterator(bool dependency, bool conflicting, storm::storage::BitVector::const_iterator const& iterBE,
-                       std::list<size_t>::const_iterator const& iterDependency, std::list<size_t>::const_iterator nonConflictEnd,
-                       std::list<size_t>::const_iterator conflictBegin);
+                       std::vector<size_t>::const_iterator const& iterDependency, std::vector<size_t>::const_iterator nonConflictEnd,
+                       std::vector<size_t>::const_iterator conflictBegin);
 
         /*!
          * Constructs an iterator by copying the given iterator.
@@ -148,12 +148,12 @@ class FailableElements {
         bool conflicting;
         // Iterators for underlying data structures
         storm::storage::BitVector::const_iterator itBE;
-        std::list<size_t>::const_iterator itDep;
+        std::vector<size_t>::const_iterator itDep;
 
         // Pointers marking end of non-conflict list and beginning of conflict list
         // Used for sequential iteration over all dependencies
-        std::list<size_t>::const_iterator nonConflictEnd;
-        std::list<size_t>::const_iterator conflictBegin;
+        std::vector<size_t>::const_iterator nonConflictEnd;
+        std::vector<size_t>::const_iterator conflictBegin;
     };
 
     /*!
@@ -244,12 +244,13 @@ class FailableElements {
     std::string getCurrentlyFailableString(bool forceBE = false) const;
 
    private:
-    // We use a BitVector for BEs but a list for dependencies, because usually only a few dependencies are failable at the same time.
+    // We use a BitVector for BEs but a vector for dependencies, because usually only a few dependencies are failable at the same time.
     // In contrast, usually most BEs are failable.
-    // The lists of failable elements are sorted by increasing id.
+    // As the failable elements are copied for every generated state, we avoid node-based containers which would require one allocation per element.
+    // The vectors of failable dependencies are sorted by increasing id.
     storm::storage::BitVector currentlyFailableBE;
-    std::list<size_t> failableConflictingDependencies;
-    std::list<size_t> failableNonconflictingDependencies;
+    std::vector<size_t> failableConflictingDependencies;
+    std::vector<size_t> failableNonconflictingDependencies;
 };
 
 }  // namespace storage
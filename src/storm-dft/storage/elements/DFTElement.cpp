@@ -21,7 +21,7 @@ bool DFTElement<ValueType>::checkDontCareAnymore(storm::dft::storage::DFTState<V
 
     // Check that no outgoing dependencies can be triggered anymore
     // Notice that n-ary dependencies are supported via rewriting them during build-time
-    for (DFTDependencyPointer dependency : mOutgoingDependencies) {
+    for (DFTDependencyPointer const& dependency : mOutgoingDependencies) {
         assert(dependency->dependentEvents().size() == 1);
         if (state.isOperational(dependency->dependentEvents()[0]->id()) && state.isOperational(dependency->triggerEvent()->id())) {
             return false;
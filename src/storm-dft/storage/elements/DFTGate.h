@@ -57,12 +57,12 @@ class DFTGate : public DFTChildren<ValueType> {
 
    protected:
     void fail(storm::dft::storage::DFTState<ValueType>& state, storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const override {
-        for (std::shared_ptr<DFTGate> parent : this->mParents) {
+        for (std::shared_ptr<DFTGate> const& parent : this->mParents) {
             if (state.isOperational(parent->id())) {
                 queues.propagateFailure(parent);
             }
         }
-        for (std::shared_ptr<DFTRestriction<ValueType>> restr : this->mRestrictions) {
+        for (std::shared_ptr<DFTRestriction<ValueType>> const& restr : this->mRestrictions) {
             queues.checkRestrictionLater(restr);
         }
         state.setFailed(this->mId);
@@ -70,7 +70,7 @@ class DFTGate : public DFTChildren<ValueType> {
     }
 
     void failsafe(storm::dft::storage::DFTState<ValueType>& state, storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const override {
-        for (std::shared_ptr<DFTGate> parent : this->mParents) {
+        for (std::shared_ptr<DFTGate> const& parent : this->mParents) {
             if (state.isOperational(parent->id())) {
                 queues.propagateFailsafe(parent);
             }
@@ -6,9 +6,12 @@
 #include "storm-gspn/storage/gspn/GspnBuilder.h"
 
 #include "storm/utility/initialize.h"
+#include "storm/utility/Stopwatch.h"
 #include "storm/utility/macros.h"
 
 #include "storm/api/storm.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 
 #include "storm-cli-utilities/cli.h"
 #include "storm-parsers/api/storm-parsers.h"
@@ -52,6 +55,32 @@ void initializeSettings(std::string const& name, std::string const& executableNa
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
 }
 
+/*!
+ * Builds the explicit model of the GSPN directly and checks the given properties on it.
+ */
+void analyzeExplicitModel(storm::gspn::GSPN const& gspn, std::vector<storm::jani::Property> const& properties, bool eliminateVanishingMarkings) {
+    storm::utility::Stopwatch buildWatch(true);
+    auto model = storm::api::buildSparseModelFromGspn(gspn, storm::api::extractFormulasFromProperties(properties), eliminateVanishingMarkings);
+    buildWatch.stop();
+    model->printModelInformationToStream(std::cout);
+    STORM_PRINT_AND_LOG("Time for model construction: " << buildWatch << ".\n");
+
+    for (auto const& property : properties) {
+        STORM_PRINT_AND_LOG("\nModel checking property \"" << property.getName() << "\": " << *property.getRawFormula() << " ...\n");
+        storm::utility::Stopwatch checkWatch(true);
+        std::unique_ptr<storm::modelchecker::CheckResult> result =
+            storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(property.getRawFormula(), true));
+        checkWatch.stop();
+        if (result) {
+            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+            STORM_PRINT_AND_LOG("Result (for initial states): " << *result << '\n');
+        } else {
+            STORM_PRINT_AND_LOG("Result: Not available.\n");
+        }
+        STORM_PRINT_AND_LOG("Time for model checking: " << checkWatch << ".\n");
+    }
+}
+
 void processOptions() {
     auto gspnSettings = storm::settings::getModule<storm::settings::modules::GSPNSettings>();
 
@@ -96,10 +125,9 @@ void processOptions() {
 
     storm::api::handleGSPNExportSettings(*gspn, [&](storm::builder::JaniGSPNBuilder const&) { return properties; });
 
-    //        // construct ma
-    //        auto builder = storm::builder::ExplicitGspnModelBuilder<>();
-    //        auto ma = builder.translateGspn(gspn, formula);
-    //
+    if (gspnSettings.isExplicitBuildSet()) {
+        analyzeExplicitModel(*gspn, properties, !gspnSettings.isKeepVanishingSet());
+    }
 
     delete gspn;
 }
@@ -1,8 +1,11 @@
 #include "storm-gspn/api/storm-gspn.h"
 
 #include <boost/algorithm/string.hpp>
+#include <set>
+#include <sstream>
 #include "storm-conv/api/storm-conv.h"
 #include "storm-conv/settings/modules/JaniExportSettings.h"
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
 #include "storm-gspn/settings/modules/GSPNExportSettings.h"
 #include "storm-parsers/parser/ExpressionParser.h"
 #include "storm/exceptions/WrongFormatException.h"
@@ -17,6 +20,24 @@ storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn) {
     return builder.build();
 }
 
+std::shared_ptr<storm::models::sparse::Model<double>> buildSparseModelFromGspn(storm::gspn::GSPN const& gspn,
+                                                                               std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                                               bool eliminateVanishingMarkings) {
+    storm::builder::ExplicitGspnModelBuilder<double> builder(gspn, eliminateVanishingMarkings);
+    std::set<std::string> labelNames;
+    for (auto const& formula : formulas) {
+        for (auto const& atomicFormula : formula->getAtomicExpressionFormulas()) {
+            // The model checker refers to atomic expressions by their string representation
+            std::stringstream stream;
+            stream << atomicFormula->getExpression();
+            if (labelNames.insert(stream.str()).second) {
+                builder.addLabel(stream.str(), atomicFormula->getExpression());
+            }
+        }
+    }
+    return builder.build();
+}
+
 void handleGSPNExportSettings(storm::gspn::GSPN const& gspn,
                               std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter) {
     storm::settings::modules::GSPNExportSettings const& exportSettings = storm::settings::getModule<storm::settings::modules::GSPNExportSettings>();
@@ -4,6 +4,8 @@
 
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
 #include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Model.h"
 #include "storm/storage/jani/Model.h"
 
 namespace storm {
@@ -14,6 +16,15 @@ namespace api {
  */
 storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn);
 
+/**
+ *    Builds the explicit model of the GSPN directly, i.e., without the translation to JANI.
+ *    All atomic expressions occurring in the given formulas are added as labels.
+ *    If eliminateVanishingMarkings is set, vanishing markings are eliminated during the exploration (as long as this preserves the labels).
+ */
+std::shared_ptr<storm::models::sparse::Model<double>> buildSparseModelFromGspn(storm::gspn::GSPN const& gspn,
+                                                                               std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                                               bool eliminateVanishingMarkings = true);
+
 void handleGSPNExportSettings(
     storm::gspn::GSPN const& gspn, std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter =
                                        [](storm::builder::JaniGSPNBuilder const&) { return std::vector<storm::jani::Property>(); });
@@ -1,332 +1,521 @@
-// #include "storm/builder/ExplicitGspnModelBuilder.h"
-//
-// #include "storm/models/sparse/StandardRewardModel.h"
-//
-// #include "storm/utility/macros.h"
-// #include "storm/exceptions/NotImplementedException.h"
-// #include "storm/storage/expressions/ExpressionManager.h"
-// #include "storm-parsers/parser/FormulaParser.h"
-// #include "storm/storage/expressions/ExpressionEvaluator.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         template<typename ValueType>
-//         storm::models::sparse::MarkovAutomaton<ValueType> ExplicitGspnModelBuilder<ValueType>::translateGspn(storm::gspn::GSPN const& gspn, std::string
-//         const& formula) {
-//             // set the given gspn and compute the limits of the net
-//             this->gspn = gspn;
-//             computeCapacities(gspn);
-//
-//             // markings maps markings to their corresponding rowgroups (indices)
-//             markings = storm::storage::BitVectorHashMap<uint_fast64_t>(numberOfTotalBits, 100);
-//             builder = storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true);
-//
-//             // add initial marking to todo list
-//             auto bitvector = gspn.getInitialMarking(numberOfBits, numberOfTotalBits)->getBitVector();
-//             findOrAddBitvectorToMarkings(*bitvector);
-//             currentRowIndex = 0;
-//
-//             // vector marking markovian states (vector contains an 1 if the state is markovian)
-//             storm::storage::BitVector markovianStates(0);
-//
-//             // vector containing the exit rates for the markovian states
-//             std::vector<ValueType> exitRates;
-//
-//
-//             while (!todo.empty()) {
-//                 // take next element from the todo list
-//                 auto currentBitvector = todo.front();
-//                 todo.pop_front();
-//                 auto currentMarking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, *currentBitvector);
-//
-//                 // increment list of states by one
-//                 markovianStates.resize(markovianStates.size() + 1, 0);
-//
-//                 // create new row group for the current marking
-//                 builder.newRowGroup(markings.getValue(*currentBitvector));
-//
-//                 std::cout << "work on: " << *currentBitvector << '\n';
-//
-//                 auto enabledImmediateTransitions = getEnabledImmediateTransition(currentMarking);
-//                 if (!enabledImmediateTransitions.empty()) {
-//                     markovianStates.set(currentRowIndex, 0);
-//                     exitRates.push_back(0);
-//
-//                     auto partitions = partitonEnabledImmediateTransitions(currentMarking, enabledImmediateTransitions);
-//                     addRowForPartitions(partitions, currentMarking);
-//                 } else {
-//
-//                     auto enabledTimedTransitions = getEnabledTimedTransition(currentMarking);
-//                     if (!enabledTimedTransitions.empty()) {
-//                         markovianStates.set(currentRowIndex, 1);
-//
-//                         auto accRate = getAccumulatedRate(enabledTimedTransitions);
-//                         std::cout << "\t\tacc. rate: " << accRate << '\n';
-//                         exitRates.push_back(accRate);
-//
-//                         addRowForTimedTransitions(enabledTimedTransitions, currentMarking, accRate);
-//                     } else {
-//                         markovianStates.set(currentRowIndex, 1);
-//                     }
-//                 }
-//                 ++currentRowIndex;
-//             }
-//
-//             auto matrix = builder.build();
-//
-//             // create expression manager and add variables from the gspn
-//             auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-//             for (auto& place : gspn.getPlaces()) {
-//                 expressionManager->declareIntegerVariable(place.getName());
-//             }
-//
-//             // parse formula
-//             storm::parser::FormulaParser formulaParser(expressionManager);
-//             auto formulaPtr = formulaParser.parseSingleFormulaFromString(formula);
-//             auto atomicFormulas = formulaPtr->getAtomicExpressionFormulas();
-//
-//             // create empty state labeling
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//             storm::expressions::ExpressionEvaluator<double> expressionEvaluator(*expressionManager);
-//
-//             std::cout << '\n';
-//             std::cout << "build labeling:\n";
-//             for (auto& atomicFormula : atomicFormulas) {
-//                 std::cout << atomicFormula;
-//                 auto label = atomicFormula->toString();
-//                 labeling.addLabel(label);
-//
-//                 for (auto statePair : markings) {
-//                     auto marking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, statePair.first);
-//                     for (auto& place : gspn.getPlaces()) {
-//                         auto variable = expressionManager->getVariable(place.getName());
-//                         expressionEvaluator.setIntegerValue(variable, marking.getNumberOfTokensAt(place.getID()));
-//                     }
-//                     bool hold = expressionEvaluator.asBool(atomicFormula->getExpression());
-//                     if (hold) {
-//                         labeling.addLabelToState(label, statePair.second);
-//                     }
-//                 }
-//
-//             }
-//
-//             //auto labeling = getStateLabeling();
-//
-//             return storm::models::sparse::MarkovAutomaton<double>(matrix, labeling, markovianStates, exitRates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         const& partitions, storm::gspn::Marking const& currentMarking) {
-//             for (auto& partition : partitions) {
-//                 std::cout << "\tnew partition:\n";
-//                 auto accWeight = getAccumulatedWeight(partition);
-//                 std::cout << "\t\tacc. weight: " << accWeight << '\n';
-//
-//                 std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> weights;
-//                 for (auto& trans : partition) {
-//                     std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                     auto newMarking = trans.fire(currentMarking);
-//                     std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                     findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                     auto it = weights.find(markings.getValue(*newMarking.getBitVector()));
-//                     double currentWeight = 0;
-//                     if (it != weights.end()) {
-//                         currentWeight = weights.at(markings.getValue(*newMarking.getBitVector()));
-//                     }
-//                     currentWeight += trans.getWeight() / accWeight;
-//                     weights[markings.getValue(*newMarking.getBitVector())] = currentWeight;
-//                 }
-//
-//                 addValuesToBuilder(weights);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const&
-//         enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate) {
-//             std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> rates;
-//             for (auto& trans : enabledTimedTransitions) {
-//                 std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                 auto newMarking = trans.fire(currentMarking);
-//                 std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                 findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                 auto it = rates.find(markings.getValue(*newMarking.getBitVector()));
-//                 double currentWeightRate = 0;
-//                 if (it != rates.end()) {
-//                     currentWeightRate = rates.at(markings.getValue(*newMarking.getBitVector()));
-//                 }
-//                 currentWeightRate += trans.getRate() / accRate;
-//                 rates[markings.getValue(*newMarking.getBitVector())] = currentWeightRate;
-//
-//             }
-//
-//             addValuesToBuilder(rates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addValuesToBuilder(std::map<uint_fast64_t , double,
-//         storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values) {
-//             for (auto& it : values) {
-//                 std::cout << "\t\tadd value \"" << it.second << "\" to " << getBitvector(it.first) << '\n';
-//                 builder.addNextValue(currentRowIndex, it.first, it.second);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         ExplicitGspnModelBuilder<ValueType>::partitonEnabledImmediateTransitions(
-//                 storm::gspn::Marking const& marking,
-//                 std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions) {
-//             decltype(partitonEnabledImmediateTransitions(marking, enabledImmediateTransitions)) result;
-//
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> weightedTransitions;
-//
-//             for (auto& trans : enabledImmediateTransitions) {
-//                 if (trans.noWeightAttached()) {
-//                     decltype(weightedTransitions) singleton;
-//                     singleton.push_back(trans);
-//                     result.push_back(singleton);
-//                 } else {
-//                     weightedTransitions.push_back(trans);
-//                 }
-//             }
-//
-//             if (weightedTransitions.size() != 0) {
-//                 result.push_back(weightedTransitions);
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const&
-//         vector) const {
-//             double result = 0;
-//
-//             for (auto &trans : vector) {
-//                 result += trans.getWeight();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::computeCapacities(storm::gspn::GSPN const& gspn) {
-//             uint_fast64_t sum = 0;
-//             for (auto& place : gspn.getPlaces()) {//TODO
-//                 numberOfBits[place.getID()] = 1;
-//                 sum += numberOfBits[place.getID()];
-//             }
-//
-//             // compute next multiple of 64
-//             uint_fast64_t rem = sum % 64;
-//             numberOfTotalBits = sum + 64 - rem;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledTimedTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getTimedTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledImmediateTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getImmediateTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector) {
-//             double result = 0;
-//             for (auto trans : vector) {
-//                 result += trans.getRate();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getBitvector(uint_fast64_t const& index) {
-//             for (auto it = markings.begin(); it != markings.end(); ++it) {
-//                 if (std::get<1>(*it) == index) {
-//                     return std::get<0>(*it);
-//                 }
-//             }
-//             return storm::storage::BitVector();
-//         }
-//
-//         template<typename ValueType>
-//         uint_fast64_t ExplicitGspnModelBuilder<ValueType>::findOrAddBitvectorToMarkings(storm::storage::BitVector const &bitvector) {
-//             auto index = markings.findOrAdd(bitvector, nextRowGroupIndex);
-//
-//             if (index == nextRowGroupIndex) {
-//                 // bitvector was not already in the map
-//                 ++nextRowGroupIndex;
-//                 // bitvector was also never in the todo list
-//                 todo.push_back(std::make_shared<storm::storage::BitVector>(bitvector));
-//             }
-//             return index;
-//         }
-//
-//         template<typename ValueType>
-//         storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::getStateLabeling() const {
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//
-//             std::map<uint_fast64_t , std::string> idToName;
-//             for (auto& place : gspn.getPlaces()) {
-//                 idToName[place.getID()] = place.getName();
-//                 labeling.addLabel(place.getName());
-//             }
-//
-//             auto it = markings.begin();
-//             for ( ; it != markings.end() ; ++it) {
-//                 auto bitvector = std::get<0>(*it);
-//                 storm::gspn::Marking marking(gspn.getNumberOfPlaces(), numberOfBits, bitvector);
-//                 for (auto i = 0; i < marking.getNumberOfPlaces(); i++) {
-//                     if (marking.getNumberOfTokensAt(i) > 0) {
-//                         std::cout << i << '\n';
-//                         labeling.addLabelToState(idToName.at(i), i);
-//                     }
-//                 }
-//             }
-//
-//             return labeling;
-//         }
-//
-//         template class ExplicitGspnModelBuilder<double>;
-//     }
-// }
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+
+#include <boost/optional.hpp>
+
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/InvalidModelException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+// Number of bits used to store the tokens of places without capacity.
+uint64_t const BITS_FOR_UNBOUNDED_PLACES = 32;
+
+template<typename ValueType>
+ExplicitGspnModelBuilder<ValueType>::ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, bool eliminateVanishingMarkings)
+    : gspn(gspn),
+      eliminateVanishingMarkings(eliminateVanishingMarkings && gspn.getNumberOfTimedTransitions() > 0),
+      numberOfImmediateTransitions(gspn.getNumberOfImmediateTransitions()),
+      markingToIndex(64),
+      eliminatedMarkings(64) {
+    // Compute the bit layout of markings
+    uint64_t offset = 0;
+    for (auto const& place : gspn.getPlaces()) {
+        STORM_LOG_ASSERT(place.getID() == placeOffsets.size(), "Place ids do not coincide with their position.");
+        uint64_t bits = BITS_FOR_UNBOUNDED_PLACES;
+        uint64_t maximum = (1ull << BITS_FOR_UNBOUNDED_PLACES) - 1;
+        if (place.hasRestrictedCapacity()) {
+            maximum = place.getCapacity();
+            bits = 1;
+            while ((1ull << bits) <= maximum) {
+                ++bits;
+            }
+        }
+        STORM_LOG_THROW(place.getNumberOfInitialTokens() <= maximum, storm::exceptions::WrongFormatException,
+                        "The initial number of tokens in place '" << place.getName() << "' exceeds its capacity.");
+        placeOffsets.push_back(offset);
+        placeBits.push_back(bits);
+        maxTokens.push_back(maximum);
+        offset += bits;
+    }
+    // Markings are stored in buckets of 64 bits
+    bitsPerMarking = std::max<uint64_t>(64, ((offset + 63) / 64) * 64);
+
+    // Gather the arcs of all transitions
+    auto addTransition = [this](storm::gspn::Transition const& transition, ValueType const& value, uint64_t numberOfServers) {
+        TransitionInformation information;
+        information.name = transition.getName();
+        information.value = value;
+        information.numberOfServers = numberOfServers;
+        std::map<uint64_t, int64_t> changes;
+        for (auto const& input : transition.getInputPlaces()) {
+            information.inputs.emplace_back(input.first, input.second);
+            changes[input.first] -= static_cast<int64_t>(input.second);
+        }
+        for (auto const& inhibition : transition.getInhibitionPlaces()) {
+            information.inhibitions.emplace_back(inhibition.first, inhibition.second);
+        }
+        for (auto const& output : transition.getOutputPlaces()) {
+            changes[output.first] += static_cast<int64_t>(output.second);
+        }
+        for (auto const& change : changes) {
+            if (change.second != 0) {
+                information.effects.push_back(change);
+            }
+        }
+        transitions.push_back(std::move(information));
+    };
+    for (auto const& transition : gspn.getImmediateTransitions()) {
+        STORM_LOG_WARN_COND(!transition.noWeightAttached(), "Immediate transition '" << transition.getName() << "' has no weight and is ignored.");
+        addTransition(transition, storm::utility::convertNumber<ValueType>(transition.getWeight()), 1);
+    }
+    for (auto const& transition : gspn.getTimedTransitions()) {
+        STORM_LOG_WARN_COND(!storm::utility::isZero(transition.getRate()), "Timed transition '" << transition.getName() << "' has rate zero and is ignored.");
+        uint64_t numberOfServers = transition.hasInfiniteServerSemantics() ? 0 : transition.getNumberOfServers();
+        STORM_LOG_THROW(numberOfServers > 0 || !transition.getInputPlaces().empty(), storm::exceptions::InvalidModelException,
+                        "Unclear semantics: Found a transition with infinite-server semantics and without input place.");
+        addTransition(transition, storm::utility::convertNumber<ValueType>(transition.getRate()), numberOfServers);
+    }
+
+    // Determine which transitions need to be re-evaluated after firing a transition
+    std::vector<std::vector<uint64_t>> dependentTransitions(gspn.getNumberOfPlaces());
+    for (uint64_t transition = 0; transition < transitions.size(); ++transition) {
+        for (auto const& input : transitions[transition].inputs) {
+            dependentTransitions[input.first].push_back(transition);
+        }
+        for (auto const& inhibition : transitions[transition].inhibitions) {
+            dependentTransitions[inhibition.first].push_back(transition);
+        }
+    }
+    for (auto& information : transitions) {
+        std::set<uint64_t> affected;
+        for (auto const& effect : information.effects) {
+            affected.insert(dependentTransitions[effect.first].begin(), dependentTransitions[effect.first].end());
+        }
+        information.affectedTransitions.assign(affected.begin(), affected.end());
+    }
+
+    partitionOfTransition.resize(numberOfImmediateTransitions, std::numeric_limits<uint64_t>::max());
+    for (uint64_t partition = 0; partition < gspn.getPartitions().size(); ++partition) {
+        for (auto const& transition : gspn.getPartitions()[partition].transitions) {
+            partitionOfTransition[transition] = partition;
+        }
+    }
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::addLabel(std::string const& name, storm::expressions::Expression const& expression) {
+    if (!evaluator) {
+        auto const& manager = *gspn.getExpressionManager();
+        for (auto const& place : gspn.getPlaces()) {
+            placeVariables.push_back(manager.getVariable(place.getName()));
+        }
+        evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(manager);
+    }
+    labels.emplace_back(name, expression);
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::getNumberOfTokens(storm::storage::BitVector const& marking, uint64_t place) const {
+    return marking.getAsInt(placeOffsets[place], placeBits[place]);
+}
+
+template<typename ValueType>
+bool ExplicitGspnModelBuilder<ValueType>::isEnabled(storm::storage::BitVector const& marking, uint64_t transition) const {
+    auto const& information = transitions[transition];
+    for (auto const& input : information.inputs) {
+        if (getNumberOfTokens(marking, input.first) < input.second) {
+            return false;
+        }
+    }
+    for (auto const& inhibition : information.inhibitions) {
+        if (getNumberOfTokens(marking, inhibition.first) >= inhibition.second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::computeEnabledTransitions(storm::storage::BitVector const& marking) const {
+    storm::storage::BitVector result(transitions.size());
+    for (uint64_t transition = 0; transition < transitions.size(); ++transition) {
+        if (isEnabled(marking, transition)) {
+            result.set(transition);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> ExplicitGspnModelBuilder<ValueType>::fire(
+    storm::storage::BitVector const& marking, storm::storage::BitVector const& enabledTransitions, uint64_t transition) const {
+    STORM_LOG_ASSERT(isEnabled(marking, transition), "Transition " << transitions[transition].name << " is not enabled.");
+    auto const& information = transitions[transition];
+    storm::storage::BitVector successor(marking);
+    for (auto const& effect : information.effects) {
+        int64_t tokens = static_cast<int64_t>(getNumberOfTokens(marking, effect.first)) + effect.second;
+        STORM_LOG_ASSERT(tokens >= 0, "Negative number of tokens.");
+        STORM_LOG_THROW(static_cast<uint64_t>(tokens) <= maxTokens[effect.first], storm::exceptions::WrongFormatException,
+                        "Firing transition '" << information.name << "' leads to " << tokens << " tokens in place '"
+                                              << gspn.getPlace(effect.first)->getName() << "' which exceeds its capacity of " << maxTokens[effect.first]
+                                              << ".");
+        successor.setFromInt(placeOffsets[effect.first], placeBits[effect.first], tokens);
+    }
+
+    // Only the transitions depending on changed places need to be re-evaluated
+    storm::storage::BitVector successorEnabledTransitions(enabledTransitions);
+    for (auto const& affected : information.affectedTransitions) {
+        successorEnabledTransitions.set(affected, isEnabled(successor, affected));
+    }
+    STORM_LOG_ASSERT(successorEnabledTransitions == computeEnabledTransitions(successor), "Enabled transitions were not updated correctly.");
+    return std::make_pair(std::move(successor), std::move(successorEnabledTransitions));
+}
+
+template<typename ValueType>
+std::vector<std::vector<std::pair<uint64_t, ValueType>>> ExplicitGspnModelBuilder<ValueType>::getImmediateChoices(
+    storm::storage::BitVector const& enabledTransitions) const {
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> choices;
+    auto const& partitions = gspn.getPartitions();
+
+    // Determine the highest priority of an enabled immediate transition
+    bool foundEnabled = false;
+    uint64_t highestPriority = 0;
+    for (auto transition : enabledTransitions) {
+        if (transition >= numberOfImmediateTransitions) {
+            break;
+        }
+        if (storm::utility::isZero(transitions[transition].value) || partitionOfTransition[transition] >= partitions.size()) {
+            continue;
+        }
+        uint64_t priority = partitions[partitionOfTransition[transition]].priority;
+        if (!foundEnabled || priority > highestPriority) {
+            highestPriority = priority;
+            foundEnabled = true;
+        }
+    }
+    if (!foundEnabled) {
+        return choices;
+    }
+
+    // Each enabled partition with the highest priority yields one choice
+    for (auto const& partition : partitions) {
+        if (partition.priority != highestPriority) {
+            continue;
+        }
+        std::vector<std::pair<uint64_t, ValueType>> choice;
+        ValueType totalWeight = storm::utility::zero<ValueType>();
+        for (auto const& transition : partition.transitions) {
+            if (enabledTransitions.get(transition) && !storm::utility::isZero(transitions[transition].value)) {
+                choice.emplace_back(transition, transitions[transition].value);
+                totalWeight += transitions[transition].value;
+            }
+        }
+        if (!choice.empty()) {
+            for (auto& entry : choice) {
+                entry.second /= totalWeight;
+            }
+            choices.push_back(std::move(choice));
+        }
+    }
+    return choices;
+}
+
+template<typename ValueType>
+ValueType ExplicitGspnModelBuilder<ValueType>::getRate(storm::storage::BitVector const& marking, uint64_t transition) const {
+    auto const& information = transitions[transition];
+    if (information.numberOfServers == 1) {
+        return information.value;
+    }
+    // The rate is multiplied with the enabling degree
+    uint64_t enablingDegree = information.numberOfServers == 0 ? std::numeric_limits<uint64_t>::max() : information.numberOfServers;
+    for (auto const& input : information.inputs) {
+        enablingDegree = std::min(enablingDegree, getNumberOfTokens(marking, input.first) / input.second);
+    }
+    return information.value * storm::utility::convertNumber<ValueType>(enablingDegree);
+}
+
+template<typename ValueType>
+storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getLabels(storm::storage::BitVector const& marking) {
+    storm::storage::BitVector result(labels.size());
+    if (labels.empty()) {
+        return result;
+    }
+    for (uint64_t place = 0; place < placeVariables.size(); ++place) {
+        evaluator->setIntegerValue(placeVariables[place], getNumberOfTokens(marking, place));
+    }
+    for (uint64_t label = 0; label < labels.size(); ++label) {
+        if (evaluator->asBool(labels[label].second)) {
+            result.set(label);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::computeLabelAffectingTransitions() {
+    labelAffectingTransitions = storm::storage::BitVector(transitions.size());
+    if (labels.empty()) {
+        return;
+    }
+    std::map<storm::expressions::Variable, uint64_t> variableToPlace;
+    for (uint64_t place = 0; place < placeVariables.size(); ++place) {
+        variableToPlace.emplace(placeVariables[place], place);
+    }
+    storm::storage::BitVector labelPlaces(placeVariables.size());
+    for (auto const& label : labels) {
+        for (auto const& variable : label.second.getVariables()) {
+            auto placeIt = variableToPlace.find(variable);
+            if (placeIt != variableToPlace.end()) {
+                labelPlaces.set(placeIt->second);
+            }
+        }
+    }
+    for (uint64_t transition = 0; transition < transitions.size(); ++transition) {
+        for (auto const& effect : transitions[transition].effects) {
+            if (labelPlaces.get(effect.first)) {
+                labelAffectingTransitions.set(transition);
+                break;
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+bool ExplicitGspnModelBuilder<ValueType>::startElimination(storm::storage::BitVector const& marking, storm::storage::BitVector const& enabledTransitions,
+                                                           EliminationFrame& frame) {
+    auto choices = getImmediateChoices(enabledTransitions);
+    if (choices.size() != 1) {
+        return false;
+    }
+    // The marking is vanishing and has no non-determinism.
+    // It is only eliminated if the marking and all its successors have the same labels.
+    // Labels are only evaluated for successors reached via transitions which change the tokens of places occurring in labels.
+    boost::optional<storm::storage::BitVector> markingLabels;
+    frame.successors.clear();
+    frame.probabilities.clear();
+    for (auto const& transitionProbability : choices.front()) {
+        frame.successors.push_back(fire(marking, enabledTransitions, transitionProbability.first));
+        frame.probabilities.push_back(transitionProbability.second);
+        if (labelAffectingTransitions.get(transitionProbability.first)) {
+            if (!markingLabels) {
+                markingLabels = getLabels(marking);
+            }
+            if (getLabels(frame.successors.back().first) != markingLabels.get()) {
+                return false;
+            }
+        }
+    }
+    frame.marking = marking;
+    frame.nextSuccessor = 0;
+    frame.distribution = storm::storage::Distribution<ValueType, uint64_t>();
+    return true;
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::addSuccessor(storm::storage::BitVector const& marking, storm::storage::BitVector const& enabledTransitions,
+                                                       ValueType const& value, storm::storage::Distribution<ValueType, uint64_t>& distribution) {
+    STORM_LOG_ASSERT(eliminationStack.empty(), "Elimination stack is not empty.");
+    auto addScaled = [](storm::storage::Distribution<ValueType, uint64_t> const& source, ValueType const& factor,
+                        storm::storage::Distribution<ValueType, uint64_t>& target) {
+        for (auto const& entry : source) {
+            target.addProbability(entry.first, entry.second * factor);
+        }
+    };
+
+    // Adds the successor to the target distribution if it is a state or was eliminated before. Otherwise, its elimination is started if possible.
+    EliminationFrame frame;
+    auto processSuccessor = [&](storm::storage::BitVector const& successor, storm::storage::BitVector const& successorEnabledTransitions,
+                                ValueType const& successorValue, storm::storage::Distribution<ValueType, uint64_t>& target) {
+        if (eliminateVanishingMarkings && !markingToIndex.contains(successor)) {
+            if (eliminatedMarkings.contains(successor)) {
+                addScaled(eliminatedDistributions[eliminatedMarkings.getValue(successor)], successorValue, target);
+                return false;
+            }
+            // Markings on the stack are kept to break cycles of vanishing markings
+            if (markingsOnEliminationStack.count(successor) == 0 && startElimination(successor, successorEnabledTransitions, frame)) {
+                return true;
+            }
+        }
+        target.addProbability(getOrAddStateIndex(successor, successorEnabledTransitions), successorValue);
+        return false;
+    };
+    auto pushFrame = [&]() {
+        markingsOnEliminationStack.insert(frame.marking);
+        eliminationStack.push_back(std::move(frame));
+        frame = EliminationFrame();
+    };
+
+    if (processSuccessor(marking, enabledTransitions, value, distribution)) {
+        pushFrame();
+    }
+    while (!eliminationStack.empty()) {
+        EliminationFrame& current = eliminationStack.back();
+        if (current.nextSuccessor < current.successors.size()) {
+            uint64_t index = current.nextSuccessor++;
+            if (processSuccessor(current.successors[index].first, current.successors[index].second, current.probabilities[index], current.distribution)) {
+                pushFrame();
+            }
+        } else {
+            // All successors are processed: memoise the distribution of the eliminated marking and add it to the predecessor
+            EliminationFrame finished = std::move(current);
+            eliminationStack.pop_back();
+            markingsOnEliminationStack.erase(finished.marking);
+            if (eliminationStack.empty()) {
+                addScaled(finished.distribution, value, distribution);
+            } else {
+                EliminationFrame& predecessor = eliminationStack.back();
+                addScaled(finished.distribution, predecessor.probabilities[predecessor.nextSuccessor - 1], predecessor.distribution);
+            }
+            eliminatedMarkings.findOrAdd(finished.marking, eliminatedDistributions.size());
+            eliminatedDistributions.push_back(std::move(finished.distribution));
+        }
+    }
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::getOrAddStateIndex(storm::storage::BitVector const& marking,
+                                                                 storm::storage::BitVector const& enabledTransitions) {
+    uint64_t newIndex = markingToIndex.size();
+    uint64_t index = markingToIndex.findOrAdd(marking, newIndex);
+    if (index == newIndex) {
+        // New marking
+        markingsToExplore.emplace_back(marking, enabledTransitions);
+    }
+    return index;
+}
+
+template<typename ValueType>
+storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getInitialMarking() const {
+    storm::storage::BitVector marking(bitsPerMarking);
+    for (auto const& place : gspn.getPlaces()) {
+        marking.setFromInt(placeOffsets[place.getID()], placeBits[place.getID()], place.getNumberOfInitialTokens());
+    }
+    return marking;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitGspnModelBuilder<ValueType>::build() {
+    markingToIndex = storm::storage::BitVectorHashMap<uint64_t>(bitsPerMarking);
+    markingsToExplore.clear();
+    eliminatedMarkings = storm::storage::BitVectorHashMap<uint64_t>(bitsPerMarking);
+    eliminatedDistributions.clear();
+    computeLabelAffectingTransitions();
+
+    storm::storage::BitVector initialMarking = getInitialMarking();
+    getOrAddStateIndex(initialMarking, computeEnabledTransitions(initialMarking));
+
+    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(0, 0, 0, false, true);
+    std::vector<uint_fast64_t> markovianStates;
+    std::vector<uint_fast64_t> deadlockStates;
+    uint64_t currentRow = 0;
+    uint64_t currentState = 0;
+    auto addRow = [&matrixBuilder, &currentRow](storm::storage::Distribution<ValueType, uint64_t> const& distribution) {
+        for (auto const& entry : distribution) {
+            matrixBuilder.addNextValue(currentRow, entry.first, entry.second);
+        }
+        ++currentRow;
+    };
+
+    // Markings are explored in the order of their state indices
+    while (!markingsToExplore.empty()) {
+        storm::storage::BitVector marking = std::move(markingsToExplore.front().first);
+        storm::storage::BitVector enabledTransitions = std::move(markingsToExplore.front().second);
+        markingsToExplore.pop_front();
+        matrixBuilder.newRowGroup(currentRow);
+
+        auto choices = getImmediateChoices(enabledTransitions);
+        if (!choices.empty()) {
+            // Vanishing marking
+            for (auto const& choice : choices) {
+                storm::storage::Distribution<ValueType, uint64_t> distribution;
+                for (auto const& transitionProbability : choice) {
+                    auto successor = fire(marking, enabledTransitions, transitionProbability.first);
+                    addSuccessor(successor.first, successor.second, transitionProbability.second, distribution);
+                }
+                addRow(distribution);
+            }
+        } else {
+            // Tangible marking
+            storm::storage::Distribution<ValueType, uint64_t> distribution;
+            for (uint64_t transition = enabledTransitions.getNextSetIndex(numberOfImmediateTransitions); transition < transitions.size();
+                 transition = enabledTransitions.getNextSetIndex(transition + 1)) {
+                if (storm::utility::isZero(transitions[transition].value)) {
+                    continue;
+                }
+                auto successor = fire(marking, enabledTransitions, transition);
+                addSuccessor(successor.first, successor.second, getRate(marking, transition), distribution);
+            }
+            if (distribution.size() == 0) {
+                // Deadlock marking gets a self-loop
+                deadlockStates.push_back(currentState);
+                distribution.addProbability(currentState, storm::utility::one<ValueType>());
+            }
+            addRow(distribution);
+            markovianStates.push_back(currentState);
+        }
+        ++currentState;
+
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration after " << currentState << " states.");
+        }
+    }
+    STORM_LOG_ASSERT(currentState == markingToIndex.size(), "Not all markings were explored.");
+
+    storm::storage::sparse::ModelComponents<ValueType> components(matrixBuilder.build(currentRow, currentState, currentState),
+                                                                  buildStateLabeling(currentState, deadlockStates));
+    if (gspn.getNumberOfTimedTransitions() == 0) {
+        return std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(components));
+    }
+    components.rateTransitions = true;
+    components.markovianStates = storm::storage::BitVector(currentState, markovianStates);
+    auto ma = std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType>>(std::move(components));
+    if (ma->isConvertibleToCtmc()) {
+        return ma->convertToCtmc();
+    }
+    return ma;
+}
+
+template<typename ValueType>
+storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::buildStateLabeling(uint64_t numberOfStates,
+                                                                                             std::vector<uint_fast64_t> const& deadlockStates) {
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    storm::storage::BitVector initialStates(numberOfStates);
+    initialStates.set(0);
+    labeling.addLabel("init", std::move(initialStates));
+    labeling.addLabel("deadlock", storm::storage::BitVector(numberOfStates, deadlockStates));
+
+    std::vector<storm::storage::BitVector> labelStates(labels.size(), storm::storage::BitVector(numberOfStates));
+    if (!labels.empty()) {
+        for (auto const& markingIndexPair : markingToIndex) {
+            for (auto label : getLabels(markingIndexPair.first)) {
+                labelStates[label].set(markingIndexPair.second);
+            }
+        }
+    }
+    for (uint64_t label = 0; label < labels.size(); ++label) {
+        labeling.addLabel(labels[label].first, std::move(labelStates[label]));
+    }
+    return labeling;
+}
+
+template class ExplicitGspnModelBuilder<double>;
+
+}  // namespace builder
+}  // namespace storm
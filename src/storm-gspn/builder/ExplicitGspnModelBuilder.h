@@ -1,175 +1,201 @@
-// #ifndef STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-// #define STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//
-// #include <string>
-//
-// #include "storm/models/sparse/MarkovAutomaton.h"
-// #include "storm/models/sparse/StandardRewardModel.h"
-// #include "storm/storage/BitVector.h"
-// #include "storm/storage/BitVectorHashMap.h"
-// #include "storm/storage/gspn/GSPN.h"
-// #include "storm/storage/gspn/ImmediateTransition.h"
-// #include "storm/storage/gspn/TimedTransition.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         /*!
-//          * This class provides the facilities for building an markov automaton.
-//          */
-//         template<typename ValueType=double>
-//         class ExplicitGspnModelBuilder {
-//         public:
-//
-//             /*!
-//              * Builds an MarkovAutomaton from the given GSPN.
-//              *
-//              * @param gspn The gspn whose semantic is covered by the MarkovAutomaton
-//              * @return The resulting MarkovAutomaton
-//              */
-//             storm::models::sparse::MarkovAutomaton<ValueType> translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula);
-//         private:
-//
-//             /*!
-//              * Add for each partition a new row in the probability matrix.
-//              *
-//              * @param partitions The partitioned immediate transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              */
-//             void addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions,
-//             storm::gspn::Marking const& currentMarking);
-//
-//
-//             /*!
-//              * Add row for a markovian state.
-//              *
-//              * @param enabledTimedTransitions List of enabled timed transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              * @param accRate The sum of all rates of the enabled timed transisitons
-//              */
-//             void addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions,
-//             storm::gspn::Marking const& currentMarking, double const& accRate);
-//
-//             /*!
-//              * Struct for comparing unsigned integer for maps
-//              */
-//             struct cmpByIndex {
-//                 bool operator()(const uint_fast64_t &a, const uint_fast64_t &b) const {
-//                     return a < b;
-//                 }
-//             };
-//
-//             /*!
-//              * This method insert the values from a map into the matrix
-//              *
-//              * @param values The values which are inserted
-//              */
-//             void addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values);
-//
-//
-//             /*!
-//              * This method partitions all enabled immediate transitions w.r.t. a marking.
-//              * All enabled weighted immediate transitions are in one vector. Between these transitions
-//              * is chosen probabilistically by the weights.
-//              *
-//              * All other enabled non-weighted immediate transitions are in an singleton vector.
-//              * Between different vectors is chosen non-deterministically.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @param enabledImmediateTransistions A vector of enabled immediate transitions.
-//              * @return The vector of vectors which is described above.
-//              */
-//             std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> partitonEnabledImmediateTransitions(storm::gspn::Marking
-//             const& marking, std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions);
-//
-//             /*!
-//              * Computes the accumulated weight of immediate transisions which are stored in a list.
-//              *
-//              * @param vector List of immediate transisitions.
-//              */
-//             double getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const;
-//
-//             /*!
-//              * Compute the upper bound for the number of tokens in each place.
-//              * Also computes the number of bits which are used to store a marking.
-//              *
-//              * @param gspn The corresponding gspn.
-//              */
-//             void computeCapacities(storm::gspn::GSPN const& gspn);
-//
-//             /*!
-//              * Returns the vector of enabled timed transition with the highest priority.
-//              *
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled timed transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> getEnabledTimedTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Returns the vector of active immediate transition with the highest priority.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled immediate transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> getEnabledImmediateTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Computes the accumulated rate of a vector of timed transitions.
-//              *
-//              * @param vector The vector of timed transitions.
-//              * @return The accumulated rate.
-//              */
-//             double getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector);
-//
-//             // is only needed for debugging purposes
-//             // since markings is injective, we can determine the bitvector
-//             storm::storage::BitVector getBitvector(uint_fast64_t const& index);
-//
-//             /*!
-//              * Adds the bitvector to the marking-map.
-//              * If the bitvector corresponds to a new marking the bitvector is added to the todo list.
-//              *
-//              * @return The rowGroup index for the bitvector.
-//              */
-//             uint_fast64_t findOrAddBitvectorToMarkings(storm::storage::BitVector const& bitvector);
-//
-//             /*!
-//              * Computes the state labeling and returns it.
-//              * Every state is labeled with its name.
-//              *
-//              * @return The computed state labeling.
-//              */
-//             storm::models::sparse::StateLabeling getStateLabeling() const;
-//
-//
-//             // contains the number of bits which are used the store the number of tokens at each place
-//             std::map<uint_fast64_t, uint_fast64_t> numberOfBits;
-//
-//             // contains the number of bits used to create markings
-//             uint_fast64_t numberOfTotalBits;
-//
-//             // maps bitvectors (markings w.r.t. the capacity) to their rowgroup
-//             storm::storage::BitVectorHashMap<uint_fast64_t> markings = storm::storage::BitVectorHashMap<uint_fast64_t>(64, 1);
-//
-//             // a list of markings for which the outgoing edges need to be computed
-//             std::deque<std::shared_ptr<storm::storage::BitVector>> todo;
-//
-//             //the gspn which is transformed
-//             storm::gspn::GSPN gspn;
-//
-//             // the next index for a new rowgroup
-//             uint_fast64_t nextRowGroupIndex = 0;
-//
-//             // builder object which is used to create the probability matrix
-//             storm::storage::SparseMatrixBuilder<double> builder;
-//
-//             // contains the current row index during the computation
-//             uint_fast64_t currentRowIndex;
-//         };
-//     }
-// }
-//
-// #endif //STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/Distribution.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the explicit model of a GSPN directly from its places and transitions, i.e., without the translation to JANI.
+ * Markings are stored bit-packed and the set of enabled transitions is updated incrementally when a transition fires.
+ * The semantics coincides with the one of the JANI translation (see JaniGSPNBuilder):
+ * - only the enabled partitions of immediate transitions with the highest priority yield (non-deterministic) choices,
+ *   within a partition the successor is chosen according to the weights of the enabled transitions,
+ * - timed transitions are only considered if no immediate transition is enabled (maximal progress),
+ * - deadlock markings get a Markovian self-loop.
+ */
+template<typename ValueType = double>
+class ExplicitGspnModelBuilder {
+   public:
+    /*!
+     * Creates a builder for the given GSPN.
+     *
+     * @param gspn The GSPN.
+     * @param eliminateVanishingMarkings If set, vanishing markings with a single choice are eliminated on the fly as long as they have the same labels
+     * as their successors. This is only done if the GSPN contains timed transitions.
+     */
+    ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, bool eliminateVanishingMarkings = true);
+
+    /*!
+     * Adds a label to all markings satisfying the given expression over the place variables of the GSPN.
+     *
+     * @param name Name of the label.
+     * @param expression Boolean expression over the place variables.
+     */
+    void addLabel(std::string const& name, storm::expressions::Expression const& expression);
+
+    /*!
+     * Builds the model.
+     * If the GSPN contains no timed transitions, an MDP is built.
+     * Otherwise, a Markov automaton is built which is converted into a CTMC if all probabilistic states could be eliminated.
+     *
+     * @return The model.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build();
+
+   private:
+    /*!
+     * Information about a transition which is relevant for the exploration.
+     * Immediate transitions have the indices 0 to #immediate transitions-1, followed by the timed transitions.
+     */
+    struct TransitionInformation {
+        std::string name;
+        // Pairs of place and multiplicity for all input arcs.
+        std::vector<std::pair<uint64_t, uint64_t>> inputs;
+        // Pairs of place and multiplicity for all inhibition arcs.
+        std::vector<std::pair<uint64_t, uint64_t>> inhibitions;
+        // Pairs of place and change of tokens for all places whose number of tokens is changed by firing.
+        std::vector<std::pair<uint64_t, int64_t>> effects;
+        // Transitions whose enabledness can change by firing this transition.
+        std::vector<uint64_t> affectedTransitions;
+        // Weight (for immediate transitions) or rate (for timed transitions).
+        ValueType value;
+        // Number of servers for timed transitions (0 means infinite server semantics).
+        uint64_t numberOfServers;
+    };
+
+    uint64_t getNumberOfTokens(storm::storage::BitVector const& marking, uint64_t place) const;
+
+    bool isEnabled(storm::storage::BitVector const& marking, uint64_t transition) const;
+
+    storm::storage::BitVector computeEnabledTransitions(storm::storage::BitVector const& marking) const;
+
+    /*!
+     * Fires the given transition.
+     *
+     * @param marking Marking in which the transition is enabled.
+     * @param enabledTransitions Enabled transitions in the marking.
+     * @param transition Transition.
+     * @return The successor marking together with its enabled transitions.
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> fire(storm::storage::BitVector const& marking,
+                                                                         storm::storage::BitVector const& enabledTransitions, uint64_t transition) const;
+
+    /*!
+     * Computes the choices of a vanishing marking.
+     * Each choice corresponds to an enabled partition of highest priority and is given as pairs of transitions and probabilities.
+     *
+     * @return The choices, empty if no immediate transition is enabled.
+     */
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> getImmediateChoices(storm::storage::BitVector const& enabledTransitions) const;
+
+    /*!
+     * Computes the rate of an enabled timed transition in the given marking (taking the server semantics into account).
+     */
+    ValueType getRate(storm::storage::BitVector const& marking, uint64_t transition) const;
+
+    /*!
+     * Evaluates all labels on the given marking.
+     */
+    storm::storage::BitVector getLabels(storm::storage::BitVector const& marking);
+
+    /*!
+     * Determines the transitions whose firing can change the labels of a marking, i.e., which change the tokens of a place occurring in a label.
+     */
+    void computeLabelAffectingTransitions();
+
+    /*!
+     * A vanishing marking which is currently eliminated.
+     */
+    struct EliminationFrame {
+        storm::storage::BitVector marking;
+        // The successor markings (together with their enabled transitions) and the probabilities to reach them.
+        std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> successors;
+        std::vector<ValueType> probabilities;
+        // The successor which is processed next.
+        uint64_t nextSuccessor = 0;
+        // The distribution over state indices reached from the marking with probability one.
+        storm::storage::Distribution<ValueType, uint64_t> distribution;
+    };
+
+    /*!
+     * Checks whether the given marking can be eliminated, i.e., whether it is vanishing, has a single choice and the same labels as its successors.
+     * If so, the frame is filled with the marking and its successors.
+     *
+     * @return True iff the marking can be eliminated.
+     */
+    bool startElimination(storm::storage::BitVector const& marking, storm::storage::BitVector const& enabledTransitions, EliminationFrame& frame);
+
+    /*!
+     * Adds the given marking reached with the given value to the distribution.
+     * If possible, the marking is eliminated and its successors are added instead.
+     * The elimination is done iteratively and the distributions of eliminated markings are memoised.
+     *
+     * @param marking Marking.
+     * @param enabledTransitions Enabled transitions in the marking.
+     * @param value Probability or rate with which the marking is reached.
+     * @param distribution Distribution over state indices.
+     */
+    void addSuccessor(storm::storage::BitVector const& marking, storm::storage::BitVector const& enabledTransitions, ValueType const& value,
+                      storm::storage::Distribution<ValueType, uint64_t>& distribution);
+
+    /*!
+     * Retrieves the state index of the given marking. If the marking is new, it is added to the markings to explore.
+     */
+    uint64_t getOrAddStateIndex(storm::storage::BitVector const& marking, storm::storage::BitVector const& enabledTransitions);
+
+    storm::storage::BitVector getInitialMarking() const;
+
+    storm::models::sparse::StateLabeling buildStateLabeling(uint64_t numberOfStates, std::vector<uint_fast64_t> const& deadlockStates);
+
+    storm::gspn::GSPN const& gspn;
+    bool eliminateVanishingMarkings;
+
+    // Bit offset and number of bits for each place.
+    std::vector<uint64_t> placeOffsets;
+    std::vector<uint64_t> placeBits;
+    // Maximal number of tokens for each place.
+    std::vector<uint64_t> maxTokens;
+    // Number of bits per marking (multiple of 64).
+    uint64_t bitsPerMarking;
+
+    std::vector<TransitionInformation> transitions;
+    uint64_t numberOfImmediateTransitions;
+    // The partition of each immediate transition.
+    std::vector<uint64_t> partitionOfTransition;
+
+    // Labels given by expressions over the place variables.
+    std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
+    std::vector<storm::expressions::Variable> placeVariables;
+    std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>> evaluator;
+    // Transitions whose firing can change the labels.
+    storm::storage::BitVector labelAffectingTransitions;
+
+    // Maps markings to their state index.
+    storm::storage::BitVectorHashMap<uint64_t> markingToIndex;
+    // Markings (together with their enabled transitions) which still need to be explored.
+    std::deque<std::pair<storm::storage::BitVector, storm::storage::BitVector>> markingsToExplore;
+
+    // Maps eliminated markings to the index of their distribution over state indices.
+    storm::storage::BitVectorHashMap<uint64_t> eliminatedMarkings;
+    std::vector<storm::storage::Distribution<ValueType, uint64_t>> eliminatedDistributions;
+    // The markings which are currently eliminated. They are kept as states when reached again to break cycles of vanishing markings.
+    std::vector<EliminationFrame> eliminationStack;
+    std::unordered_set<storm::storage::BitVector> markingsOnEliminationStack;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -21,6 +21,8 @@ const std::string GSPNSettings::capacitiesFileOptionShortName = "capacities";
 const std::string GSPNSettings::capacityOptionName = "capacity";
 const std::string GSPNSettings::constantsOptionName = "constants";
 const std::string GSPNSettings::constantsOptionShortName = "const";
+const std::string GSPNSettings::explicitBuildOptionName = "explicitbuild";
+const std::string GSPNSettings::keepVanishingOptionName = "keepvanishing";
 
 GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, gspnFileOptionName, false, "Parses the GSPN.")
@@ -47,6 +49,14 @@ GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("")
                                          .build())
                         .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, explicitBuildOptionName, false,
+                                       "Builds the explicit model of the GSPN directly (without the translation to JANI) and checks the given properties.")
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, keepVanishingOptionName, false,
+                                                   "Keeps all vanishing markings when building the explicit model of the GSPN.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool GSPNSettings::isGspnFileSet() const {
@@ -81,6 +91,14 @@ std::string GSPNSettings::getConstantDefinitionString() const {
     return this->getOption(constantsOptionName).getArgumentByName("values").getValueAsString();
 }
 
+bool GSPNSettings::isExplicitBuildSet() const {
+    return this->getOption(explicitBuildOptionName).getHasOptionBeenSet();
+}
+
+bool GSPNSettings::isKeepVanishingSet() const {
+    return this->getOption(keepVanishingOptionName).getHasOptionBeenSet();
+}
+
 void GSPNSettings::finalize() {}
 
 bool GSPNSettings::check() const {
@@ -94,6 +112,11 @@ bool GSPNSettings::check() const {
         STORM_LOG_ERROR("Conflicting settings: Capacity file AND capacity was set.");
         return false;
     }
+
+    if (isKeepVanishingSet() && !isExplicitBuildSet()) {
+        STORM_LOG_ERROR("Vanishing markings can only be kept when building the explicit model.");
+        return false;
+    }
     return true;
 }
 }  // namespace modules
@@ -53,6 +53,16 @@ class GSPNSettings : public ModuleSettings {
      */
     std::string getConstantDefinitionString() const;
 
+    /*!
+     * Retrieves whether the GSPN is to be analysed by building its explicit model directly, i.e., without the translation to JANI.
+     */
+    bool isExplicitBuildSet() const;
+
+    /*!
+     * Retrieves whether vanishing markings are to be kept when building the explicit model.
+     */
+    bool isKeepVanishingSet() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -66,6 +76,8 @@ class GSPNSettings : public ModuleSettings {
     static const std::string capacityOptionName;
     static const std::string constantsOptionName;
     static const std::string constantsOptionShortName;
+    static const std::string explicitBuildOptionName;
+    static const std::string keepVanishingOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -1,5 +1,7 @@
 
 #pragma once
+#include <functional>
+
 #include "storm-cli-utilities/cli.h"
 #include "storm-cli-utilities/model-handling.h"
 
@@ -11,6 +13,7 @@
 
 #include "storm-pars/derivative/GradientDescentInstantiationSearcher.h"
 #include "storm-pars/derivative/SparseDerivativeInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseBatchInstantiationModelChecker.h"
 #include "storm-pars/modelchecker/instantiation/SparseCtmcInstantiationModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseDtmcParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
@@ -72,8 +75,61 @@ struct SampleInformation {
         cartesianProducts;
     bool graphPreserving;
     bool exact;
+    // The number of samples that are checked at once (if supported).
+    uint64_t batchSize = 1;
 };
 
+/*!
+ * Calls the given function for every sample point, i.e., for every element of every cartesian product of the given samples.
+ */
+template<typename ValueType>
+void forEachSamplePoint(SampleInformation<ValueType> const& samples,
+                        std::function<void(storm::utility::parametric::Valuation<ValueType> const&)> const& function) {
+    storm::utility::parametric::Valuation<ValueType> valuation;
+
+    std::vector<typename storm::utility::parametric::VariableType<ValueType>::type> parameters;
+    std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
+    std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
+
+    for (auto const& product : samples.cartesianProducts) {
+        parameters.clear();
+        iterators.clear();
+        iteratorEnds.clear();
+
+        for (auto const& entry : product) {
+            parameters.push_back(entry.first);
+            iterators.push_back(entry.second.cbegin());
+            iteratorEnds.push_back(entry.second.cend());
+        }
+
+        bool done = false;
+        while (!done) {
+            // Read off valuation.
+            for (uint64_t i = 0; i < parameters.size(); ++i) {
+                valuation[parameters[i]] = *iterators[i];
+            }
+
+            function(valuation);
+
+            for (uint64_t i = 0; i < parameters.size(); ++i) {
+                ++iterators[i];
+                if (iterators[i] == iteratorEnds[i]) {
+                    // Reset iterator and proceed to move next iterator.
+                    iterators[i] = product.at(parameters[i]).cbegin();
+
+                    // If the last iterator was removed, we are done.
+                    if (i == parameters.size() - 1) {
+                        done = true;
+                    }
+                } else {
+                    // If an iterator was moved but not reset, we have another valuation to check.
+                    break;
+                }
+            }
+        }
+    }
+}
+
 template<template<typename, typename> class ModelCheckerType, typename ModelType, typename ValueType, typename SolveValueType = double>
 void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
     // When samples are provided, we create an instantiation model checker.
@@ -85,56 +141,58 @@ void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput c
         modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
         modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
 
-        storm::utility::parametric::Valuation<ValueType> valuation;
-
-        std::vector<typename storm::utility::parametric::VariableType<ValueType>::type> parameters;
-        std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
-        std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
-
         storm::utility::Stopwatch watch(true);
-        for (auto const& product : samples.cartesianProducts) {
-            parameters.clear();
-            iterators.clear();
-            iteratorEnds.clear();
-
-            for (auto const& entry : product) {
-                parameters.push_back(entry.first);
-                iterators.push_back(entry.second.cbegin());
-                iteratorEnds.push_back(entry.second.cend());
+        forEachSamplePoint<ValueType>(samples, [&](storm::utility::parametric::Valuation<ValueType> const& valuation) {
+            storm::utility::Stopwatch valuationWatch(true);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
+            valuationWatch.stop();
+
+            if (result) {
+                result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
             }
+            printInitialStatesResult<ValueType>(result, &valuationWatch, &valuation);
+        });
 
-            bool done = false;
-            while (!done) {
-                // Read off valuation.
-                for (uint64_t i = 0; i < parameters.size(); ++i) {
-                    valuation[parameters[i]] = *iterators[i];
-                }
+        watch.stop();
+        STORM_PRINT_AND_LOG("Overall time for sampling all instances: " << watch << "\n\n");
+    }
+}
 
-                storm::utility::Stopwatch valuationWatch(true);
-                std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
-                valuationWatch.stop();
+template<typename ModelType, typename ValueType>
+void verifyPropertiesAtSamplePointsInBatches(ModelType const& model, cli::SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
+    storm::modelchecker::SparseBatchInstantiationModelChecker<ModelType, double> modelchecker(model);
 
-                if (result) {
-                    result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
-                }
-                printInitialStatesResult<ValueType>(result, &valuationWatch, &valuation);
-
-                for (uint64_t i = 0; i < parameters.size(); ++i) {
-                    ++iterators[i];
-                    if (iterators[i] == iteratorEnds[i]) {
-                        // Reset iterator and proceed to move next iterator.
-                        iterators[i] = product.at(parameters[i]).cbegin();
-
-                        // If the last iterator was removed, we are done.
-                        if (i == parameters.size() - 1) {
-                            done = true;
-                        }
-                    } else {
-                        // If an iterator was moved but not reset, we have another valuation to check.
-                        break;
-                    }
+    for (auto const& property : input.properties) {
+        storm::cli::printModelCheckingProperty(property);
+
+        modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
+        modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
+
+        std::vector<storm::utility::parametric::Valuation<ValueType>> batch;
+        auto checkBatch = [&]() {
+            // The time is reported for the whole batch.
+            storm::utility::Stopwatch batchWatch(true);
+            auto results = modelchecker.checkBatch(Environment(), batch);
+            batchWatch.stop();
+
+            for (uint64_t i = 0; i < batch.size(); ++i) {
+                if (results[i]) {
+                    results[i]->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
                 }
+                printInitialStatesResult<ValueType>(results[i], &batchWatch, &batch[i]);
             }
+            batch.clear();
+        };
+
+        storm::utility::Stopwatch watch(true);
+        forEachSamplePoint<ValueType>(samples, [&](storm::utility::parametric::Valuation<ValueType> const& valuation) {
+            batch.push_back(valuation);
+            if (batch.size() == samples.batchSize) {
+                checkBatch();
+            }
+        });
+        if (!batch.empty()) {
+            checkBatch();
         }
 
         watch.stop();
@@ -145,6 +203,18 @@ void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput c
 template<typename ValueType, typename SolveValueType = double>
 void verifyPropertiesAtSamplePointsWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, cli::SymbolicInput const& input,
                                                     SampleInformation<ValueType> const& samples) {
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value && std::is_same<SolveValueType, double>::value) {
+        if (samples.batchSize > 1 && model->isOfType(storm::models::ModelType::Dtmc)) {
+            verifyPropertiesAtSamplePointsInBatches(*model->template as<storm::models::sparse::Dtmc<ValueType>>(), input, samples);
+            return;
+        } else if (samples.batchSize > 1 && model->isOfType(storm::models::ModelType::Mdp)) {
+            verifyPropertiesAtSamplePointsInBatches(*model->template as<storm::models::sparse::Mdp<ValueType>>(), input, samples);
+            return;
+        }
+    }
+    STORM_LOG_WARN_COND(samples.batchSize <= 1,
+                        "Checking samples in batches is only supported for DTMCs and MDPs in non-exact mode. Samples are checked one by one.");
+
     if (model->isOfType(storm::models::ModelType::Dtmc)) {
         verifyPropertiesAtSamplePoints<storm::modelchecker::SparseDtmcInstantiationModelChecker, storm::models::sparse::Dtmc<ValueType>, ValueType,
                                        SolveValueType>(*model->template as<storm::models::sparse::Dtmc<ValueType>>(), input, samples);
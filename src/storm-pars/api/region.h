@@ -28,6 +28,7 @@
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/io/file.h"
 #include "storm/models/sparse/Model.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 
@@ -280,6 +281,7 @@ std::unique_ptr<storm::modelchecker::RegionCheckResult<ValueType>> checkRegionsW
  * @param allowModelSimplification
  * @param useMonotonicity
  * @param monThresh if given, determines at which depth to start using monotonicity
+ * @param numberOfWorkers the number of region model checkers that analyze regions concurrently. Zero means that the number is determined automatically.
  */
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(
@@ -287,10 +289,20 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> che
     storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine,
     boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none,
     storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true,
-    MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
+    MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0, uint64_t numberOfWorkers = 1) {
     Environment env;
     bool preconditionsValidated = false;
     auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting);
+    numberOfWorkers = storm::utility::parallel::resolveNumberOfThreads(numberOfWorkers, std::numeric_limits<uint64_t>::max());
+    if (numberOfWorkers > 1) {
+        // Each worker gets its own checker (and thus its own parameter lifter and solvers).
+        std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> workers;
+        for (uint64_t worker = 1; worker < numberOfWorkers; ++worker) {
+            workers.push_back(
+                initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting));
+        }
+        regionChecker->setRefinementWorkers(workers);
+    }
     return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
 }
 
@@ -1,6 +1,7 @@
 #include "storm-pars/derivative/GradientDescentInstantiationSearcher.h"
 #include <cmath>
 #include <cstdint>
+#include <limits>
 #include <random>
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 #include "storm/environment/Environment.h"
@@ -16,6 +17,7 @@
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace derivative {
@@ -373,36 +375,97 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
             STORM_LOG_WARN("Aborting Gradient Descent, returning non-optimal value.");
             break;
         }
+        if (currentSearchState != nullptr && currentSearchState->finished.load()) {
+            // Another trajectory has satisfied the bound.
+            break;
+        }
     }
     return currentValue;
 }
 
+template<typename FunctionType, typename ConstantType>
+void GradientDescentInstantiationSearcher<FunctionType, ConstantType>::setNumberOfTrajectories(uint64_t numberOfTrajectories) {
+    this->numberOfTrajectories = numberOfTrajectories;
+}
+
 template<typename FunctionType, typename ConstantType>
 std::pair<std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>, ConstantType>
 GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescent() {
     STORM_LOG_ASSERT(this->synthesisTask, "Call setup before calling gradientDescent");
-
-    resetDynamicValues();
-
     STORM_LOG_ASSERT(this->synthesisTask->isBoundSet(), "Task does not involve a bound.");
 
-    std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> bestInstantiation;
-    ConstantType bestValue;
+    SearchState state;
     switch (this->synthesisTask->getBound().comparisonType) {
         case logic::ComparisonType::Greater:
         case logic::ComparisonType::GreaterEqual:
-            bestValue = -utility::infinity<ConstantType>();
+            state.bestValue = -utility::infinity<ConstantType>();
             break;
         case logic::ComparisonType::Less:
         case logic::ComparisonType::LessEqual:
-            bestValue = utility::infinity<ConstantType>();
+            state.bestValue = utility::infinity<ConstantType>();
             break;
     }
 
+    uint64_t const trajectories = storm::utility::parallel::resolveNumberOfThreads(numberOfTrajectories, std::numeric_limits<uint64_t>::max());
     std::random_device device;
-    std::default_random_engine engine(device());
+    std::vector<uint64_t> seeds;
+    for (uint64_t trajectory = 0; trajectory < trajectories; ++trajectory) {
+        seeds.push_back(device());
+    }
+
+    if (trajectories == 1) {
+        searchFeasibleInstantiation(true, seeds.front(), state);
+    } else {
+        STORM_PRINT_AND_LOG("Running " << trajectories << " gradient descent trajectories concurrently\n");
+        // Every further trajectory gets its own searcher and thus its own model checkers. The hyperparameters are taken from this searcher.
+        // The searchers are set up before any trajectory starts: the setup copies the environment (whose sub-environments are created lazily)
+        // and computes derivatives of the rational functions of the model, which must not happen concurrently.
+        std::vector<std::unique_ptr<GradientDescentInstantiationSearcher<FunctionType, ConstantType>>> searchers;
+        for (uint64_t trajectory = 1; trajectory < trajectories; ++trajectory) {
+            auto searcher = std::make_unique<GradientDescentInstantiationSearcher<FunctionType, ConstantType>>(
+                model, method, learningRate, averageDecay, squaredAverageDecay, miniBatchSize, terminationEpsilon, startPoint, constraintMethod, false);
+            searcher->setup(env, synthesisTask);
+            searchers.push_back(std::move(searcher));
+        }
+
+        storm::utility::parallel::forEachTask(trajectories, trajectories, [&](uint64_t, uint64_t trajectory) {
+            try {
+                if (trajectory == 0) {
+                    searchFeasibleInstantiation(true, seeds[trajectory], state);
+                } else {
+                    searchers[trajectory - 1]->searchFeasibleInstantiation(false, seeds[trajectory], state);
+                }
+            } catch (...) {
+                // Make sure that the remaining trajectories stop as well.
+                state.finished.store(true);
+                throw;
+            }
+        });
+    }
+
+    std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> bestInstantiation = std::move(state.bestInstantiation);
+    if (constraintMethod == GradientDescentConstraintMethod::LOGISTIC_SIGMOID) {
+        // Apply sigmoid function
+        for (auto const& parameter : parameters) {
+            bestInstantiation[parameter] =
+                utility::one<CoefficientType<FunctionType>>() /
+                (utility::one<CoefficientType<FunctionType>>() +
+                 utility::convertNumber<CoefficientType<FunctionType>>(std::exp(-utility::convertNumber<double>(bestInstantiation[parameter]))));
+        }
+    }
+
+    return std::make_pair(bestInstantiation, state.bestValue);
+}
+
+template<typename FunctionType, typename ConstantType>
+void GradientDescentInstantiationSearcher<FunctionType, ConstantType>::searchFeasibleInstantiation(bool useInitialGuess, uint64_t seed,
+                                                                                                   SearchState& state) {
+    resetDynamicValues();
+    currentSearchState = &state;
+
+    std::default_random_engine engine(seed);
     std::uniform_real_distribution<> dist(0, 1);
-    bool initialGuess = true;
+    bool initialGuess = useInitialGuess;
     std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> point;
     while (true) {
         STORM_PRINT_AND_LOG("Trying out a new starting point\n");
@@ -435,24 +498,35 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
         ConstantType prob = stochasticGradientDescent(point);
         stochasticWatch.stop();
 
-        bool isFoundPointBetter = false;
-        switch (this->synthesisTask->getBound().comparisonType) {
-            case logic::ComparisonType::Greater:
-            case logic::ComparisonType::GreaterEqual:
-                isFoundPointBetter = prob > bestValue;
-                break;
-            case logic::ComparisonType::Less:
-            case logic::ComparisonType::LessEqual:
-                isFoundPointBetter = prob < bestValue;
-                break;
+        if (state.finished.load()) {
+            // Another trajectory has satisfied the bound (or failed), so this run was stopped early.
+            break;
         }
-        if (isFoundPointBetter) {
-            bestInstantiation = point;
-            bestValue = prob;
+
+        ConstantType bestValue;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            bool isFoundPointBetter = false;
+            switch (this->synthesisTask->getBound().comparisonType) {
+                case logic::ComparisonType::Greater:
+                case logic::ComparisonType::GreaterEqual:
+                    isFoundPointBetter = prob > state.bestValue;
+                    break;
+                case logic::ComparisonType::Less:
+                case logic::ComparisonType::LessEqual:
+                    isFoundPointBetter = prob < state.bestValue;
+                    break;
+            }
+            if (isFoundPointBetter) {
+                state.bestInstantiation = point;
+                state.bestValue = prob;
+            }
+            bestValue = state.bestValue;
         }
 
         if (synthesisTask->getBound().isSatisfied(bestValue)) {
             STORM_PRINT_AND_LOG("Aborting because the bound is satisfied\n");
+            state.finished.store(true);
             break;
         } else if (storm::utility::resources::isTerminate()) {
             break;
@@ -466,18 +540,7 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
             continue;
         }
     }
-
-    if (constraintMethod == GradientDescentConstraintMethod::LOGISTIC_SIGMOID) {
-        // Apply sigmoid function
-        for (auto const& parameter : parameters) {
-            bestInstantiation[parameter] =
-                utility::one<CoefficientType<FunctionType>>() /
-                (utility::one<CoefficientType<FunctionType>>() +
-                 utility::convertNumber<CoefficientType<FunctionType>>(std::exp(-utility::convertNumber<double>(bestInstantiation[parameter]))));
-        }
-    }
-
-    return std::make_pair(bestInstantiation, bestValue);
+    currentSearchState = nullptr;
 }
 
 template<typename FunctionType, typename ConstantType>
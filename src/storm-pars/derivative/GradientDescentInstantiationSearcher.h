@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include "storm-pars/analysis/MonotonicityHelper.h"
 #include "storm-pars/derivative/GradientDescentConstraintMethod.h"
 #include "storm-pars/derivative/GradientDescentMethod.h"
@@ -54,6 +56,10 @@ class GradientDescentInstantiationSearcher {
           miniBatchSize(miniBatchSize),
           terminationEpsilon(terminationEpsilon),
           constraintMethod(constraintMethod),
+          method(method),
+          learningRate(learningRate),
+          averageDecay(averageDecay),
+          squaredAverageDecay(squaredAverageDecay),
           recordRun(recordRun) {
         // TODO should we put this in subclasses?
         switch (method) {
@@ -163,6 +169,16 @@ class GradientDescentInstantiationSearcher {
               ConstantType>
     gradientDescent();
 
+    /**
+     * Sets the number of gradient descent trajectories that are run concurrently by gradientDescent.
+     * Every trajectory runs on its own thread with its own derivative and instantiation model checkers, starting from a different point.
+     * The first trajectory starts at the start point (or the initial guess), all others start at random points.
+     * The search stops as soon as one trajectory satisfies the bound; the best instantiation found by any trajectory is returned.
+     * Only the first trajectory is recorded if recordRun is set.
+     * @param numberOfTrajectories The number of trajectories. Zero means one trajectory per available core.
+     */
+    void setNumberOfTrajectories(uint64_t numberOfTrajectories);
+
     /**
      * Print the previously done run as JSON. This run can be retrieved using getVisualizationWalk.
      */
@@ -181,8 +197,29 @@ class GradientDescentInstantiationSearcher {
     std::vector<VisualizationPoint> getVisualizationWalk();
 
    private:
+    /**
+     * The best instantiation found so far, shared by all trajectories.
+     */
+    struct SearchState {
+        std::mutex mutex;
+        std::map<typename utility::parametric::VariableType<FunctionType>::type, typename utility::parametric::CoefficientType<FunctionType>::type>
+            bestInstantiation;
+        ConstantType bestValue;
+        // Set once the search is over, i.e., if the bound is satisfied or a trajectory failed.
+        std::atomic<bool> finished{false};
+    };
+
     void resetDynamicValues();
 
+    /**
+     * Repeatedly runs gradient descent from new starting points until the bound is satisfied (by this or any other trajectory)
+     * or the computation is aborted.
+     * @param useInitialGuess If set, the first run starts at the start point (or the initial guess). Otherwise, all runs start at random points.
+     * @param seed The seed for generating random starting points.
+     * @param state The state of the search that is shared by all trajectories.
+     */
+    void searchFeasibleInstantiation(bool useInitialGuess, uint64_t seed, SearchState& state);
+
     Environment env;
     std::shared_ptr<storm::pars::FeasibilitySynthesisTask const> synthesisTask;
     std::unique_ptr<modelchecker::CheckTask<storm::logic::Formula, FunctionType>> currentCheckTaskNoBound;
@@ -199,6 +236,14 @@ class GradientDescentInstantiationSearcher {
     const uint_fast64_t miniBatchSize;
     const ConstantType terminationEpsilon;
     const GradientDescentConstraintMethod constraintMethod;
+    // The method and hyperparameters given on construction. They are used to create the searchers of further trajectories.
+    const GradientDescentMethod method;
+    const ConstantType learningRate;
+    const ConstantType averageDecay;
+    const ConstantType squaredAverageDecay;
+    uint64_t numberOfTrajectories = 1;
+    // The state of the currently running search. Used to stop this trajectory once the search is finished by another one.
+    SearchState const* currentSearchState = nullptr;
 
     // This is for visualizing data
     const bool recordRun;
@@ -240,7 +285,7 @@ class GradientDescentInstantiationSearcher {
     typedef boost::variant<Adam, RAdam, RmsProp, Plain, Momentum, Nesterov> GradientDescentType;
     GradientDescentType gradientDescentType;
     // Only respected by some Gradient Descent methods, the ones that have a "sign" version in the GradientDescentMethod enum
-    bool useSignsOnly;
+    bool useSignsOnly = false;
 
     ConstantType logarithmicBarrierTerm;
 
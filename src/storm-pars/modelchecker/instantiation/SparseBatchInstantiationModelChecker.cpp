@@ -0,0 +1,436 @@
+#include "storm-pars/modelchecker/instantiation/SparseBatchInstantiationModelChecker.h"
+
+#include <algorithm>
+#include <set>
+
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseMdpInstantiationModelChecker.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidStateException.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename SparseModelType, typename ConstantType>
+SparseBatchInstantiationModelChecker<SparseModelType, ConstantType>::SparseBatchInstantiationModelChecker(SparseModelType const& parametricModel)
+    : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), batchCheckingSupported(false), minimize(false), computeRewards(false) {
+    if constexpr (std::is_same<SparseModelType, storm::models::sparse::Dtmc<ParametricType>>::value) {
+        pointChecker = std::make_unique<SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>>(parametricModel);
+    } else {
+        pointChecker = std::make_unique<SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>>(parametricModel);
+    }
+}
+
+template<typename SparseModelType, typename ConstantType>
+void SparseBatchInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(
+    CheckTask<storm::logic::Formula, ParametricType> const& checkTask) {
+    SparseInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(checkTask);
+    pointChecker->specifyFormula(checkTask);
+    batchCheckingSupported = initializeEquationSystem();
+    if (batchCheckingSupported) {
+        STORM_LOG_INFO("Checking instantiations in batches on an equation system with " << maybeStates.getNumberOfSetBits() << " states, "
+                                                                                         << systemColumns.size() << " entries and " << functions.size()
+                                                                                         << " distinct functions.");
+    } else {
+        STORM_LOG_INFO("The property can not be checked for a batch of instantiations at once. Instantiations are checked one by one.");
+    }
+}
+
+template<typename SparseModelType, typename ConstantType>
+bool SparseBatchInstantiationModelChecker<SparseModelType, ConstantType>::isBatchCheckingSupported() const {
+    return batchCheckingSupported;
+}
+
+template<typename SparseModelType, typename ConstantType>
+boost::optional<uint64_t> SparseBatchInstantiationModelChecker<SparseModelType, ConstantType>::getFunctionIndex(ParametricType const& function) {
+    if (storm::utility::isConstant(function)) {
+        return boost::none;
+    }
+    auto insertionRes = functionIndices.emplace(function, functions.size());
+    if (insertionRes.second) {
+        functions.push_back(function);
+        isTransitionFunction.push_back(false);
+    }
+    return insertionRes.first->second;
+}
+
+template<typename SparseModelType, typename ConstantType>
+bool SparseBatchInstantiationModelChecker<SparseModelType, ConstantType>::initializeEquationSystem() {
+    functionIndices.clear();
+    functions.clear();
+    isTransitionFunction.clear();
+    variables.clear();
+    compiledFunctions.clear();
+    constantRowSums.clear();
+    rowSumFunctionIndications.clear();
+    rowSumFunctions.clear();
+    systemRowGroupIndices.clear();
+    systemRowIndications.clear();
+    systemColumns.clear();
+    systemEntryFunctions.clear();
+    systemEntryConstants.clear();
+    systemOffsetConstants.clear();
+    systemOffsetFunctionIndications.clear();
+    systemOffsetFunctions.clear();
+
+    // Find out whether the property is supported.
+    auto const& formula = this->currentCheckTask->getFormula();
+    bool const isDtmc = this->parametricModel.isOfType(storm::models::ModelType::Dtmc);
+    storm::logic::Formula const* leftSubformula = nullptr;
+    storm::logic::Formula const* rightSubformula = nullptr;
+    typename SparseModelType::RewardModelType const* rewardModel = nullptr;
+    if (formula.isProbabilityOperatorFormula()) {
+        auto const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+        if (pathFormula.isUntilFormula()) {
+            leftSubformula = &pathFormula.asUntilFormula().getLeftSubformula();
+            rightSubformula = &pathFormula.asUntilFormula().getRightSubformula();
+        } else if (pathFormula.isReachabilityProbabilityFormula()) {
+            rightSubformula = &pathFormula.asEventuallyFormula().getSubformula();
+        } else {
+            return false;
+        }
+        computeRewards = false;
+    } else if (isDtmc && formula.isRewardOperatorFormula() && formula.asRewardOperatorFormula().getSubformula().isReachabilityRewardFormula()) {
+        rightSubformula = &formula.asRewardOperatorFormula().getSubformula().asEventuallyFormula().getSubformula();
+        rewardModel = this->currentCheckTask->isRewardModelSet() ? &this->parametricModel.getRewardModel(this->currentCheckTask->getRewardModel())
+                                                                 : &this->parametricModel.getUniqueRewardModel();
+        if (rewardModel->hasTransitionRewards()) {
+            return false;
+        }
+        computeRewards = true;
+    } else {
+        return false;
+    }
+    if (!isDtmc) {
+        if (!this->currentCheckTask->isOptimizationDirectionSet()) {
+            return false;
+        }
+        minimize = storm::solver::minimize(this->currentCheckTask->getOptimizationDirection());
+    }
+    storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> propositionalChecker(this->parametricModel);
+    if ((leftSubformula && !propositionalChecker.canHandle(*leftSubformula)) || !propositionalChecker.canHandle(*rightSubformula)) {
+        return false;
+    }
+
+    // Perform the graph analysis. This is valid for every graph-preserving instantiation.
+    auto const& transitionMatrix = this->parametricModel.getTransitionMatrix();
+    auto backwardTransitions = this->parametricModel.getBackwardTransitions();
+    storm::storage::BitVector phiStates =
+        leftSubformula ? propositionalChecker.check(*leftSubformula)->asExplicitQualitativeCheckResult().getTruthValuesVector()
+                       : storm::storage::BitVector(this->parametricModel.getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = propositionalChecker.check(*rightSubformula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+    if (computeRewards) {
+        statesWithFixedNonZeroValue = ~storm::utility::graph::performProb1(backwardTransitions, phiStates, psiStates);
+        maybeStates = ~(statesWithFixedNonZeroValue | psiStates);
+    } else {
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+        if (isDtmc) {
+            statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+        } else if (minimize) {
+            statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions,
+                                                                               phiStates, psiStates);
+        } else {
+            statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions,
+                                                                               phiStates, psiStates);
+        }
+        statesWithFixedNonZeroValue = std::move(statesWithProbability01.second);
+        maybeStates = ~(statesWithProbability01.first | statesWithFixedNonZeroValue);
+    }
+
+    // Gather the distinct functions and split the row sums of the transition matrix into constant and parametric parts.
+    constantRowSums.assign(transitionMatrix.getRowCount(), storm::utility::zero<ConstantType>());
+    rowSumFunctionIndications.push_back(0);
+    for (uint64_t row = 0; row < transitionMatrix.getRowCount(); ++row) {
+        for (auto const& entry : transitionMatrix.getRow(row)) {
+            if (auto functionIndex = getFunctionIndex(entry.getValue())) {
+                isTransitionFunction[*functionIndex] = true;
+                rowSumFunctions.push_back(*functionIndex);
+            } else {
+                constantRowSums[row] += storm::utility::convertNumber<ConstantType>(entry.getValue());
+            }
+        }
+        rowSumFunctionIndications.push_back(rowSumFunctions.size());
+    }
+
+    // Build the equation system over the maybe states.
+    std::vector<uint64_t> localIndices(this->parametricModel.getNumberOfStates(), 0);
+    uint64_t localIndex = 0;
+    for (auto state : maybeStates) {
+        localIndices[state] = localIndex++;
+    }
+    auto addOffset = [&](ParametricType const& value, ConstantType& offsetConstant) {
+        if (auto functionIndex = getFunctionIndex(value)) {
+            systemOffsetFunctions.push_back(*functionIndex);
+        } else {
+            offsetConstant += storm::utility::convertNumber<ConstantType>(value);
+        }
+    };
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    systemRowGroupIndices.push_back(0);
+    systemRowIndications.push_back(0);
+    systemOffsetFunctionIndications.push_back(0);
+    for (auto state : maybeStates) {
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+            ConstantType offsetConstant = storm::utility::zero<ConstantType>();
+            if (computeRewards) {
+                if (rewardModel->hasStateRewards()) {
+                    addOffset(rewardModel->getStateReward(state), offsetConstant);
+                }
+                if (rewardModel->hasStateActionRewards()) {
+                    addOffset(rewardModel->getStateActionReward(row), offsetConstant);
+                }
+            }
+            for (auto const& entry : transitionMatrix.getRow(row)) {
+                if (maybeStates.get(entry.getColumn())) {
+                    auto functionIndex = getFunctionIndex(entry.getValue());
+                    systemColumns.push_back(localIndices[entry.getColumn()]);
+                    systemEntryFunctions.push_back(functionIndex ? *functionIndex : noFunction);
+                    systemEntryConstants.push_back(functionIndex ? storm::utility::zero<ConstantType>()
+                                                                 : storm::utility::convertNumber<ConstantType>(entry.getValue()));
+                } else if (!computeRewards && statesWithFixedNonZeroValue.get(entry.getColumn())) {
+                    addOffset(entry.getValue(), offsetConstant);
+                }
+            }
+            systemRowIndications.push_back(systemColumns.size());
+            systemOffsetConstants.push_back(offsetConstant);
+            systemOffsetFunctionIndications.push_back(systemOffsetFunctions.size());
+        }
+        systemRowGroupIndices.push_back(systemRowIndications.size() - 1);
+    }
+
+    // Compile the functions so that evaluating them does not go through carl.
+    std::set<VariableType> variableSet;
+    for (auto const& function : functions) {
+        storm::utility::parametric::gatherOccurringVariables(function, variableSet);
+    }
+    variables.assign(variableSet.begin(), variableSet.end());
+    auto variableIndices = storm::utility::getVariableIndices(variables);
+    for (auto const& function : functions) {
+        compiledFunctions.emplace_back(function, variableIndices);
+    }
+    return true;
+}
+
+template<typename SparseModelType, typename ConstantType>
+std::unique_ptr<CheckResult> SparseBatchInstantiationModelChecker<SparseModelType, ConstantType>::check(
+    Environment const& env, storm::utility::parametric::Valuation<ParametricType> const& valuation) {
+    return std::move(checkBatch(env, {valuation}).front());
+}
+
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::unique_ptr<CheckResult>> SparseBatchInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) {
+    STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+    std::vector<std::unique_ptr<CheckResult>> results(valuations.size());
+
+    // If the property is not supported, the point checker handles all instantiations (under the same assumptions as this checker).
+    // Otherwise, it only handles instantiations that are not graph-preserving, which is why it must not reuse any graph analysis.
+    pointChecker->setInstantiationsAreGraphPreserving(!batchCheckingSupported && this->getInstantiationsAreGraphPreserving());
+    if (!batchCheckingSupported) {
+        for (uint64_t instantiation = 0; instantiation < valuations.size(); ++instantiation) {
+            results[instantiation] = pointChecker->check(env, valuations[instantiation]);
+        }
+        return results;
+    }
+
+    // Evaluate every function for all instantiations.
+    uint64_t numberOfInstantiations = valuations.size();
+    std::vector<std::vector<ConstantType>> variableValues(numberOfInstantiations, std::vector<ConstantType>(variables.size()));
+    for (uint64_t instantiation = 0; instantiation < numberOfInstantiations; ++instantiation) {
+        for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+            auto valueIt = valuations[instantiation].find(variables[variable]);
+            STORM_LOG_THROW(valueIt != valuations[instantiation].end(), storm::exceptions::InvalidArgumentException,
+                            "No value for parameter " << variables[variable] << " given.");
+            variableValues[instantiation][variable] = storm::utility::convertNumber<ConstantType>(valueIt->second);
+        }
+    }
+    std::vector<ConstantType> functionValues(functions.size() * numberOfInstantiations);
+    auto functionValueIt = functionValues.begin();
+    for (auto const& function : compiledFunctions) {
+        for (auto const& values : variableValues) {
+            *functionValueIt = function.evaluate(values);
+            ++functionValueIt;
+        }
+    }
+
+    // Find the instantiations that preserve the graph structure and yield a stochastic transition matrix.
+    std::vector<bool> isGraphPreserving(numberOfInstantiations, true);
+    for (uint64_t function = 0; function < functions.size(); ++function) {
+        if (isTransitionFunction[function]) {
+            for (uint64_t instantiation = 0; instantiation < numberOfInstantiations; ++instantiation) {
+                if (functionValues[function * numberOfInstantiations + instantiation] <= storm::utility::zero<ConstantType>()) {
+                    isGraphPreserving[instantiation] = false;
+                }
+            }
+        }
+    }
+    storm::utility::ConstantsComparator<ConstantType> comparator;
+    std::vector<ConstantType> rowSums(numberOfInstantiations);
+    for (uint64_t row = 0; row + 1 < rowSumFunctionIndications.size(); ++row) {
+        std::fill(rowSums.begin(), rowSums.end(), constantRowSums[row]);
+        for (uint64_t i = rowSumFunctionIndications[row]; i < rowSumFunctionIndications[row + 1]; ++i) {
+            ConstantType const* values = functionValues.data() + rowSumFunctions[i] * numberOfInstantiations;
+            for (uint64_t instantiation = 0; instantiation < numberOfInstantiations; ++instantiation) {
+                rowSums[instantiation] += values[instantiation];
+            }
+        }
+        for (uint64_t instantiation = 0; instantiation < numberOfInstantiations; ++instantiation) {
+            if (!comparator.isOne(rowSums[instantiation])) {
+                isGraphPreserving[instantiation] = false;
+            }
+        }
+    }
+    std::vector<uint64_t> batchInstantiations;
+    for (uint64_t instantiation = 0; instantiation < numberOfInstantiations; ++instantiation) {
+        if (isGraphPreserving[instantiation]) {
+            batchInstantiations.push_back(instantiation);
+        } else {
+            results[instantiation] = pointChecker->check(env, valuations[instantiation]);
+        }
+    }
+    STORM_LOG_INFO_COND(batchInstantiations.size() == numberOfInstantiations,
+                        numberOfInstantiations - batchInstantiations.size() << " of " << numberOfInstantiations
+                                                                            << " instantiations are not graph-preserving and have been checked one by one.");
+    if (batchInstantiations.empty()) {
+        return results;
+    }
+
+    // Drop the values of the instantiations that have been checked already.
+    if (batchInstantiations.size() < numberOfInstantiations) {
+        std::vector<ConstantType> batchFunctionValues;
+        batchFunctionValues.reserve(functions.size() * batchInstantiations.size());
+        for (uint64_t function = 0; function < functions.size(); ++function) {
+            for (auto instantiation : batchInstantiations) {
+                batchFunctionValues.push_back(functionValues[function * numberOfInstantiations + instantiation]);
+            }
+        }
+        functionValues = std::move(batchFunctionValues);
+    }
+
+    std::vector<ConstantType> maybeStateValues = solveBatch(env, functionValues, batchInstantiations.size());
+
+    ConstantType fixedNonZeroValue = computeRewards ? storm::utility::infinity<ConstantType>() : storm::utility::one<ConstantType>();
+    for (uint64_t batchIndex = 0; batchIndex < batchInstantiations.size(); ++batchIndex) {
+        std::vector<ConstantType> stateValues(this->parametricModel.getNumberOfStates(), storm::utility::zero<ConstantType>());
+        storm::utility::vector::setVectorValues(stateValues, statesWithFixedNonZeroValue, fixedNonZeroValue);
+        auto valueIt = maybeStateValues.begin() + batchIndex;
+        for (auto state : maybeStates) {
+            stateValues[state] = *valueIt;
+            valueIt += batchInstantiations.size();
+        }
+        results[batchInstantiations[batchIndex]] = createResult(std::move(stateValues));
+    }
+    return results;
+}
+
+template<typename SparseModelType, typename ConstantType>
+std::vector<ConstantType> SparseBatchInstantiationModelChecker<SparseModelType, ConstantType>::solveBatch(Environment const& env,
+                                                                                                        std::vector<ConstantType> const& functionValues,
+                                                                                                        uint64_t numberOfInstantiations) const {
+    uint64_t const numberOfStates = systemRowGroupIndices.size() - 1;
+    uint64_t const numberOfRows = systemRowIndications.size() - 1;
+    std::vector<ConstantType> x(numberOfStates * numberOfInstantiations, storm::utility::zero<ConstantType>());
+    if (numberOfStates == 0) {
+        return x;
+    }
+
+    // Instantiate the offsets of all rows.
+    std::vector<ConstantType> offsets(numberOfRows * numberOfInstantiations);
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        ConstantType* rowOffsets = offsets.data() + row * numberOfInstantiations;
+        std::fill(rowOffsets, rowOffsets + numberOfInstantiations, systemOffsetConstants[row]);
+        for (uint64_t i = systemOffsetFunctionIndications[row]; i < systemOffsetFunctionIndications[row + 1]; ++i) {
+            ConstantType const* values = functionValues.data() + systemOffsetFunctions[i] * numberOfInstantiations;
+            for (uint64_t instantiation = 0; instantiation < numberOfInstantiations; ++instantiation) {
+                rowOffsets[instantiation] += values[instantiation];
+            }
+        }
+    }
+
+    bool const isDtmc = this->parametricModel.isOfType(storm::models::ModelType::Dtmc);
+    ConstantType const precision =
+        storm::utility::convertNumber<ConstantType>(isDtmc ? env.solver().native().getPrecision() : env.solver().minMax().getPrecision());
+    bool const relative = isDtmc ? env.solver().native().getRelativeTerminationCriterion() : env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t const maximalNumberOfIterations =
+        isDtmc ? env.solver().native().getMaximalNumberOfIterations() : env.solver().minMax().getMaximalNumberOfIterations();
+
+    // Gauss-Seidel style value iteration, starting from below. For each state, the values of all instantiations are updated at once.
+    std::vector<ConstantType> groupValues(numberOfInstantiations);
+    std::vector<ConstantType> rowValues(numberOfInstantiations);
+    uint64_t iterations = 0;
+    bool converged = false;
+    while (!converged && iterations < maximalNumberOfIterations) {
+        converged = true;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            for (uint64_t row = systemRowGroupIndices[state]; row < systemRowGroupIndices[state + 1]; ++row) {
+                ConstantType* values = row == systemRowGroupIndices[state] ? groupValues.data() : rowValues.data();
+                std::copy_n(offsets.data() + row * numberOfInstantiations, numberOfInstantiations, values);
+                for (uint64_t entry = systemRowIndications[row]; entry < systemRowIndications[row + 1]; ++entry) {
+                    ConstantType const* successorValues = x.data() + systemColumns[entry] * numberOfInstantiations;
+                    if (systemEntryFunctions[entry] == noFunction) {
+                        ConstantType const& probability = systemEntryConstants[entry];
+                        for (uint64_t instantiation = 0; instantiation < numberOfInstantiations; ++instantiation) {
+                            values[instantiation] += probability * successorValues[instantiation];
+                        }
+                    } else {
+                        ConstantType const* probabilities = functionValues.data() + systemEntryFunctions[entry] * numberOfInstantiations;
+                        for (uint64_t instantiation = 0; instantiation < numberOfInstantiations; ++instantiation) {
+                            values[instantiation] += probabilities[instantiation] * successorValues[instantiation];
+                        }
+                    }
+                }
+                if (values != groupValues.data()) {
+                    for (uint64_t instantiation = 0; instantiation < numberOfInstantiations; ++instantiation) {
+                        groupValues[instantiation] = minimize ? std::min(groupValues[instantiation], values[instantiation])
+                                                              : std::max(groupValues[instantiation], values[instantiation]);
+                    }
+                }
+            }
+            ConstantType* stateValues = x.data() + state * numberOfInstantiations;
+            for (uint64_t instantiation = 0; instantiation < numberOfInstantiations; ++instantiation) {
+                if (converged && !storm::utility::vector::equalModuloPrecision(stateValues[instantiation], groupValues[instantiation], precision, relative)) {
+                    converged = false;
+                }
+                stateValues[instantiation] = groupValues[instantiation];
+            }
+        }
+        ++iterations;
+    }
+    STORM_LOG_WARN_COND(converged, "Value iteration for a batch of " << numberOfInstantiations << " instantiations did not converge within " << iterations
+                                                                     << " iterations.");
+    STORM_LOG_INFO("Value iteration for a batch of " << numberOfInstantiations << " instantiations took " << iterations << " iterations.");
+    return x;
+}
+
+template<typename SparseModelType, typename ConstantType>
+std::unique_ptr<CheckResult> SparseBatchInstantiationModelChecker<SparseModelType, ConstantType>::createResult(std::vector<ConstantType>&& stateValues) const {
+    auto quantitativeResult = std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(std::move(stateValues));
+    auto const& operatorFormula = this->currentCheckTask->getFormula().asOperatorFormula();
+    if (operatorFormula.hasQuantitativeResult()) {
+        return quantitativeResult;
+    }
+    return quantitativeResult->compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ConstantType>());
+}
+
+template class SparseBatchInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
+template class SparseBatchInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double>;
+
+}  // namespace modelchecker
+}  // namespace storm
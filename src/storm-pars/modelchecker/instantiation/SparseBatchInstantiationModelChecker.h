@@ -0,0 +1,113 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
+#include "storm-pars/utility/CompiledRationalFunction.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace modelchecker {
+
+/*!
+ * Class to efficiently check a formula on a parametric DTMC or MDP for many parameter instantiations at once.
+ *
+ * The graph analysis is performed once (on the parametric model) and the resulting equation systems are solved for a whole batch of
+ * instantiations simultaneously. Each distinct function occurring in the model is evaluated once per instantiation and the results are stored
+ * such that the values of one function for all instantiations of the batch are consecutive. Value iteration then updates each state for all
+ * instantiations in a single (vectorizable) inner loop, while the matrix structure is shared.
+ *
+ * This applies to unbounded reachability probabilities (DTMCs and MDPs) and to reachability rewards (DTMCs only). Instantiations for which the
+ * graph structure of the model is not preserved (i.e., a transition probability evaluates to zero) as well as all other properties are
+ * delegated to the standard instantiation model checker for the respective model type.
+ */
+template<typename SparseModelType, typename ConstantType>
+class SparseBatchInstantiationModelChecker : public SparseInstantiationModelChecker<SparseModelType, ConstantType> {
+   public:
+    typedef typename SparseModelType::ValueType ParametricType;
+    typedef typename storm::utility::parametric::VariableType<ParametricType>::type VariableType;
+
+    SparseBatchInstantiationModelChecker(SparseModelType const& parametricModel);
+
+    virtual void specifyFormula(CheckTask<storm::logic::Formula, ParametricType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<ParametricType> const& valuation) override;
+
+    /*!
+     * Checks the specified formula for all given instantiations.
+     * @return the results in the order of the given valuations
+     */
+    std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env,
+                                                         std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations);
+
+    /*!
+     * Retrieves whether the specified formula is checked for a whole batch of instantiations at once (as opposed to checking them one by one).
+     */
+    bool isBatchCheckingSupported() const;
+
+   private:
+    /*!
+     * Sets up the equation system over the maybe states (which is the same for all graph-preserving instantiations).
+     * Returns false if the specified formula can not be checked in batches.
+     */
+    bool initializeEquationSystem();
+
+    /*!
+     * Retrieves the index of the given function among the distinct functions (or none, if the function is constant).
+     */
+    boost::optional<uint64_t> getFunctionIndex(ParametricType const& function);
+
+    /*!
+     * Solves the equation system for the given instantiations and yields the values of all maybe states for all instantiations.
+     * The value of local maybe state i for instantiation k is stored at position i * numberOfInstantiations + k.
+     */
+    std::vector<ConstantType> solveBatch(Environment const& env, std::vector<ConstantType> const& functionValues, uint64_t numberOfInstantiations) const;
+
+    /*!
+     * Builds the result (as it would be returned by the standard instantiation model checker) from the given state values.
+     */
+    std::unique_ptr<CheckResult> createResult(std::vector<ConstantType>&& stateValues) const;
+
+    // The checker for all instantiations that are not checked in batches.
+    std::unique_ptr<SparseInstantiationModelChecker<SparseModelType, ConstantType>> pointChecker;
+    bool batchCheckingSupported;
+
+    bool minimize;
+    bool computeRewards;
+    storm::storage::BitVector maybeStates;
+    // The states whose value is one (probabilities) or infinity (rewards), respectively.
+    storm::storage::BitVector statesWithFixedNonZeroValue;
+
+    // The distinct non-constant functions. Functions that do not occur in the transition matrix only need to be well-defined.
+    std::unordered_map<ParametricType, uint64_t> functionIndices;
+    std::vector<ParametricType> functions;
+    std::vector<bool> isTransitionFunction;
+    // The variables occurring in the functions and the compiled functions (in the same order as the functions).
+    std::vector<VariableType> variables;
+    std::vector<storm::utility::CompiledRationalFunction<ConstantType>> compiledFunctions;
+
+    // The rows of the full transition matrix as the sum of a constant part and (non-constant) functions. Used to validate instantiations.
+    std::vector<ConstantType> constantRowSums;
+    std::vector<uint64_t> rowSumFunctionIndications;
+    std::vector<uint64_t> rowSumFunctions;
+
+    // The equation system over the maybe states. Each entry either refers to a function or (if its function index is noFunction) carries a
+    // constant value. Each row has a constant offset and a list of functions that are added on top.
+    static constexpr uint64_t noFunction = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> systemRowGroupIndices;
+    std::vector<uint64_t> systemRowIndications;
+    std::vector<uint64_t> systemColumns;
+    std::vector<uint64_t> systemEntryFunctions;
+    std::vector<ConstantType> systemEntryConstants;
+    std::vector<ConstantType> systemOffsetConstants;
+    std::vector<uint64_t> systemOffsetFunctionIndications;
+    std::vector<uint64_t> systemOffsetFunctions;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
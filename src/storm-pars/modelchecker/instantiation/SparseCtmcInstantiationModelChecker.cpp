@@ -13,6 +13,11 @@ SparseCtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseCtmcIn
     // Intentionally left empty
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseCtmcInstantiationModelChecker<SparseModelType, ConstantType>::compileFunctions() {
+    modelInstantiator.compileFunctions();
+}
+
 template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseCtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
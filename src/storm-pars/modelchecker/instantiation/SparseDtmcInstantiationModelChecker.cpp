@@ -18,6 +18,11 @@ SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcIn
     // Intentionally left empty
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::compileFunctions() {
+    modelInstantiator.compileFunctions();
+}
+
 template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
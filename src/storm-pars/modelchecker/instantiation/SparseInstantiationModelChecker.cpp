@@ -25,6 +25,11 @@ void SparseInstantiationModelChecker<SparseModelType, ConstantType>::specifyForm
         checkTask.substituteFormula(*currentFormula).template convertValueType<ConstantType>());
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseInstantiationModelChecker<SparseModelType, ConstantType>::compileFunctions() {
+    // Intentionally left empty
+}
+
 template<typename SparseModelType, typename ConstantType>
 void SparseInstantiationModelChecker<SparseModelType, ConstantType>::setInstantiationsAreGraphPreserving(bool value) {
     instantiationsAreGraphPreserving = value;
@@ -21,11 +21,17 @@ class SparseInstantiationModelChecker {
     SparseInstantiationModelChecker(SparseModelType const& parametricModel);
     virtual ~SparseInstantiationModelChecker() = default;
 
-    void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
+    virtual void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
 
     virtual std::unique_ptr<CheckResult> check(Environment const& env,
                                                storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
 
+    /*!
+     * Prepares the evaluation of the parametric functions so that the first check does not need to do so.
+     * This allows to use different instantiation checkers of the same model in parallel.
+     */
+    virtual void compileFunctions();
+
     // If set, it is assumed that all considered model instantiations have the same underlying graph structure.
     // This bypasses the graph analysis for the different instantiations.
     void setInstantiationsAreGraphPreserving(bool value);
@@ -21,6 +21,11 @@ SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>::SparseMdpInst
     // Intentionally left empty
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>::compileFunctions() {
+    modelInstantiator.compileFunctions();
+}
+
 template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
@@ -23,6 +23,8 @@ class SparseMdpInstantiationModelChecker : public SparseInstantiationModelChecke
     virtual std::unique_ptr<CheckResult> check(Environment const& env,
                                                storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+    virtual void compileFunctions() override;
+
    protected:
     // Optimizations for the different formula types
     std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(
@@ -13,6 +13,8 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/parallelEnvironment.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -52,6 +54,16 @@ ParametricType RegionModelChecker<ParametricType>::getBoundAtInitState(Environme
     return storm::utility::zero<ParametricType>();
 }
 
+template<typename ParametricType>
+std::shared_ptr<ModelCheckerHint const> RegionModelChecker<ParametricType>::getRegionAnalysisHint(storm::solver::OptimizationDirection const&) const {
+    return nullptr;
+}
+
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::setRegionAnalysisHint(storm::solver::OptimizationDirection const&, std::shared_ptr<ModelCheckerHint const> const&) {
+    // Intentionally left empty
+}
+
 template<typename ParametricType>
 std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performRegionRefinement(
     Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold,
@@ -76,6 +88,20 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     unprocessedRegions.emplace(region, RegionResult::Unknown);
     refinementDepths.push(0);
 
+    // The hints (for minimizing and maximizing parameters) obtained from the analysis of the parent of each unprocessed region.
+    // The results of a region are valid bounds for all its subregions, so they are a good starting point for the analysis of the subregions.
+    typedef std::pair<std::shared_ptr<ModelCheckerHint const>, std::shared_ptr<ModelCheckerHint const>> RegionAnalysisHints;
+    std::queue<RegionAnalysisHints> regionHints;
+    regionHints.emplace(nullptr, nullptr);
+    auto setRegionAnalysisHints = [](RegionModelChecker<ParametricType>& checker, RegionAnalysisHints const& hints) {
+        checker.setRegionAnalysisHint(storm::solver::OptimizationDirection::Minimize, hints.first);
+        checker.setRegionAnalysisHint(storm::solver::OptimizationDirection::Maximize, hints.second);
+    };
+    auto getRegionAnalysisHints = [](RegionModelChecker<ParametricType> const& checker) {
+        return RegionAnalysisHints(checker.getRegionAnalysisHint(storm::solver::OptimizationDirection::Minimize),
+                                   checker.getRegionAnalysisHint(storm::solver::OptimizationDirection::Maximize));
+    };
+
     uint_fast64_t numOfAnalyzedRegions = 0;
     CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
@@ -92,32 +118,25 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
         displayedProgress = storm::utility::zero<CoefficientType>();
     }
 
-    // NORMAL WHILE LOOP
-    uint64_t currentDepth = refinementDepths.front();
-    while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
-        assert(unprocessedRegions.size() == refinementDepths.size());
-        STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; "
-                                            << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
-        auto& currentRegion = unprocessedRegions.front().first;
-        auto& res = unprocessedRegions.front().second;
-        std::shared_ptr<storm::analysis::Order> order;
-        std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
-        res = analyzeRegion(env, currentRegion, hypothesis, res, false);
-
+    // Adds the given analyzed region to the result or (if the result is inconclusive) enqueues its subregions.
+    auto processAnalyzedRegion = [&](std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>&& analyzedRegion, uint64_t depth,
+                                     RegionAnalysisHints const& hints) {
+        auto& currentRegion = analyzedRegion.first;
+        auto const& res = analyzedRegion.second;
         switch (res) {
             case RegionResult::AllSat:
                 fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
                 fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
-                result.push_back(std::move(unprocessedRegions.front()));
+                result.push_back(std::move(analyzedRegion));
                 break;
             case RegionResult::AllViolated:
                 fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
                 fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
-                result.push_back(std::move(unprocessedRegions.front()));
+                result.push_back(std::move(analyzedRegion));
                 break;
             default:
                 // Split the region as long as the desired refinement depth is not reached.
-                if (!depthThreshold || currentDepth < depthThreshold.get()) {
+                if (!depthThreshold || depth < depthThreshold.get()) {
                     std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
                     RegionResult initResForNewRegions = (res == RegionResult::CenterSat)
                                                             ? RegionResult::ExistsSat
@@ -126,25 +145,105 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
                     currentRegion.split(currentRegion.getCenterPoint(), newRegions);
                     for (auto& newRegion : newRegions) {
                         unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                        refinementDepths.push(currentDepth + 1);
+                        refinementDepths.push(depth + 1);
+                        regionHints.push(hints);
                     }
 
                 } else {
                     // If the region is not further refined, it is still added to the result
-                    result.push_back(std::move(unprocessedRegions.front()));
+                    result.push_back(std::move(analyzedRegion));
                 }
                 break;
         }
         ++numOfAnalyzedRegions;
-        unprocessedRegions.pop();
-        refinementDepths.pop();
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
                 STORM_PRINT_AND_LOG("#");
                 displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
             }
         }
-        currentDepth = refinementDepths.front();
+    };
+
+    // NORMAL WHILE LOOP
+    uint64_t currentDepth = refinementDepths.front();
+    if (refinementWorkers.empty()) {
+        while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
+            assert(unprocessedRegions.size() == refinementDepths.size());
+            STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; "
+                                                << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+            auto& currentRegion = unprocessedRegions.front().first;
+            auto& res = unprocessedRegions.front().second;
+            setRegionAnalysisHints(*this, regionHints.front());
+            res = analyzeRegion(env, currentRegion, hypothesis, res, false);
+            processAnalyzedRegion(std::move(unprocessedRegions.front()), currentDepth, getRegionAnalysisHints(*this));
+            unprocessedRegions.pop();
+            refinementDepths.pop();
+            regionHints.pop();
+            currentDepth = refinementDepths.front();
+        }
+    } else {
+        // Regions are taken from the queue in batches and analyzed concurrently. Processing the results in queue order yields exactly the same
+        // refinement as the sequential loop above, except that some regions of the last batch might be analyzed in vain.
+        uint64_t const numberOfWorkers = refinementWorkers.size() + 1;
+        uint64_t const maximalBatchSize = 4 * numberOfWorkers;
+        // The workers share the parametric model, so everything that is derived from it lazily has to be set up before the threads start.
+        // Similarly, each worker gets its own environment as sub-environments are created lazily as well.
+        this->prepareConcurrentAnalysis();
+        for (auto& worker : refinementWorkers) {
+            worker->prepareConcurrentAnalysis();
+        }
+        std::vector<Environment> workerEnvironments = storm::utility::parallel::createThreadEnvironments(env, numberOfWorkers);
+        std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> batch;
+        std::vector<uint64_t> batchDepths;
+        std::vector<RegionAnalysisHints> batchHints;
+        std::vector<RegionResult> batchResults;
+        while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
+            assert(unprocessedRegions.size() == refinementDepths.size());
+            batch.clear();
+            batchDepths.clear();
+            batchHints.clear();
+            // Regions that are to be analyzed with the help of monotonicity are left for the loop below.
+            while (batch.size() < maximalBatchSize && !unprocessedRegions.empty() && (!useMonotonicity || refinementDepths.front() < monThresh)) {
+                batch.push_back(std::move(unprocessedRegions.front()));
+                batchDepths.push_back(refinementDepths.front());
+                batchHints.push_back(std::move(regionHints.front()));
+                unprocessedRegions.pop();
+                refinementDepths.pop();
+                regionHints.pop();
+            }
+            STORM_LOG_INFO("Analyzing regions #" << numOfAnalyzedRegions << " to #" << numOfAnalyzedRegions + batch.size() - 1 << " with "
+                                                 << numberOfWorkers << " workers (Refinement depth " << batchDepths.front() << "; "
+                                                 << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+
+            batchResults.assign(batch.size(), RegionResult::Unknown);
+            storm::utility::parallel::forEachTask(batch.size(), numberOfWorkers, [&](uint64_t workerIndex, uint64_t regionIndex) {
+                RegionModelChecker<ParametricType>& worker = workerIndex == 0 ? *this : *refinementWorkers[workerIndex - 1];
+                setRegionAnalysisHints(worker, batchHints[regionIndex]);
+                batchResults[regionIndex] =
+                    worker.analyzeRegion(workerEnvironments[workerIndex], batch[regionIndex].first, hypothesis, batch[regionIndex].second, false);
+                // The hints of the analyzed region replace the ones of its parent.
+                batchHints[regionIndex] = getRegionAnalysisHints(worker);
+            });
+
+            uint64_t regionIndex = 0;
+            for (; regionIndex < batch.size() && fractionOfUndiscoveredArea > thresholdAsCoefficient; ++regionIndex) {
+                batch[regionIndex].second = batchResults[regionIndex];
+                processAnalyzedRegion(std::move(batch[regionIndex]), batchDepths[regionIndex], batchHints[regionIndex]);
+            }
+            // The threshold has been reached, so the remaining regions are treated as if they were never analyzed.
+            for (; regionIndex < batch.size(); ++regionIndex) {
+                result.push_back(std::move(batch[regionIndex]));
+            }
+            if (!unprocessedRegions.empty()) {
+                currentDepth = refinementDepths.front();
+            }
+        }
+    }
+
+    // The hints are not used when analyzing regions with the help of monotonicity (which fixes the choices of monotone parameters).
+    setRegionAnalysisHints(*this, RegionAnalysisHints());
+    for (auto& worker : refinementWorkers) {
+        setRegionAnalysisHints(*worker, RegionAnalysisHints());
     }
 
     // FIFO queues for the order and local monotonicity results
@@ -333,6 +432,16 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
 }
 
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::setRefinementWorkers(std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& workers) {
+    refinementWorkers = workers;
+}
+
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::prepareConcurrentAnalysis() {
+    // Intentionally left empty
+}
+
 template<typename ParametricType>
 void RegionModelChecker<ParametricType>::extendLocalMonotonicityResult(
     storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order,
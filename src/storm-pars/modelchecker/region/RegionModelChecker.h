@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "storm-pars/analysis/LocalMonotonicityResult.h"
 #include "storm-pars/analysis/Order.h"
@@ -12,7 +13,9 @@
 #include "storm-pars/storage/ParameterRegion.h"
 
 #include "storm/modelchecker/CheckTask.h"
+#include "storm/modelchecker/hints/ModelCheckerHint.h"
 #include "storm/models/ModelBase.h"
+#include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
 
@@ -74,6 +77,33 @@ class RegionModelChecker {
         boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown,
         uint64_t monThresh = 0);
 
+    /*!
+     * Sets additional region model checkers that analyze regions concurrently with this checker during region refinement.
+     * The workers need to be specified for the same model and check task as this checker and must not share any mutable state with it.
+     * Regions are then analyzed in batches, but the analysis results are processed in the order of the region queue, so the result of the
+     * refinement does not depend on the number of workers. Regions that are analyzed with the help of monotonicity are always analyzed by this checker.
+     */
+    void setRefinementWorkers(std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& workers);
+
+    /*!
+     * Performs the preparations that would otherwise be done lazily upon the first region analysis and that involve objects of the parametric model,
+     * e.g., compiling the parametric functions. This is called for this checker and all workers before regions are analyzed concurrently.
+     */
+    virtual void prepareConcurrentAnalysis();
+
+    /*!
+     * Retrieves a hint obtained from the most recent region analysis for the given optimization direction of the parameters (or nullptr if there
+     * is none). The hint may speed up the analysis of the subregions of the analyzed region.
+     */
+    virtual std::shared_ptr<ModelCheckerHint const> getRegionAnalysisHint(storm::solver::OptimizationDirection const& dirForParameters) const;
+
+    /*!
+     * Sets a hint for the upcoming region analyses for the given optimization direction of the parameters. The hint should be obtained from the
+     * analysis of a superregion (by a checker for the same model and property). Hints only affect the performance but not the result of the analysis.
+     * @param hint the hint or nullptr to clear it.
+     */
+    virtual void setRegionAnalysisHint(storm::solver::OptimizationDirection const& dirForParameters, std::shared_ptr<ModelCheckerHint const> const& hint);
+
     // TODO return type is not quite nice
     // TODO consider returning v' as well
     /*!
@@ -142,6 +172,9 @@ class RegionModelChecker {
     bool useOnlyGlobal = false;
     bool useBounds = false;
 
+    // The checkers that analyze regions concurrently with this checker during region refinement.
+    std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> refinementWorkers;
+
    protected:
     uint_fast64_t numberOfRegionsKnownThroughMonotonicity;
     boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneIncrParameters;
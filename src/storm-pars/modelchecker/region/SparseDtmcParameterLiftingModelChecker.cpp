@@ -286,6 +286,14 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::spec
     solverFactory->setRequirementsChecked(true);
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentAnalysis() {
+    SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentAnalysis();
+    if (parameterLifter) {
+        parameterLifter->compileFunctions();
+    }
+}
+
 template<typename SparseModelType, typename ConstantType>
 storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>&
 SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationCheckerSAT() {
@@ -363,6 +371,17 @@ std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelT
         }
         solver->setTrackScheduler(true);
 
+        // If the region is a subregion of a previously analyzed region, we start from the solution and the scheduler obtained for the latter.
+        // As the solver first solves the system induced by the initial scheduler, the result vector only serves as a starting point.
+        if (auto hint = this->getApplicableRegionAnalysisHint(dirForParameters, maybeStates.getNumberOfSetBits())) {
+            auto& schedChoices = storm::solver::minimize(dirForParameters) ? minSchedChoices : maxSchedChoices;
+            schedChoices = std::vector<uint_fast64_t>(parameterLifter->getRowGroupCount());
+            for (uint_fast64_t state = 0; state < parameterLifter->getRowGroupCount(); ++state) {
+                schedChoices.get()[state] = hint->getSchedulerHint().getChoice(state).getDeterministicChoice();
+            }
+            x = hint->getResultHint();
+        }
+
         if (localMonotonicityResult != nullptr && !this->isOnlyGlobalSet()) {
             storm::storage::BitVector choiceFixedForStates(parameterLifter->getRowGroupCount(), false);
 
@@ -449,6 +468,7 @@ std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelT
         } else {
             maxSchedChoices = solver->getSchedulerChoices();
         }
+        this->storeRegionAnalysisHint(dirForParameters, x, solver->getSchedulerChoices());
         if (isRegionSplitEstimateSupported()) {
             computeRegionSplitEstimates(x, solver->getSchedulerChoices(), region, dirForParameters);
         }
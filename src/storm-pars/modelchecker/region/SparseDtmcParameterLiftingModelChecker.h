@@ -40,6 +40,8 @@ class SparseDtmcParameterLiftingModelChecker : public SparseParameterLiftingMode
     boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMinScheduler();
     boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMaxScheduler();
 
+    virtual void prepareConcurrentAnalysis() override;
+
     virtual bool isRegionSplitEstimateSupported() const override;
     virtual std::map<VariableType, double> getRegionSplitEstimate() const override;
 
@@ -289,6 +289,14 @@ void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::speci
     lowerResultBound = storm::utility::zero<ConstantType>();
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentAnalysis() {
+    SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentAnalysis();
+    if (parameterLifter) {
+        parameterLifter->compileFunctions();
+    }
+}
+
 template<typename SparseModelType, typename ConstantType>
 storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>&
 SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationChecker() {
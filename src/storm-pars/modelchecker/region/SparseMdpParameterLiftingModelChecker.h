@@ -32,6 +32,8 @@ class SparseMdpParameterLiftingModelChecker : public SparseParameterLiftingModel
     void specify_internal(Environment const& env, std::shared_ptr<SparseModelType> parametricModel,
                           CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask, bool skipModelSimplification);
 
+    virtual void prepareConcurrentAnalysis() override;
+
     boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMinScheduler();
     boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMaxScheduler();
     boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentPlayer1Scheduler();
@@ -71,6 +71,8 @@ RegionResult SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::
                     "Analyzing regions with parameter lifting requires a model with a single initial state.");
 
     RegionResult result = initialResult;
+    minimizingOutputHint = nullptr;
+    maximizingOutputHint = nullptr;
 
     // Check if we need to check the formula on one point to decide whether to show AllSat or AllViolated
     if (hypothesis == RegionResultHypothesis::Unknown && result == RegionResult::Unknown) {
@@ -248,6 +250,13 @@ typename SparseModelType::ValueType SparseParameterLiftingModelChecker<SparseMod
             ->template asExplicitQuantitativeCheckResult<ConstantType>()[*this->parametricModel->getInitialStates().begin()]);
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentAnalysis() {
+    getInstantiationChecker().compileFunctions();
+    getInstantiationCheckerSAT().compileFunctions();
+    getInstantiationCheckerVIO().compileFunctions();
+}
+
 template<typename SparseModelType, typename ConstantType>
 storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>&
 SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationCheckerSAT() {
@@ -563,6 +572,55 @@ bool SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::verifyRe
                                         : storm::utility::convertNumber<ConstantType>(res) <= valueToCheck;
 }
 
+template<typename SparseModelType, typename ConstantType>
+std::shared_ptr<ModelCheckerHint const> SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::getRegionAnalysisHint(
+    storm::solver::OptimizationDirection const& dirForParameters) const {
+    return storm::solver::minimize(dirForParameters) ? minimizingOutputHint : maximizingOutputHint;
+}
+
+template<typename SparseModelType, typename ConstantType>
+void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::setRegionAnalysisHint(storm::solver::OptimizationDirection const& dirForParameters,
+                                                                                             std::shared_ptr<ModelCheckerHint const> const& hint) {
+    if (storm::solver::minimize(dirForParameters)) {
+        minimizingInputHint = hint;
+    } else {
+        maximizingInputHint = hint;
+    }
+}
+
+template<typename SparseModelType, typename ConstantType>
+ExplicitModelCheckerHint<ConstantType> const* SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::getApplicableRegionAnalysisHint(
+    storm::solver::OptimizationDirection const& dirForParameters, uint64_t resultSize) const {
+    auto const& hint = storm::solver::minimize(dirForParameters) ? minimizingInputHint : maximizingInputHint;
+    if (!hint || !hint->isExplicitModelCheckerHint()) {
+        return nullptr;
+    }
+    auto const& explicitHint = hint->template asExplicitModelCheckerHint<ConstantType>();
+    if (!explicitHint.hasResultHint() || explicitHint.getResultHint().size() != resultSize || !explicitHint.hasSchedulerHint()) {
+        return nullptr;
+    }
+    return &explicitHint;
+}
+
+template<typename SparseModelType, typename ConstantType>
+void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::storeRegionAnalysisHint(storm::solver::OptimizationDirection const& dirForParameters,
+                                                                                               std::vector<ConstantType> const& result,
+                                                                                               std::vector<uint_fast64_t> const& schedulerChoices) {
+    STORM_LOG_ASSERT(result.size() == schedulerChoices.size(), "Size of the result vector does not match the number of scheduler choices.");
+    storm::storage::Scheduler<ConstantType> scheduler(schedulerChoices.size());
+    for (uint64_t state = 0; state < schedulerChoices.size(); ++state) {
+        scheduler.setChoice(schedulerChoices[state], state);
+    }
+    auto hint = std::make_shared<ExplicitModelCheckerHint<ConstantType>>();
+    hint->setResultHint(result);
+    hint->setSchedulerHint(std::move(scheduler));
+    if (storm::solver::minimize(dirForParameters)) {
+        minimizingOutputHint = std::move(hint);
+    } else {
+        maximizingOutputHint = std::move(hint);
+    }
+}
+
 template<typename SparseModelType, typename ConstantType>
 SparseModelType const& SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::getConsideredParametricModel() const {
     return *parametricModel;
@@ -7,6 +7,7 @@
 
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/CheckTask.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/solver/OptimizationDirection.h"
 
@@ -83,6 +84,22 @@ class SparseParameterLiftingModelChecker : public RegionModelChecker<typename Sp
     virtual bool verifyRegion(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region,
                               storm::logic::Bound const& bound) override;
 
+    /*!
+     * Retrieves the result vector and the scheduler choices computed by the most recent analysis of a region (if any).
+     */
+    virtual std::shared_ptr<ModelCheckerHint const> getRegionAnalysisHint(storm::solver::OptimizationDirection const& dirForParameters) const override;
+
+    /*!
+     * Sets a hint whose result vector and scheduler choices are used to initialize the solver for the upcoming analyses.
+     */
+    virtual void setRegionAnalysisHint(storm::solver::OptimizationDirection const& dirForParameters,
+                                       std::shared_ptr<ModelCheckerHint const> const& hint) override;
+
+    /*!
+     * Creates the instantiation checkers and compiles the parametric functions.
+     */
+    virtual void prepareConcurrentAnalysis() override;
+
     SparseModelType const& getConsideredParametricModel() const;
     CheckTask<storm::logic::Formula, ConstantType> const& getCurrentCheckTask() const;
 
@@ -123,7 +140,25 @@ class SparseParameterLiftingModelChecker : public RegionModelChecker<typename Sp
                         storm::solver::OptimizationDirection const& dir, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonRes);
     std::set<VariableType> possibleMonotoneParameters;
 
+    /*!
+     * Retrieves the hint that has been set for the given direction, provided that it is an explicit hint with a scheduler and a result vector
+     * of the given size. Returns nullptr otherwise.
+     */
+    ExplicitModelCheckerHint<ConstantType> const* getApplicableRegionAnalysisHint(storm::solver::OptimizationDirection const& dirForParameters,
+                                                                                  uint64_t resultSize) const;
+
+    /*!
+     * Stores the given result vector and (deterministic) scheduler choices as a hint for the analysis of subregions of the current region.
+     * Both are expected to refer to the same states.
+     */
+    void storeRegionAnalysisHint(storm::solver::OptimizationDirection const& dirForParameters, std::vector<ConstantType> const& result,
+                                 std::vector<uint_fast64_t> const& schedulerChoices);
+
    private:
+    // The hints that are used for (input) and that are obtained from (output) the analysis of regions.
+    std::shared_ptr<ModelCheckerHint const> minimizingInputHint, maximizingInputHint;
+    std::shared_ptr<ModelCheckerHint const> minimizingOutputHint, maximizingOutputHint;
+
     // store the current formula. Note that currentCheckTask only stores a reference to the formula.
     std::shared_ptr<storm::logic::Formula const> currentFormula;
     std::shared_ptr<storm::analysis::Order> copyOrder(std::shared_ptr<storm::analysis::Order> order);
@@ -29,6 +29,12 @@ bool ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType
     return getImpreciseChecker().canHandle(parametricModel, checkTask) && getPreciseChecker().canHandle(parametricModel, checkTask);
 }
 
+template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
+void ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::prepareConcurrentAnalysis() {
+    getImpreciseChecker().prepareConcurrentAnalysis();
+    getPreciseChecker().prepareConcurrentAnalysis();
+}
+
 template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
 RegionResult ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::analyzeRegion(
     Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResultHypothesis const& hypothesis,
@@ -27,6 +27,7 @@ const std::string DerivativeSettings::printJson = "print-json";
 const std::string DerivativeSettings::gradientDescentMethod = "descent-method";
 const std::string DerivativeSettings::omitInconsequentialParams = "omit-inconsequential-params";
 const std::string DerivativeSettings::constraintMethod = "constraint-method";
+const std::string DerivativeSettings::trajectories = "trajectories";
 
 DerivativeSettings::DerivativeSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, feasibleInstantiationSearch, false,
@@ -84,6 +85,14 @@ DerivativeSettings::DerivativeSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("project-gradient")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, trajectories, false,
+                                                   "Sets the number of gradient descent trajectories that run concurrently from different starting points")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         trajectories, "The number of trajectories. If zero, one trajectory per available core is used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool DerivativeSettings::isFeasibleInstantiationSearchSet() const {
@@ -131,6 +140,10 @@ bool DerivativeSettings::areInconsequentialParametersOmitted() const {
     return this->getOption(omitInconsequentialParams).getHasOptionBeenSet();
 }
 
+uint64_t DerivativeSettings::getNumberOfTrajectories() const {
+    return this->getOption(trajectories).getArgumentByName(trajectories).getValueAsUnsignedInteger();
+}
+
 boost::optional<derivative::GradientDescentConstraintMethod> DerivativeSettings::getConstraintMethod() const {
     return constraintMethodFromString(this->getOption(constraintMethod).getArgumentByName(constraintMethod).getValueAsString());
 }
@@ -86,6 +86,11 @@ class DerivativeSettings : public ModuleSettings {
      */
     bool areInconsequentialParametersOmitted() const;
 
+    /*!
+     * Retrieves the number of gradient descent trajectories that run concurrently. Zero means one trajectory per available core.
+     */
+    uint64_t getNumberOfTrajectories() const;
+
     const static std::string moduleName;
 
    private:
@@ -102,6 +107,7 @@ class DerivativeSettings : public ModuleSettings {
     const static std::string gradientDescentMethod;
     const static std::string omitInconsequentialParams;
     const static std::string constraintMethod;
+    const static std::string trajectories;
     boost::optional<derivative::GradientDescentMethod> methodFromString(const std::string &str) const;
     boost::optional<derivative::GradientDescentConstraintMethod> constraintMethodFromString(const std::string &str) const;
 };
@@ -13,6 +13,7 @@ const std::string PartitionSettings::moduleName = "partitioning";
 const std::string requestedCoverageOptionName = "terminationCondition";
 const std::string printNoIllustrationOptionName = "noillustration";
 const std::string printFullResultOptionName = "printfullresult";
+const std::string numberOfWorkersOptionName = "workers";
 
 PartitionSettings::PartitionSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, requestedCoverageOptionName, false, "The requested coverage")
@@ -31,6 +32,14 @@ PartitionSettings::PartitionSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, printNoIllustrationOptionName, false, "If set, no illustration of the result is printed.").build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, printFullResultOptionName, false, "If set, the full result for every region is printed.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfWorkersOptionName, false,
+                                                   "Sets the number of workers that concurrently analyze regions during refinement.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of workers. If zero, the number is determined based on the available cores.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 double PartitionSettings::getCoverageThreshold() const {
@@ -56,4 +65,8 @@ uint64_t PartitionSettings::getDepthLimit() const {
     return (uint64_t)depth;
 }
 
+uint64_t PartitionSettings::getNumberOfWorkers() const {
+    return this->getOption(numberOfWorkersOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 }  // namespace storm::settings::modules
\ No newline at end of file
@@ -26,6 +26,11 @@ class PartitionSettings : public ModuleSettings {
      */
     uint64_t getDepthLimit() const;
 
+    /*!
+     * Retrieves the number of workers that concurrently analyze regions during refinement. Zero means that the number is determined automatically.
+     */
+    uint64_t getNumberOfWorkers() const;
+
     /*!
      * Retrieves whether no illustration of the result should be printed.
      */
@@ -2,6 +2,7 @@
 
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/ArgumentValidators.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 
@@ -11,6 +12,7 @@ const std::string SamplingSettings::moduleName = "sampling";
 const std::string samplesOptionName = "samples";
 const std::string samplesGraphPreservingOptionName = "samples-graph-preserving";
 const std::string sampleExactOptionName = "sample-exact";
+const std::string batchSizeOptionName = "sample-batch";
 
 SamplingSettings::SamplingSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -25,6 +27,14 @@ SamplingSettings::SamplingSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether it can be assumed that the samples are graph-preserving.")
                         .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, sampleExactOptionName, false, "Sets whether to sample using exact arithmetic.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, true,
+                                                   "Sets the number of samples that are checked at once. Only affects unbounded reachability properties "
+                                                   "on DTMCs and MDPs in non-exact mode.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The number of samples per batch.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 std::string SamplingSettings::getSamples() const {
@@ -38,4 +48,8 @@ bool SamplingSettings::isSamplesAreGraphPreservingSet() const {
 bool SamplingSettings::isSampleExactSet() const {
     return this->getOption(sampleExactOptionName).getHasOptionBeenSet();
 }
+
+uint64_t SamplingSettings::getBatchSize() const {
+    return this->getOption(batchSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
 }  // namespace storm::settings::modules
\ No newline at end of file
@@ -23,6 +23,11 @@ class SamplingSettings : public ModuleSettings {
      */
     bool isSampleExactSet() const;
 
+    /*!
+     * Retrieves the number of samples that are to be checked at once.
+     */
+    uint64_t getBatchSize() const;
+
     static const std::string moduleName;
 };
 
@@ -193,6 +193,11 @@ uint_fast64_t ParameterLifter<ParametricType, ConstantType>::getRowGroupCount()
     return matrix.getRowGroupCount();
 }
 
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::compileFunctions() {
+    functionValuationCollector.compileCollectedFunctions();
+}
+
 template<typename ParametricType, typename ConstantType>
 storm::storage::SparseMatrix<ConstantType> const& ParameterLifter<ParametricType, ConstantType>::getMatrix() const {
     return matrix;
@@ -343,22 +348,74 @@ ConstantType& ParameterLifter<ParametricType, ConstantType>::FunctionValuationCo
     // Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
     auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, ConstantType>(
         FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), storm::utility::one<ConstantType>()));
+    // The compiled functions need to be rebuilt before the next evaluation.
+    compiledFunctions.clear();
     return insertionRes.first->second;
 }
 
 template<typename ParametricType, typename ConstantType>
-void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(
-    storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+    if (compiledFunctions.size() == collectedFunctions.size()) {
+        return;
+    }
+    std::set<VariableType> variableSet;
+    for (auto const& collectedFunctionValuationPlaceholder : collectedFunctions) {
+        storm::utility::parametric::gatherOccurringVariables(collectedFunctionValuationPlaceholder.first.first, variableSet);
+    }
+    variables.assign(variableSet.begin(), variableSet.end());
+    auto variableIndices = storm::utility::getVariableIndices(variables);
+
+    compiledFunctions.clear();
+    compiledFunctions.reserve(collectedFunctions.size());
+    auto toIndices = [&variableIndices](std::set<VariableType> const& parameters) {
+        std::vector<uint64_t> result;
+        for (auto const& parameter : parameters) {
+            result.push_back(variableIndices.at(parameter));
+        }
+        return result;
+    };
     for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
-        ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
         AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
-        ConstantType& placeholder = collectedFunctionValuationPlaceholder.second;
-        auto concreteValuations = abstrValuation.getConcreteValuations(region);
-        auto concreteValuationIt = concreteValuations.begin();
-        placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-        for (++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
-            ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-            if (storm::solver::minimize(dirForUnspecifiedParameters)) {
+        compiledFunctions.push_back({storm::utility::CompiledRationalFunction<ConstantType>(collectedFunctionValuationPlaceholder.first.first, variableIndices),
+                                     toIndices(abstrValuation.getLowerParameters()), toIndices(abstrValuation.getUpperParameters()),
+                                     toIndices(abstrValuation.getUnspecifiedParameters()), &collectedFunctionValuationPlaceholder.second});
+    }
+}
+
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(
+    storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+    compileCollectedFunctions();
+
+    // Convert the boundaries of the region only once.
+    std::vector<ConstantType> lowerBoundaries, upperBoundaries;
+    lowerBoundaries.reserve(variables.size());
+    upperBoundaries.reserve(variables.size());
+    for (auto const& variable : variables) {
+        lowerBoundaries.push_back(storm::utility::convertNumber<ConstantType>(region.getLowerBoundary(variable)));
+        upperBoundaries.push_back(storm::utility::convertNumber<ConstantType>(region.getUpperBoundary(variable)));
+    }
+
+    std::vector<ConstantType> variableValues(variables.size());
+    for (auto const& compiledFunction : compiledFunctions) {
+        for (auto const& variable : compiledFunction.lowerVariables) {
+            variableValues[variable] = lowerBoundaries[variable];
+        }
+        for (auto const& variable : compiledFunction.upperVariables) {
+            variableValues[variable] = upperBoundaries[variable];
+        }
+        // Consider every vertex of the region spanned by the unspecified parameters.
+        uint64_t const numberOfVertices = 1ull << compiledFunction.unspecifiedVariables.size();
+        ConstantType& placeholder = *compiledFunction.placeholder;
+        for (uint64_t vertex = 0; vertex < numberOfVertices; ++vertex) {
+            for (uint64_t i = 0; i < compiledFunction.unspecifiedVariables.size(); ++i) {
+                uint64_t const variable = compiledFunction.unspecifiedVariables[i];
+                variableValues[variable] = ((vertex >> i) & 1) ? upperBoundaries[variable] : lowerBoundaries[variable];
+            }
+            ConstantType currentResult = compiledFunction.function.evaluate(variableValues);
+            if (vertex == 0) {
+                placeholder = std::move(currentResult);
+            } else if (storm::solver::minimize(dirForUnspecifiedParameters)) {
                 placeholder = std::min(placeholder, currentResult);
             } else {
                 placeholder = std::max(placeholder, currentResult);
@@ -7,6 +7,7 @@
 
 #include "storm-pars/analysis/Order.h"
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/CompiledRationalFunction.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/BitVector.h"
@@ -67,6 +68,12 @@ class ParameterLifter {
                        std::shared_ptr<storm::analysis::Order> reachabilityOrder,
                        std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult);
 
+    /*!
+     * Prepares the evaluation of the parametric functions which otherwise happens when the first region is specified.
+     * Afterwards, lifters of the same model can be used in parallel.
+     */
+    void compileFunctions();
+
     // Returns the resulting matrix. Should only be called AFTER specifying a region
     storm::storage::SparseMatrix<ConstantType> const& getMatrix() const;
 
@@ -141,6 +148,11 @@ class ParameterLifter {
         void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region,
                                         storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
 
+        /*!
+         * Compiles all collected functions unless this has been done already. This is done at the latest before the first evaluation.
+         */
+        void compileCollectedFunctions();
+
        private:
         // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
         typedef std::pair<ParametricType, AbstractValuation> FunctionValuation;
@@ -157,6 +169,17 @@ class ParameterLifter {
 
         // Stores the collected functions with the valuations together with a placeholder for the result.
         std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+
+        // A collected function compiled for evaluation. The parameters of the valuation are given as indices into the variable table.
+        struct CompiledFunctionValuation {
+            storm::utility::CompiledRationalFunction<ConstantType> function;
+            std::vector<uint64_t> lowerVariables, upperVariables, unspecifiedVariables;
+            ConstantType* placeholder;
+        };
+
+        // The variables occurring in the collected functions and the compiled functions. Empty until the first evaluation.
+        std::vector<VariableType> variables;
+        std::vector<CompiledFunctionValuation> compiledFunctions;
     };
 
     FunctionValuationCollector functionValuationCollector;
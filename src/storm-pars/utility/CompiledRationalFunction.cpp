@@ -0,0 +1,85 @@
+#include "storm-pars/utility/CompiledRationalFunction.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+#ifdef STORM_HAVE_CARL
+template<typename ValueType>
+CompiledRationalFunction<ValueType>::CompiledRationalFunction(storm::RationalFunction const& function,
+                                                              std::map<VariableType, uint64_t> const& variableIndices) {
+    termIndications.push_back(0);
+    auto denominator = function.denominator().polynomialWithCoefficient();
+    if (denominator.isConstant()) {
+        addTerms(function.nominator().polynomialWithCoefficient(), denominator.constantPart(), variableIndices);
+        numberOfNumeratorTerms = coefficients.size();
+    } else {
+        addTerms(function.nominator().polynomialWithCoefficient(), storm::utility::one<storm::RationalFunctionCoefficient>(), variableIndices);
+        numberOfNumeratorTerms = coefficients.size();
+        addTerms(denominator, storm::utility::one<storm::RationalFunctionCoefficient>(), variableIndices);
+    }
+    std::sort(occurringVariables.begin(), occurringVariables.end());
+    occurringVariables.erase(std::unique(occurringVariables.begin(), occurringVariables.end()), occurringVariables.end());
+}
+
+template<typename ValueType>
+void CompiledRationalFunction<ValueType>::addTerms(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& divisor,
+                                                   std::map<VariableType, uint64_t> const& variableIndices) {
+    for (auto const& term : polynomial) {
+        coefficients.push_back(storm::utility::convertNumber<ValueType>(storm::RationalFunctionCoefficient(term.coeff() / divisor)));
+        if (term.monomial()) {
+            for (auto const& variableExponent : *term.monomial()) {
+                auto indexIt = variableIndices.find(variableExponent.first);
+                STORM_LOG_THROW(indexIt != variableIndices.end(), storm::exceptions::InvalidArgumentException,
+                                "No index for variable " << variableExponent.first << " given.");
+                factorVariables.push_back(indexIt->second);
+                factorExponents.push_back(variableExponent.second);
+                occurringVariables.push_back(indexIt->second);
+            }
+        }
+        termIndications.push_back(factorVariables.size());
+    }
+}
+
+template<typename ValueType>
+ValueType CompiledRationalFunction<ValueType>::evaluate(std::vector<ValueType> const& variableValues) const {
+    ValueType result = evaluateTerms(0, numberOfNumeratorTerms, variableValues);
+    if (numberOfNumeratorTerms < coefficients.size()) {
+        result /= evaluateTerms(numberOfNumeratorTerms, coefficients.size(), variableValues);
+    }
+    return result;
+}
+
+template<typename ValueType>
+ValueType CompiledRationalFunction<ValueType>::evaluateTerms(uint64_t firstTerm, uint64_t endTerm, std::vector<ValueType> const& variableValues) const {
+    ValueType result = storm::utility::zero<ValueType>();
+    for (uint64_t term = firstTerm; term < endTerm; ++term) {
+        ValueType termValue = coefficients[term];
+        for (uint64_t factor = termIndications[term]; factor < termIndications[term + 1]; ++factor) {
+            ValueType const& base = variableValues[factorVariables[factor]];
+            for (uint64_t exponent = factorExponents[factor]; exponent > 0; --exponent) {
+                termValue *= base;
+            }
+        }
+        result += termValue;
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> const& CompiledRationalFunction<ValueType>::getOccurringVariables() const {
+    return occurringVariables;
+}
+
+template class CompiledRationalFunction<double>;
+template class CompiledRationalFunction<storm::RationalNumber>;
+#endif
+
+}  // namespace utility
+}  // namespace storm
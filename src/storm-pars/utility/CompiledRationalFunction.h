@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+#include "storm/adapters/RationalFunctionForward.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * A rational function that is compiled into a flat representation which can be evaluated repeatedly in the given arithmetic without
+ * going through carl. Numerator and denominator are stored as sequences of terms, where each term consists of a coefficient and a list of
+ * (variable, exponent) factors. Variables are referred to by their index in a fixed variable table, such that a valuation is just a vector of values.
+ *
+ * A constant denominator is folded into the coefficients of the numerator (using exact arithmetic).
+ */
+template<typename ValueType>
+class CompiledRationalFunction {
+   public:
+    typedef typename storm::utility::parametric::VariableType<storm::RationalFunction>::type VariableType;
+
+    /*!
+     * Compiles the given function.
+     * @param function The function to compile.
+     * @param variableIndices The index of each variable of the function in the variable table.
+     */
+    CompiledRationalFunction(storm::RationalFunction const& function, std::map<VariableType, uint64_t> const& variableIndices);
+
+    /*!
+     * Evaluates the function.
+     * @param variableValues The value of each variable, ordered as in the variable table. Only the entries of occurring variables are accessed.
+     */
+    ValueType evaluate(std::vector<ValueType> const& variableValues) const;
+
+    /*!
+     * Retrieves the indices of the variables that occur in the function.
+     */
+    std::vector<uint64_t> const& getOccurringVariables() const;
+
+   private:
+    void addTerms(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& divisor,
+                  std::map<VariableType, uint64_t> const& variableIndices);
+    ValueType evaluateTerms(uint64_t firstTerm, uint64_t endTerm, std::vector<ValueType> const& variableValues) const;
+
+    // The terms of the numerator are followed by the ones of the denominator (if the denominator is not constant).
+    uint64_t numberOfNumeratorTerms;
+    std::vector<ValueType> coefficients;
+    std::vector<uint64_t> termIndications;
+    std::vector<uint64_t> factorVariables;
+    std::vector<uint64_t> factorExponents;
+
+    std::vector<uint64_t> occurringVariables;
+};
+
+/*!
+ * Assigns an index to each of the given variables (in their given order).
+ */
+template<typename VariableType>
+std::map<VariableType, uint64_t> getVariableIndices(std::vector<VariableType> const& variables) {
+    std::map<VariableType, uint64_t> result;
+    for (uint64_t index = 0; index < variables.size(); ++index) {
+        result.emplace(variables[index], index);
+    }
+    return result;
+}
+
+}  // namespace utility
+}  // namespace storm
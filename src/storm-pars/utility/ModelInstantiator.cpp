@@ -139,6 +139,11 @@ void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::init
     STORM_LOG_ASSERT(constantEntryIt == constantVector.end(), "Parametric vector seems to have more or less entries then the constant vector");
 }
 
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::compileFunctions() {
+    compile_helper();
+}
+
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
 ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(
     storm::utility::parametric::Valuation<ParametricType> const& valuation) {
@@ -2,16 +2,21 @@
 #define STORM_UTILITY_MODELINSTANTIATOR_H
 
 #include <memory>
+#include <set>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
+#include "storm-pars/utility/CompiledRationalFunction.h"
 #include "storm-pars/utility/parametric.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StochasticTwoPlayerGame.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
 
 namespace storm {
 namespace utility {
@@ -47,6 +52,12 @@ class ModelInstantiator {
      */
     ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
 
+    /*!
+     * Compiles the occurring functions if this has not been done before.
+     * This otherwise happens upon the first instantiation. Calling it beforehand allows to use instantiators of the same model in parallel.
+     */
+    void compileFunctions();
+
     /*!
      *  Check validity
      */
@@ -121,11 +132,42 @@ class ModelInstantiator {
         }
     }
 
+    template<typename PMT = ParametricSparseModelType>
+    typename std::enable_if<std::is_same<PMT, ConstantSparseModelType>::value>::type compile_helper() {
+        // Nothing to compile
+    }
+
+    template<typename PMT = ParametricSparseModelType>
+    typename std::enable_if<!std::is_same<PMT, ConstantSparseModelType>::value>::type compile_helper() {
+        if (this->compiledFunctions.empty() && !this->functions.empty()) {
+            std::set<VariableType> variableSet;
+            for (auto const& functionResult : this->functions) {
+                storm::utility::parametric::gatherOccurringVariables(functionResult.first, variableSet);
+            }
+            this->variables.assign(variableSet.begin(), variableSet.end());
+            auto variableIndices = storm::utility::getVariableIndices(this->variables);
+            this->compiledFunctions.reserve(this->functions.size());
+            for (auto& functionResult : this->functions) {
+                this->compiledFunctions.emplace_back(CompiledRationalFunction<ConstantType>(functionResult.first, variableIndices), &functionResult.second);
+            }
+            this->variableValues.resize(this->variables.size());
+        }
+    }
+
     template<typename PMT = ParametricSparseModelType>
     typename std::enable_if<!std::is_same<PMT, ConstantSparseModelType>::value>::type instantiate_helper(
         storm::utility::parametric::Valuation<ParametricType> const& valuation) {
-        for (auto& functionResult : this->functions) {
-            functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
+        // Compile the functions upon the first instantiation.
+        compile_helper();
+
+        for (uint64_t i = 0; i < this->variables.size(); ++i) {
+            auto valueIt = valuation.find(this->variables[i]);
+            STORM_LOG_THROW(valueIt != valuation.end(), storm::exceptions::InvalidArgumentException,
+                            "No value for parameter " << this->variables[i] << " given.");
+            this->variableValues[i] = storm::utility::convertNumber<ConstantType>(valueIt->second);
+        }
+        for (auto& compiledFunction : this->compiledFunctions) {
+            *compiledFunction.second = compiledFunction.first.evaluate(this->variableValues);
         }
     }
 
@@ -178,6 +220,11 @@ class ModelInstantiator {
     std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping;
     /// Connection of Vector entries with placeholders
     std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping;
+    /// The occurring variables, the compiled functions with their placeholders and a buffer for the values of the variables
+    /// (only used for non-parametric instantiations)
+    std::vector<VariableType> variables;
+    std::vector<std::pair<CompiledRationalFunction<ConstantType>, ConstantType*>> compiledFunctions;
+    std::vector<ConstantType> variableValues;
 };
 }  // Namespace utility
 }  // namespace storm
@@ -16,6 +16,9 @@ const std::string BeliefExplorationSettings::moduleName = "beliefExploration";
 
 const std::string refineOption = "refine";
 const std::string explorationTimeLimitOption = "exploration-time";
+const std::string explorationThreadsOption = "exploration-threads";
+const std::string incrementalValuesOption = "incremental-values";
+const std::string pointBasedOption = "point-based";
 const std::string resolutionOption = "resolution";
 const std::string clipGridResolutionOption = "clip-resolution";
 const std::string sizeThresholdOption = "size-threshold";
@@ -48,6 +51,36 @@ BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleNa
             .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "In seconds.").setDefaultValueUnsignedInteger(0).build())
             .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOption, false,
+                                                   "Sets the number of threads that compute belief successors during exploration.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number is determined based on the available cores.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, incrementalValuesOption, false,
+                                                   "After refining, only re-computes the values of beliefs whose reachable part of the belief MDP changed.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, pointBasedOption, false,
+                                       "Improves the value bounds obtained during preprocessing using point-based value iteration on sampled beliefs.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("iterations", "The maximal number of iterations.")
+                             .setDefaultValueUnsignedInteger(20)
+                             .makeOptional()
+                             .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("beliefs", "The number of sampled beliefs.")
+                             .setDefaultValueUnsignedInteger(100)
+                             .makeOptional()
+                             .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .build());
+
     this->addOption(
         storm::settings::OptionBuilder(moduleName, resolutionOption, false,
                                        "Sets the resolution of the discretization and how it is increased in case of refinement")
@@ -181,6 +214,26 @@ uint64_t BeliefExplorationSettings::getExplorationTimeLimit() const {
     return this->getOption(explorationTimeLimitOption).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+uint64_t BeliefExplorationSettings::getExplorationThreads() const {
+    return this->getOption(explorationThreadsOption).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool BeliefExplorationSettings::isIncrementalValuesSet() const {
+    return this->getOption(incrementalValuesOption).getHasOptionBeenSet();
+}
+
+bool BeliefExplorationSettings::isPointBasedSet() const {
+    return this->getOption(pointBasedOption).getHasOptionBeenSet();
+}
+
+uint64_t BeliefExplorationSettings::getPointBasedIterations() const {
+    return this->getOption(pointBasedOption).getArgumentByName("iterations").getValueAsUnsignedInteger();
+}
+
+uint64_t BeliefExplorationSettings::getPointBasedBeliefs() const {
+    return this->getOption(pointBasedOption).getArgumentByName("beliefs").getValueAsUnsignedInteger();
+}
+
 uint64_t BeliefExplorationSettings::getResolutionInit() const {
     return this->getOption(resolutionOption).getArgumentByName("init").getValueAsUnsignedInteger();
 }
@@ -255,6 +308,10 @@ void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchec
     options.refinePrecision = storm::utility::convertNumber<ValueType>(getRefinePrecision());
     options.refineStepLimit = getRefineStepLimit();
     options.explorationTimeLimit = getExplorationTimeLimit();
+    options.explorationThreads = getExplorationThreads();
+    options.incrementalValueComputation = isIncrementalValuesSet();
+    options.pointBasedIterations = isPointBasedSet() ? getPointBasedIterations() : 0;
+    options.pointBasedBeliefs = getPointBasedBeliefs();
 
     options.clippingGridRes = getClippingGridResolution();
     options.resolutionInit = getResolutionInit();
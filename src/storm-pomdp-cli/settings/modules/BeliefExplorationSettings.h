@@ -39,6 +39,17 @@ class BeliefExplorationSettings : public ModuleSettings {
 
     uint64_t getExplorationTimeLimit() const;
 
+    /// The number of threads that compute belief successors during exploration (0 means one thread per core)
+    uint64_t getExplorationThreads() const;
+
+    /// Whether values of beliefs whose reachable part of the belief MDP did not change are re-used after refining
+    bool isIncrementalValuesSet() const;
+
+    /// Point-based value iteration that improves the value bounds obtained during preprocessing
+    bool isPointBasedSet() const;
+    uint64_t getPointBasedIterations() const;
+    uint64_t getPointBasedBeliefs() const;
+
     /// Discretization Resolution
     uint64_t getResolutionInit() const;
     double getResolutionFactor() const;
@@ -4,6 +4,10 @@
 #include "storm/api/properties.h"
 #include "storm/api/verification.h"
 
+#include <unordered_map>
+
+#include "storm/environment/solver/SolverEnvironment.h"
+
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
@@ -235,6 +239,18 @@ std::vector<uint64_t> BeliefMdpExplorer<PomdpType, BeliefValueType>::getUnexplor
     return res;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getNextUnexploredBeliefs(
+    uint64_t maxNumberOfBeliefs) const {
+    STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+    std::vector<BeliefId> res;
+    // States are taken from the back of the queue.
+    for (auto stateIt = mdpStatesToExplorePrioState.rbegin(); stateIt != mdpStatesToExplorePrioState.rend() && res.size() < maxNumberOfBeliefs; ++stateIt) {
+        res.push_back(mdpStateToBeliefIdMap[stateIt->second]);
+    }
+    return res;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplorer<PomdpType, BeliefValueType>::exploreNextState() {
     STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
@@ -915,24 +931,246 @@ template<typename PomdpType, typename BeliefValueType>
 void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir) {
     STORM_LOG_ASSERT(status == Status::ModelFinished, "Method call is invalid in current status.");
     STORM_LOG_ASSERT(exploredMdp, "Tried to compute values but the MDP is not explored");
-    auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
-    auto task = createStandardCheckTask(property);
-
-    std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, exploredMdp, task));
-    if (res) {
-        values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
-        scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler());
+    bool useIncrementalComputation = incrementalValueComputation && previousValueComputation.has_value() && previousValueComputation->dir == dir &&
+                                     !env.solver().isForceSoundness() && !env.solver().isForceExact();
+    bool valuesComputed = useIncrementalComputation && computeValuesOfExploredMdpIncrementally(env, dir);
+    if (!valuesComputed) {
+        auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
+        auto task = createStandardCheckTask(property);
+
+        std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, exploredMdp, task));
+        if (res) {
+            values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+            scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler());
+            valuesComputed = true;
+        } else {
+            STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
+            STORM_LOG_ERROR("No result obtained while checking.");
+        }
+    }
+    if (valuesComputed) {
         STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
                                   "Computed values are smaller than the lower bound.");
         STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
                                   "Computed values are larger than the upper bound.");
+        if (incrementalValueComputation) {
+            PreviousValueComputation previous;
+            previous.mdp = exploredMdp;
+            previous.mdpStateToBeliefIdMap = mdpStateToBeliefIdMap;
+            previous.extraTargetState = extraTargetState;
+            previous.extraBottomState = extraBottomState;
+            previous.values = values;
+            previous.scheduler = scheduler;
+            if (exploredMdp->hasRewardModel()) {
+                previous.totalRewards = exploredMdp->getUniqueRewardModel().getTotalRewardVector(exploredMdp->getTransitionMatrix());
+            }
+            previous.dir = dir;
+            previousValueComputation = std::move(previous);
+        }
     } else {
-        STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
-        STORM_LOG_ERROR("No result obtained while checking.");
+        previousValueComputation = std::nullopt;
     }
     status = Status::ModelChecked;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+bool BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdpIncrementally(storm::Environment const &env,
+                                                                                       storm::solver::OptimizationDirection const &dir) {
+    PreviousValueComputation const &previous = previousValueComputation.value();
+    bool computeRewards = exploredMdp->hasRewardModel();
+    if (computeRewards != previous.mdp->hasRewardModel()) {
+        return false;
+    }
+    auto const &transitionMatrix = exploredMdp->getTransitionMatrix();
+    auto const &previousTransitionMatrix = previous.mdp->getTransitionMatrix();
+    storm::storage::BitVector const &targets = exploredMdp->getStates("target");
+    storm::storage::BitVector const &previousTargets = previous.mdp->getStates("target");
+    std::vector<ValueType> totalRewards;
+    if (computeRewards) {
+        totalRewards = exploredMdp->getUniqueRewardModel().getTotalRewardVector(transitionMatrix);
+    }
+    uint64_t const numberOfStates = exploredMdp->getNumberOfStates();
+
+    // Find the state of the previous MDP that corresponds to each state (if any).
+    std::unordered_map<BeliefId, MdpStateType> previousBeliefIdToMdpStateMap;
+    for (MdpStateType previousState = 0; previousState < previous.mdpStateToBeliefIdMap.size(); ++previousState) {
+        if (previous.mdpStateToBeliefIdMap[previousState] != beliefManager->noId()) {
+            previousBeliefIdToMdpStateMap.emplace(previous.mdpStateToBeliefIdMap[previousState], previousState);
+        }
+    }
+    std::vector<MdpStateType> toPreviousState(numberOfStates, noState());
+    for (MdpStateType state = 0; state < numberOfStates; ++state) {
+        if (state == extraTargetState) {
+            toPreviousState[state] = previous.extraTargetState.value_or(noState());
+        } else if (state == extraBottomState) {
+            toPreviousState[state] = previous.extraBottomState.value_or(noState());
+        } else {
+            auto previousStateIt = previousBeliefIdToMdpStateMap.find(mdpStateToBeliefIdMap[state]);
+            if (previousStateIt != previousBeliefIdToMdpStateMap.end()) {
+                toPreviousState[state] = previousStateIt->second;
+            }
+        }
+    }
+
+    // Find the states whose behavior (i.e. their choices, transitions, rewards, and target status) changed.
+    storm::storage::BitVector changedStates(numberOfStates, false);
+    for (MdpStateType state = 0; state < numberOfStates; ++state) {
+        MdpStateType previousState = toPreviousState[state];
+        if (previousState == noState() || targets.get(state) != previousTargets.get(previousState) ||
+            transitionMatrix.getRowGroupSize(state) != previousTransitionMatrix.getRowGroupSize(previousState)) {
+            changedStates.set(state, true);
+            continue;
+        }
+        for (uint64_t localChoice = 0; localChoice < transitionMatrix.getRowGroupSize(state) && !changedStates.get(state); ++localChoice) {
+            uint64_t choice = transitionMatrix.getRowGroupIndices()[state] + localChoice;
+            uint64_t previousChoice = previousTransitionMatrix.getRowGroupIndices()[previousState] + localChoice;
+            if (computeRewards && totalRewards[choice] != previous.totalRewards[previousChoice]) {
+                changedStates.set(state, true);
+                break;
+            }
+            auto row = transitionMatrix.getRow(choice);
+            auto previousRow = previousTransitionMatrix.getRow(previousChoice);
+            if (row.getNumberOfEntries() != previousRow.getNumberOfEntries()) {
+                changedStates.set(state, true);
+                break;
+            }
+            // Entries are only considered equal if they appear in the same order. This might miss some unchanged rows, which is fine.
+            auto previousEntryIt = previousRow.begin();
+            for (auto const &entry : row) {
+                if (toPreviousState[entry.getColumn()] != previousEntryIt->getColumn() || entry.getValue() != previousEntryIt->getValue()) {
+                    changedStates.set(state, true);
+                    break;
+                }
+                ++previousEntryIt;
+            }
+        }
+    }
+
+    // The values of the states that can not reach a changed state without visiting a target state remain the same.
+    storm::storage::BitVector affectedStates =
+        storm::utility::graph::performProbGreater0E(exploredMdp->getBackwardTransitions(), ~targets, changedStates);
+    if (affectedStates.full()) {
+        return false;
+    }
+    std::vector<ValueType> newValues(numberOfStates, storm::utility::zero<ValueType>());
+    auto newScheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(numberOfStates);
+    for (auto state : ~affectedStates) {
+        newValues[state] = previous.values[toPreviousState[state]];
+        if (computeRewards && storm::utility::isInfinity(newValues[state])) {
+            // Infinite values can not be encoded in the reduced MDP below.
+            return false;
+        }
+        newScheduler->setChoice(previous.scheduler->getChoice(toPreviousState[state]), state);
+    }
+    STORM_LOG_INFO("Re-using the values of " << numberOfStates - affectedStates.getNumberOfSetBits() << " of " << numberOfStates
+                                             << " states of the explored MDP.");
+
+    if (!affectedStates.empty()) {
+        // Build an MDP that only consists of the affected states. Transitions to other states are redirected to an absorbing goal state
+        // (and an absorbing sink state) such that the value of each affected state is preserved.
+        uint64_t const numberOfAffectedStates = affectedStates.getNumberOfSetBits();
+        MdpStateType const goalState = numberOfAffectedStates;
+        MdpStateType const sinkState = numberOfAffectedStates + 1;
+        uint64_t const numberOfSubStates = computeRewards ? numberOfAffectedStates + 1 : numberOfAffectedStates + 2;
+        auto toSubState = affectedStates.getNumberOfSetBitsBeforeIndices();
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, numberOfSubStates, 0, false, true, numberOfSubStates);
+        std::vector<ValueType> subRewards;
+        storm::storage::BitVector subTargets(numberOfSubStates, false);
+        uint64_t subChoice = 0;
+        for (auto state : affectedStates) {
+            builder.newRowGroup(subChoice);
+            subTargets.set(toSubState[state], targets.get(state));
+            for (uint64_t choice = transitionMatrix.getRowGroupIndices()[state]; choice < transitionMatrix.getRowGroupIndices()[state + 1]; ++choice) {
+                ValueType goalProbability = storm::utility::zero<ValueType>();
+                ValueType sinkProbability = storm::utility::zero<ValueType>();
+                ValueType reward = computeRewards ? totalRewards[choice] : storm::utility::zero<ValueType>();
+                for (auto const &entry : transitionMatrix.getRow(choice)) {
+                    if (affectedStates.get(entry.getColumn())) {
+                        builder.addNextValue(subChoice, toSubState[entry.getColumn()], entry.getValue());
+                    } else if (computeRewards) {
+                        goalProbability += entry.getValue();
+                        reward += entry.getValue() * newValues[entry.getColumn()];
+                    } else {
+                        goalProbability += entry.getValue() * newValues[entry.getColumn()];
+                        sinkProbability += entry.getValue() * (storm::utility::one<ValueType>() - newValues[entry.getColumn()]);
+                    }
+                }
+                if (!storm::utility::isZero(goalProbability)) {
+                    builder.addNextValue(subChoice, goalState, goalProbability);
+                }
+                if (!storm::utility::isZero(sinkProbability)) {
+                    builder.addNextValue(subChoice, sinkState, sinkProbability);
+                }
+                if (computeRewards) {
+                    subRewards.push_back(reward);
+                }
+                ++subChoice;
+            }
+        }
+        subTargets.set(goalState, true);
+        for (MdpStateType absorbingState = goalState; absorbingState < numberOfSubStates; ++absorbingState) {
+            builder.newRowGroup(subChoice);
+            builder.addNextValue(subChoice, absorbingState, storm::utility::one<ValueType>());
+            if (computeRewards) {
+                subRewards.push_back(storm::utility::zero<ValueType>());
+            }
+            ++subChoice;
+        }
+
+        storm::models::sparse::StateLabeling subLabeling(numberOfSubStates);
+        subLabeling.addLabel("init");
+        uint64_t initialState = exploredMdp->getInitialStates().getNextSetIndex(0);
+        subLabeling.addLabelToState("init", affectedStates.get(initialState) ? toSubState[initialState] : goalState);
+        subLabeling.addLabel("target", std::move(subTargets));
+        std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> subRewardModels;
+        if (computeRewards) {
+            subRewardModels.emplace(
+                "default", storm::models::sparse::StandardRewardModel<ValueType>(std::optional<std::vector<ValueType>>(), std::move(subRewards)));
+        }
+        storm::storage::sparse::ModelComponents<ValueType> subModelComponents(builder.build(subChoice, numberOfSubStates, numberOfSubStates),
+                                                                              std::move(subLabeling), std::move(subRewardModels));
+        auto subMdp = std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(subModelComponents));
+
+        // Use the current estimates as hint
+        auto property = createStandardProperty(dir, computeRewards);
+        auto task = storm::api::createTask<ValueType>(property, false);
+        if (values.size() == numberOfStates) {
+            std::vector<ValueType> subValueHint = storm::utility::vector::filterVector(values, affectedStates);
+            subValueHint.push_back(computeRewards ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>());
+            if (!computeRewards) {
+                subValueHint.push_back(storm::utility::zero<ValueType>());
+            }
+            auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>();
+            hint->setResultHint(subValueHint);
+            task.setHint(hint);
+        }
+        task.setProduceSchedulers();
+
+        std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, subMdp, task));
+        if (!res) {
+            STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
+            STORM_LOG_ERROR("No result obtained while checking.");
+            return false;
+        }
+        auto const &subResult = res->asExplicitQuantitativeCheckResult<ValueType>();
+        for (auto state : affectedStates) {
+            newValues[state] = subResult[toSubState[state]];
+            newScheduler->setChoice(subResult.getScheduler().getChoice(toSubState[state]), state);
+        }
+    }
+    values = std::move(newValues);
+    scheduler = std::move(newScheduler);
+    return true;
+}
+
+template<typename PomdpType, typename BeliefValueType>
+void BeliefMdpExplorer<PomdpType, BeliefValueType>::setIncrementalValueComputation(bool value) {
+    incrementalValueComputation = value;
+    if (!value) {
+        previousValueComputation = std::nullopt;
+    }
+}
+
 template<typename PomdpType, typename BeliefValueType>
 bool BeliefMdpExplorer<PomdpType, BeliefValueType>::hasComputedValues() const {
     return status == Status::ModelChecked;
@@ -1314,12 +1552,13 @@ storm::storage::BitVector BeliefMdpExplorer<PomdpType, BeliefValueType>::getStat
 
 template<typename PomdpType, typename BeliefValueType>
 uint64_t BeliefMdpExplorer<PomdpType, BeliefValueType>::getNrSchedulersForUpperBounds() {
-    return pomdpValueBounds.upper.size();
+    // There might be more bounds than schedulers (e.g. due to point-based value iteration). The bounds of the schedulers come first.
+    return pomdpValueBounds.upperSchedulers.size();
 }
 
 template<typename PomdpType, typename BeliefValueType>
 uint64_t BeliefMdpExplorer<PomdpType, BeliefValueType>::getNrSchedulersForLowerBounds() {
-    return pomdpValueBounds.lower.size();
+    return pomdpValueBounds.lowerSchedulers.size();
 }
 
 template<typename PomdpType, typename BeliefValueType>
@@ -63,6 +63,12 @@ class BeliefMdpExplorer {
 
     std::vector<uint64_t> getUnexploredStates();
 
+    /*!
+     * Retrieves the beliefs of the states that are currently queued for exploration, in the order in which they would be explored.
+     * @param maxNumberOfBeliefs The maximal number of beliefs to retrieve.
+     */
+    std::vector<BeliefId> getNextUnexploredBeliefs(uint64_t maxNumberOfBeliefs) const;
+
     BeliefId exploreNextState();
 
     void addChoiceLabelToCurrentState(uint64_t const &localActionIndex, std::string const &label);
@@ -182,6 +188,13 @@ class BeliefMdpExplorer {
 
     void computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir);
 
+    /*!
+     * Sets whether values are computed incrementally (disabled by default).
+     * If enabled, the values and scheduler choices of states whose reachable part of the explored MDP did not change since the previous value
+     * computation are taken over and only the remaining states are solved again. This is not done if the environment requires sound or exact results.
+     */
+    void setIncrementalValueComputation(bool value);
+
     bool hasComputedValues() const;
 
     bool hasFMSchedulerValues() const;
@@ -272,6 +285,13 @@ class BeliefMdpExplorer {
 
     void insertValueHints(ValueType const &lowerBound, ValueType const &upperBound);
 
+    /*!
+     * Computes the values of the explored MDP, taking over the results of the previous value computation at all states whose reachable part of the MDP
+     * did not change. The values of the remaining states are computed on an MDP that only consists of these states (and two absorbing states).
+     * @return false if the previous results could not be used. In this case, nothing is computed.
+     */
+    bool computeValuesOfExploredMdpIncrementally(storm::Environment const &env, storm::solver::OptimizationDirection const &dir);
+
     MdpStateType getOrAddMdpState(BeliefId const &beliefId, ValueType const &transitionValue = storm::utility::zero<ValueType>());
 
     // Belief state related information
@@ -319,6 +339,20 @@ class BeliefMdpExplorer {
     std::optional<storm::storage::BitVector> optimalChoicesReachableMdpStates;
     std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
 
+    // Information about the most recent value computation that is used to compute the values of the next explored MDP incrementally
+    struct PreviousValueComputation {
+        std::shared_ptr<storm::models::sparse::Mdp<ValueType>> mdp;
+        std::vector<BeliefId> mdpStateToBeliefIdMap;
+        std::optional<MdpStateType> extraTargetState;
+        std::optional<MdpStateType> extraBottomState;
+        std::vector<ValueType> values;
+        std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+        std::vector<ValueType> totalRewards;
+        storm::solver::OptimizationDirection dir;
+    };
+    bool incrementalValueComputation = false;
+    std::optional<PreviousValueComputation> previousValueComputation;
+
     // The current status of this explorer
     ExplorationHeuristic explHeuristic;
     Status status;
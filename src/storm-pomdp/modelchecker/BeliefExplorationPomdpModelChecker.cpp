@@ -1,5 +1,7 @@
 #include "BeliefExplorationPomdpModelChecker.h"
 
+#include <iterator>
+#include <limits>
 #include <tuple>
 
 #include "storm-pomdp/analysis/FiniteBeliefMdpDetection.h"
@@ -11,6 +13,7 @@
 #include "storm/utility/NumberTraits.h"
 
 #include "storm-pomdp/builder/BeliefMdpExplorer.h"
+#include "storm-pomdp/modelchecker/PointBasedPomdpValueBoundsModelChecker.h"
 #include "storm-pomdp/modelchecker/PreprocessingPomdpValueBoundsModelChecker.h"
 #include "storm/utility/vector.h"
 
@@ -19,6 +22,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace pomdp {
@@ -99,6 +103,16 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     // We work with the Belief MDP value type, so if the POMDP is exact, but the belief MDP is not, we need to convert
     auto preProcessingMC = PreprocessingPomdpValueBoundsModelChecker<ValueType>(pomdp());
     auto initialPomdpValueBounds = preProcessingMC.getValueBounds(preProcEnv, formula);
+
+    // Improve the bounds that are achievable by a policy (lower bounds if we maximize, upper bounds if we minimize) using point-based value iteration
+    if (options.pointBasedIterations > 0 && !formulaInfo.isUnsupported()) {
+        auto pointBasedMC = PointBasedPomdpValueBoundsModelChecker<ValueType>(pomdp());
+        auto& achievableBounds = formulaInfo.minimize() ? initialPomdpValueBounds.upper : initialPomdpValueBounds.lower;
+        auto pointBasedBounds =
+            pointBasedMC.computeValueBounds(formulaInfo, achievableBounds, options.pointBasedBeliefs, options.pointBasedIterations, options.explorationThreads);
+        // The additional bounds are appended such that the first bounds still correspond to the schedulers found during preprocessing
+        achievableBounds.insert(achievableBounds.end(), std::make_move_iterator(pointBasedBounds.begin()), std::make_move_iterator(pointBasedBounds.end()));
+    }
     pomdpValueBounds.trivialPomdpValueBounds = initialPomdpValueBounds;
 
     // If we clip and compute rewards, compute the values necessary for the correction terms
@@ -325,6 +339,7 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             overApproxBeliefManager->setRewardModel(rewardModelName);
         }
         overApproximation = std::make_shared<ExplorerType>(overApproxBeliefManager, trivialPOMDPBounds, storm::builder::ExplorationHeuristic::BreadthFirst);
+        overApproximation->setIncrementalValueComputation(options.incrementalValueComputation);
         overApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
         overApproxHeuristicPar.observationThreshold = options.obsThresholdInit;
         overApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit == 0 ? std::numeric_limits<uint64_t>::max() : options.sizeThresholdInit;
@@ -353,6 +368,7 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             underApproxBeliefManager->setRewardModel(rewardModelName);
         }
         underApproximation = std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic);
+        underApproximation->setIncrementalValueComputation(options.incrementalValueComputation);
         underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
         underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
         underApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit;
@@ -596,6 +612,7 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
 
     // set up belief MDP explorer
     interactiveUnderApproximationExplorer = std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic);
+    interactiveUnderApproximationExplorer->setIncrementalValueComputation(options.incrementalValueComputation);
     underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
     underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
     underApproxHeuristicPar.sizeThreshold = std::numeric_limits<uint64_t>::max() - 1;  // we don't set a size threshold
@@ -925,6 +942,9 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                     checkRewireForAllActions = true;
                 }
             }
+            if (!restoreAllActions) {
+                precomputeExpansions(currId, targetObservations, &observationResolutionVector, beliefManager, overApproximation);
+            }
             bool expandedAtLeastOneAction = false;
             for (uint64_t action = 0, numActions = beliefManager->getBeliefNumberOfChoices(currId); action < numActions; ++action) {
                 bool expandCurrentAction = exploreAllActions || truncateAllActions;
@@ -1018,6 +1038,7 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             break;
         }
     }
+    beliefManager->clearPrecomputedExpansions();
 
     if (storm::utility::resources::isTerminate()) {
         // don't overwrite statistics of a previous, successful computation
@@ -1153,6 +1174,9 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                 underApproximation->setCurrentStateIsTruncated();
             }
             if (options.useStateEliminationCutoff || !stopExploration) {
+                if (!stateAlreadyExplored) {
+                    precomputeExpansions(currId, targetObservations, nullptr, beliefManager, underApproximation);
+                }
                 // Add successor transitions or cut-off transitions when exploration is stopped
                 uint64_t numActions = beliefManager->getBeliefNumberOfChoices(currId);
                 if (underApproximation->needsActionAdjustment(numActions)) {
@@ -1268,6 +1292,7 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             break;
         }
     }
+    beliefManager->clearPrecomputedExpansions();
 
     if (storm::utility::resources::isTerminate()) {
         // don't overwrite statistics of a previous, successful computation
@@ -1417,6 +1442,29 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     return false;
 }
 
+template<typename PomdpModelType, typename BeliefValueType, typename BeliefMDPType>
+void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPType>::precomputeExpansions(
+    uint64_t beliefId, std::set<uint32_t> const& targetObservations, std::vector<BeliefValueType> const* observationResolutionVector,
+    std::shared_ptr<BeliefManagerType>& beliefManager, std::shared_ptr<ExplorerType>& beliefExplorer) {
+    uint64_t numberOfThreads = storm::utility::parallel::resolveNumberOfThreads(options.explorationThreads, std::numeric_limits<uint64_t>::max());
+    if (numberOfThreads == 1 || beliefManager->hasPrecomputedExpansion(beliefId, 0)) {
+        return;
+    }
+    // Expand the current belief together with a batch of the beliefs that are queued next. Beliefs with target observation are not expanded.
+    uint64_t const beliefsPerThread = 16;
+    std::vector<uint64_t> beliefIds = {beliefId};
+    for (auto const& nextBeliefId : beliefExplorer->getNextUnexploredBeliefs(numberOfThreads * beliefsPerThread)) {
+        if (targetObservations.count(beliefManager->getBeliefObservation(nextBeliefId)) == 0) {
+            beliefIds.push_back(nextBeliefId);
+        }
+    }
+    std::optional<std::vector<BeliefValueType>> observationResolutions;
+    if (observationResolutionVector != nullptr) {
+        observationResolutions = *observationResolutionVector;
+    }
+    beliefManager->precomputeExpansions(beliefIds, observationResolutions, numberOfThreads);
+}
+
 template<typename PomdpModelType, typename BeliefValueType, typename BeliefMDPType>
 void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPType>::setUnfoldingControl(
     storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPType>::UnfoldingControl newUnfoldingControl) {
@@ -318,6 +318,18 @@ class BeliefExplorationPomdpModelChecker {
     bool clipToGridExplicitly(uint64_t clippingStateId, bool computeRewards, std::shared_ptr<BeliefManagerType>& beliefManager,
                               std::shared_ptr<ExplorerType>& beliefExplorer, uint64_t localActionIndex);
 
+    /**
+     * If multiple exploration threads are used, concurrently computes the successors of the given belief and of the beliefs that are queued next.
+     * The successors are used by subsequent expansions. Nothing happens if the successors of the given belief have already been computed.
+     * @param beliefId the ID of the belief that is about to be expanded
+     * @param targetObservations beliefs with one of these observations are not expanded
+     * @param observationResolutionVector if not null, the successors are triangulated using these resolutions (over-approximation)
+     * @param beliefManager the belief manager used
+     * @param beliefExplorer the belief MDP explorer used
+     */
+    void precomputeExpansions(uint64_t beliefId, std::set<uint32_t> const& targetObservations, std::vector<BeliefValueType> const* observationResolutionVector,
+                              std::shared_ptr<BeliefManagerType>& beliefManager, std::shared_ptr<ExplorerType>& beliefExplorer);
+
     /**
      * Heuristically rates the quality of the approximation described by the given successor observation info.
      * Here, 0 means a bad approximation and 1 means a good approximation.
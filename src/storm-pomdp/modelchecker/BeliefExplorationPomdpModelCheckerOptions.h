@@ -29,6 +29,10 @@ struct BeliefExplorationPomdpModelCheckerOptions {
     uint64_t refineStepLimit = 0;
     ValueType refinePrecision = storm::utility::convertNumber<ValueType>(1e-4);
     uint64_t explorationTimeLimit = 0;
+    uint64_t explorationThreads = 1;  // The number of threads that compute belief successors during exploration (0 means one thread per core)
+    bool incrementalValueComputation = false;  // Whether values of states whose reachable part of the belief MDP did not change are re-used after refining
+    uint64_t pointBasedIterations = 0;  // The number of point-based value iterations that improve the preprocessed value bounds (0 disables them)
+    uint64_t pointBasedBeliefs = 100;   // The number of sampled beliefs at which point-based value iteration performs backups
 
     // Control parameters for the refinement heuristic
     // Discretization Resolution
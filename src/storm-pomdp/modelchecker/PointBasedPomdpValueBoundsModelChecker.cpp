@@ -0,0 +1,342 @@
+#include "storm-pomdp/modelchecker/PointBasedPomdpValueBoundsModelChecker.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace pomdp {
+namespace modelchecker {
+
+namespace {
+template<typename ValueType>
+ValueType dotProduct(std::vector<ValueType> const& first, std::vector<ValueType> const& second) {
+    STORM_LOG_ASSERT(first.size() == second.size(), "Vector sizes do not match.");
+    // Both vectors are dense and stored contiguously, allowing the compiler to vectorize this loop.
+    ValueType result = storm::utility::zero<ValueType>();
+    for (uint64_t i = 0; i < first.size(); ++i) {
+        result += first[i] * second[i];
+    }
+    return result;
+}
+}  // namespace
+
+template<typename ValueType>
+PointBasedPomdpValueBoundsModelChecker<ValueType>::PointBasedPomdpValueBoundsModelChecker(storm::models::sparse::Pomdp<ValueType> const& pomdp)
+    : pomdp(pomdp), minimize(false) {
+    // Intentionally left empty
+}
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> PointBasedPomdpValueBoundsModelChecker<ValueType>::computeValueBounds(
+    storm::pomdp::analysis::FormulaInformation const& info, std::vector<std::vector<ValueType>> const& initialBounds, uint64_t numberOfBeliefs,
+    uint64_t numberOfIterations, uint64_t numberOfThreads) {
+    STORM_LOG_THROW(info.isNonNestedReachabilityProbability() || info.isNonNestedExpectedRewardFormula(), storm::exceptions::NotSupportedException,
+                    "Point-based value bounds are only supported for non-nested reachability probabilities and expected rewards.");
+    STORM_LOG_THROW(pomdp.getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException,
+                    "Point-based value bounds require a unique initial state.");
+    initialize(info);
+
+    auto alphaVectors = computeInitialAlphaVectors(initialBounds);
+    auto beliefs = sampleBeliefs(numberOfBeliefs);
+    STORM_LOG_INFO("Performing point-based value iteration on " << beliefs.size() << " sampled beliefs.");
+
+    uint64_t iteration = 0;
+    for (; iteration < numberOfIterations; ++iteration) {
+        // The backups only read the current alpha vectors, so they can be computed independently of each other.
+        std::vector<std::optional<AlphaVector>> backups(beliefs.size());
+        storm::utility::parallel::forEachTask(beliefs.size(), numberOfThreads,
+                                              [&](uint64_t, uint64_t beliefIndex) { backups[beliefIndex] = backup(beliefs[beliefIndex], alphaVectors); });
+
+        bool improved = false;
+        for (uint64_t beliefIndex = 0; beliefIndex < beliefs.size(); ++beliefIndex) {
+            if (!backups[beliefIndex]) {
+                continue;
+            }
+            auto const& belief = beliefs[beliefIndex];
+            auto& observationAlphaVectors = alphaVectors[belief.observation];
+            ValueType newValue = dotProduct(backups[beliefIndex].value(), belief.probabilities);
+            if (observationAlphaVectors.empty() || isBetter(newValue, getBestAlphaVector(observationAlphaVectors, belief.probabilities).second)) {
+                observationAlphaVectors.push_back(std::move(backups[beliefIndex].value()));
+                improved = true;
+            }
+        }
+        pruneAlphaVectors(alphaVectors, beliefs);
+        if (!improved) {
+            break;
+        }
+    }
+    STORM_LOG_INFO("Point-based value iteration stopped after " << iteration << " iterations.");
+
+    // Combine the alpha vectors of the different observations to state value vectors.
+    uint64_t numberOfResults = 0;
+    for (auto const& observationAlphaVectors : alphaVectors) {
+        numberOfResults = std::max<uint64_t>(numberOfResults, observationAlphaVectors.size());
+    }
+    std::vector<std::vector<ValueType>> result(numberOfResults, std::vector<ValueType>(pomdp.getNumberOfStates()));
+    for (uint64_t observation = 0; observation < alphaVectors.size(); ++observation) {
+        auto const& observationAlphaVectors = alphaVectors[observation];
+        auto const& states = statesOfObservation[observation];
+        for (uint64_t resultIndex = 0; resultIndex < numberOfResults; ++resultIndex) {
+            for (uint64_t localState = 0; localState < states.size(); ++localState) {
+                if (observationAlphaVectors.empty()) {
+                    // This only happens for minimizing rewards, where no finite upper bound is known for this observation.
+                    STORM_LOG_ASSERT(minimize, "No alpha vector for observation " << observation << ".");
+                    result[resultIndex][states[localState]] = storm::utility::infinity<ValueType>();
+                } else {
+                    result[resultIndex][states[localState]] = observationAlphaVectors[std::min(resultIndex, observationAlphaVectors.size() - 1)][localState];
+                }
+            }
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void PointBasedPomdpValueBoundsModelChecker<ValueType>::initialize(storm::pomdp::analysis::FormulaInformation const& info) {
+    minimize = info.minimize();
+    statesOfObservation.assign(pomdp.getNrObservations(), {});
+    localStateIndices.resize(pomdp.getNumberOfStates());
+    for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+        auto& observationStates = statesOfObservation[pomdp.getObservation(state)];
+        localStateIndices[state] = observationStates.size();
+        observationStates.push_back(state);
+    }
+
+    fixedStates = info.getTargetStates().states;
+    fixedValues.assign(pomdp.getNumberOfStates(), storm::utility::zero<ValueType>());
+    if (info.isNonNestedReachabilityProbability()) {
+        for (auto state : fixedStates) {
+            fixedValues[state] = storm::utility::one<ValueType>();
+        }
+        fixedStates |= info.getSinkStates().states;
+        choiceRewards.clear();
+    } else {
+        choiceRewards = pomdp.getRewardModel(info.getRewardModelName()).getTotalRewardVector(pomdp.getTransitionMatrix());
+    }
+}
+
+template<typename ValueType>
+std::vector<std::vector<typename PointBasedPomdpValueBoundsModelChecker<ValueType>::AlphaVector>>
+PointBasedPomdpValueBoundsModelChecker<ValueType>::computeInitialAlphaVectors(std::vector<std::vector<ValueType>> const& initialBounds) const {
+    std::vector<std::vector<AlphaVector>> alphaVectors(pomdp.getNrObservations());
+    for (uint64_t observation = 0; observation < alphaVectors.size(); ++observation) {
+        auto const& states = statesOfObservation[observation];
+        for (auto const& bound : initialBounds) {
+            AlphaVector alphaVector;
+            alphaVector.reserve(states.size());
+            for (auto state : states) {
+                if (storm::utility::isInfinity(bound[state])) {
+                    break;
+                }
+                alphaVector.push_back(fixedStates.get(state) ? fixedValues[state] : bound[state]);
+            }
+            if (alphaVector.size() == states.size()) {
+                alphaVectors[observation].push_back(std::move(alphaVector));
+            }
+        }
+        if (alphaVectors[observation].empty() && choiceRewards.empty()) {
+            // Probabilities are trivially bounded by zero and one.
+            alphaVectors[observation].emplace_back(states.size(), minimize ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>());
+        } else if (alphaVectors[observation].empty() && !minimize) {
+            // Rewards are non-negative.
+            alphaVectors[observation].emplace_back(states.size(), storm::utility::zero<ValueType>());
+        }
+    }
+    return alphaVectors;
+}
+
+template<typename ValueType>
+std::vector<typename PointBasedPomdpValueBoundsModelChecker<ValueType>::SampledBelief> PointBasedPomdpValueBoundsModelChecker<ValueType>::sampleBeliefs(
+    uint64_t numberOfBeliefs) const {
+    uint64_t initialState = pomdp.getInitialStates().getNextSetIndex(0);
+    SampledBelief initialBelief{pomdp.getObservation(initialState), std::vector<ValueType>(statesOfObservation[pomdp.getObservation(initialState)].size())};
+    initialBelief.probabilities[localStateIndices[initialState]] = storm::utility::one<ValueType>();
+
+    std::vector<SampledBelief> beliefs;
+    std::set<std::pair<uint32_t, std::vector<ValueType>>> knownBeliefs;
+    beliefs.push_back(initialBelief);
+    knownBeliefs.emplace(initialBelief.observation, initialBelief.probabilities);
+
+    // We perform random walks that start at the initial belief and restart whenever they reach a known belief (or only states with a fixed value).
+    // A fixed seed makes the resulting bounds reproducible. The number of steps is bounded as there might be less reachable beliefs than requested.
+    std::mt19937 randomGenerator(0);
+    SampledBelief currentBelief = initialBelief;
+    for (uint64_t step = 0; beliefs.size() < numberOfBeliefs && step < 100 * numberOfBeliefs; ++step) {
+        uint64_t numberOfChoices = pomdp.getNumberOfChoices(statesOfObservation[currentBelief.observation].front());
+        uint64_t action = std::uniform_int_distribution<uint64_t>(0, numberOfChoices - 1)(randomGenerator);
+        auto successors = computeSuccessors(currentBelief, action);
+        std::vector<double> successorWeights;
+        for (auto const& successor : successors) {
+            double weight = 0.0;
+            for (auto const& probability : successor.second) {
+                weight += storm::utility::convertNumber<double>(probability);
+            }
+            successorWeights.push_back(weight);
+        }
+        if (successors.empty() || *std::max_element(successorWeights.begin(), successorWeights.end()) <= 0.0) {
+            currentBelief = initialBelief;
+            continue;
+        }
+
+        std::discrete_distribution<uint64_t> successorDistribution(successorWeights.begin(), successorWeights.end());
+        auto successorIt = std::next(successors.begin(), successorDistribution(randomGenerator));
+        SampledBelief successorBelief{successorIt->first, std::move(successorIt->second)};
+        ValueType mass = storm::utility::zero<ValueType>();
+        for (auto const& probability : successorBelief.probabilities) {
+            mass += probability;
+        }
+        for (auto& probability : successorBelief.probabilities) {
+            probability /= mass;
+        }
+        if (knownBeliefs.emplace(successorBelief.observation, successorBelief.probabilities).second) {
+            beliefs.push_back(successorBelief);
+            currentBelief = std::move(successorBelief);
+        } else {
+            currentBelief = initialBelief;
+        }
+    }
+    return beliefs;
+}
+
+template<typename ValueType>
+std::map<uint32_t, std::vector<ValueType>> PointBasedPomdpValueBoundsModelChecker<ValueType>::computeSuccessors(SampledBelief const& belief,
+                                                                                                                uint64_t action) const {
+    std::map<uint32_t, std::vector<ValueType>> successors;
+    auto const& states = statesOfObservation[belief.observation];
+    for (uint64_t localState = 0; localState < states.size(); ++localState) {
+        ValueType const& stateProbability = belief.probabilities[localState];
+        if (storm::utility::isZero(stateProbability) || fixedStates.get(states[localState])) {
+            continue;
+        }
+        for (auto const& entry : pomdp.getTransitionMatrix().getRow(states[localState], action)) {
+            uint32_t successorObservation = pomdp.getObservation(entry.getColumn());
+            auto successorIt = successors.find(successorObservation);
+            if (successorIt == successors.end()) {
+                std::vector<ValueType> successorProbabilities(statesOfObservation[successorObservation].size(), storm::utility::zero<ValueType>());
+                successorIt = successors.emplace(successorObservation, std::move(successorProbabilities)).first;
+            }
+            successorIt->second[localStateIndices[entry.getColumn()]] += stateProbability * entry.getValue();
+        }
+    }
+    return successors;
+}
+
+template<typename ValueType>
+std::optional<typename PointBasedPomdpValueBoundsModelChecker<ValueType>::AlphaVector> PointBasedPomdpValueBoundsModelChecker<ValueType>::backup(
+    SampledBelief const& belief, std::vector<std::vector<AlphaVector>> const& alphaVectors) const {
+    auto const& states = statesOfObservation[belief.observation];
+    auto const& rowGroupIndices = pomdp.getTransitionMatrix().getRowGroupIndices();
+    uint64_t numberOfChoices = pomdp.getNumberOfChoices(states.front());
+
+    std::optional<AlphaVector> result;
+    ValueType resultValue = storm::utility::zero<ValueType>();
+    for (uint64_t action = 0; action < numberOfChoices; ++action) {
+        // For each successor observation, select the alpha vector that is best for the corresponding successor belief.
+        std::map<uint32_t, AlphaVector const*> successorAlphaVectors;
+        bool feasible = true;
+        for (auto const& successor : computeSuccessors(belief, action)) {
+            auto const& candidates = alphaVectors[successor.first];
+            if (candidates.empty()) {
+                feasible = false;
+                break;
+            }
+            successorAlphaVectors.emplace(successor.first, &candidates[getBestAlphaVector(candidates, successor.second).first]);
+        }
+
+        // Compute the alpha vector of the policy that plays the action and then continues with the policies of the selected alpha vectors.
+        AlphaVector alphaVector;
+        alphaVector.reserve(states.size());
+        for (auto stateIt = states.begin(); feasible && stateIt != states.end(); ++stateIt) {
+            if (fixedStates.get(*stateIt)) {
+                alphaVector.push_back(fixedValues[*stateIt]);
+                continue;
+            }
+            uint64_t row = rowGroupIndices[*stateIt] + action;
+            ValueType value = choiceRewards.empty() ? storm::utility::zero<ValueType>() : choiceRewards[row];
+            for (auto const& entry : pomdp.getTransitionMatrix().getRow(row)) {
+                uint32_t successorObservation = pomdp.getObservation(entry.getColumn());
+                auto successorIt = successorAlphaVectors.find(successorObservation);
+                if (successorIt == successorAlphaVectors.end()) {
+                    // The observation is not reached from the belief, so we can pick an arbitrary alpha vector.
+                    if (alphaVectors[successorObservation].empty()) {
+                        feasible = false;
+                        break;
+                    }
+                    successorIt = successorAlphaVectors.emplace(successorObservation, &alphaVectors[successorObservation].front()).first;
+                }
+                value += entry.getValue() * (*successorIt->second)[localStateIndices[entry.getColumn()]];
+            }
+            alphaVector.push_back(std::move(value));
+        }
+        if (!feasible) {
+            continue;
+        }
+
+        ValueType value = dotProduct(alphaVector, belief.probabilities);
+        if (!result || isBetter(value, resultValue)) {
+            result = std::move(alphaVector);
+            resultValue = std::move(value);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void PointBasedPomdpValueBoundsModelChecker<ValueType>::pruneAlphaVectors(std::vector<std::vector<AlphaVector>>& alphaVectors,
+                                                                          std::vector<SampledBelief> const& beliefs) const {
+    std::vector<storm::storage::BitVector> usedAlphaVectors;
+    usedAlphaVectors.reserve(alphaVectors.size());
+    for (auto const& observationAlphaVectors : alphaVectors) {
+        usedAlphaVectors.emplace_back(observationAlphaVectors.size(), false);
+    }
+    storm::storage::BitVector observationsWithBeliefs(alphaVectors.size(), false);
+    for (auto const& belief : beliefs) {
+        if (!alphaVectors[belief.observation].empty()) {
+            observationsWithBeliefs.set(belief.observation);
+            usedAlphaVectors[belief.observation].set(getBestAlphaVector(alphaVectors[belief.observation], belief.probabilities).first);
+        }
+    }
+    for (auto observation : observationsWithBeliefs) {
+        std::vector<AlphaVector> keptAlphaVectors;
+        for (auto alphaVectorIndex : usedAlphaVectors[observation]) {
+            keptAlphaVectors.push_back(std::move(alphaVectors[observation][alphaVectorIndex]));
+        }
+        alphaVectors[observation] = std::move(keptAlphaVectors);
+    }
+}
+
+template<typename ValueType>
+std::pair<uint64_t, ValueType> PointBasedPomdpValueBoundsModelChecker<ValueType>::getBestAlphaVector(std::vector<AlphaVector> const& alphaVectors,
+                                                                                                     std::vector<ValueType> const& distribution) const {
+    STORM_LOG_ASSERT(!alphaVectors.empty(), "No alpha vectors given.");
+    std::pair<uint64_t, ValueType> result(0, dotProduct(alphaVectors.front(), distribution));
+    for (uint64_t alphaVectorIndex = 1; alphaVectorIndex < alphaVectors.size(); ++alphaVectorIndex) {
+        ValueType value = dotProduct(alphaVectors[alphaVectorIndex], distribution);
+        if (isBetter(value, result.second)) {
+            result.first = alphaVectorIndex;
+            result.second = std::move(value);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool PointBasedPomdpValueBoundsModelChecker<ValueType>::isBetter(ValueType const& value, ValueType const& otherValue) const {
+    return minimize ? value < otherValue : value > otherValue;
+}
+
+template class PointBasedPomdpValueBoundsModelChecker<double>;
+
+template class PointBasedPomdpValueBoundsModelChecker<storm::RationalNumber>;
+}  // namespace modelchecker
+}  // namespace pomdp
+}  // namespace storm
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "storm-pomdp/analysis/FormulaInformation.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace pomdp {
+namespace modelchecker {
+
+/*!
+ * Computes value bounds for a POMDP using point-based value iteration (in the spirit of PBVI and Perseus).
+ * Starting from some known bounds, we maintain a set of alpha vectors for each observation and repeatedly perform Bellman backups at a set of
+ * sampled beliefs. Every alpha vector corresponds to the value of an (observation-based) policy, so the resulting bounds are achievable, i.e.,
+ * they are lower bounds for maximizing objectives and upper bounds for minimizing objectives.
+ */
+template<typename ValueType>
+class PointBasedPomdpValueBoundsModelChecker {
+   public:
+    PointBasedPomdpValueBoundsModelChecker(storm::models::sparse::Pomdp<ValueType> const& pomdp);
+
+    /*!
+     * Computes value bounds via point-based value iteration.
+     * @param info Information about the considered formula. Only non-nested reachability probabilities and expected rewards are supported.
+     * @param initialBounds Achievable bounds (i.e., lower bounds if we maximize and upper bounds if we minimize) that serve as initial alpha vectors.
+     * @param numberOfBeliefs The (maximal) number of beliefs at which backups are performed.
+     * @param numberOfIterations The maximal number of backup iterations.
+     * @param numberOfThreads The number of threads that perform backups (0 means one thread per core).
+     * @return Vectors v such that for every belief b, the sum over b(s)*v(s) is a lower bound (if we maximize) or an upper bound (if we minimize) of
+     * the value at b. Each vector is obtained by combining one alpha vector for each observation.
+     */
+    std::vector<std::vector<ValueType>> computeValueBounds(storm::pomdp::analysis::FormulaInformation const& info,
+                                                           std::vector<std::vector<ValueType>> const& initialBounds, uint64_t numberOfBeliefs,
+                                                           uint64_t numberOfIterations, uint64_t numberOfThreads);
+
+   private:
+    /// An alpha vector assigns a value to each state of an observation (in the order given by statesOfObservation)
+    typedef std::vector<ValueType> AlphaVector;
+
+    /// A belief, given by an observation and a (dense) distribution over the states of this observation
+    struct SampledBelief {
+        uint32_t observation;
+        std::vector<ValueType> probabilities;
+    };
+
+    void initialize(storm::pomdp::analysis::FormulaInformation const& info);
+
+    std::vector<std::vector<AlphaVector>> computeInitialAlphaVectors(std::vector<std::vector<ValueType>> const& initialBounds) const;
+
+    std::vector<SampledBelief> sampleBeliefs(uint64_t numberOfBeliefs) const;
+
+    /*!
+     * Computes for each successor observation the (not normalized) successor belief that is reached when playing the given action.
+     * The probability mass on states with a fixed value is not propagated.
+     */
+    std::map<uint32_t, std::vector<ValueType>> computeSuccessors(SampledBelief const& belief, uint64_t action) const;
+
+    /*!
+     * Performs a Bellman backup at the given belief. Returns nothing if no action yields a (finite) alpha vector.
+     */
+    std::optional<AlphaVector> backup(SampledBelief const& belief, std::vector<std::vector<AlphaVector>> const& alphaVectors) const;
+
+    /*!
+     * Removes all alpha vectors that are not optimal for at least one sampled belief.
+     * The alpha vectors of observations without sampled beliefs are kept.
+     */
+    void pruneAlphaVectors(std::vector<std::vector<AlphaVector>>& alphaVectors, std::vector<SampledBelief> const& beliefs) const;
+
+    /*!
+     * Returns the index of the alpha vector that is best for the given (not necessarily normalized) belief distribution together with its value.
+     */
+    std::pair<uint64_t, ValueType> getBestAlphaVector(std::vector<AlphaVector> const& alphaVectors, std::vector<ValueType> const& distribution) const;
+
+    bool isBetter(ValueType const& value, ValueType const& otherValue) const;
+
+    storm::models::sparse::Pomdp<ValueType> const& pomdp;
+
+    bool minimize;
+    std::vector<std::vector<uint64_t>> statesOfObservation;
+    std::vector<uint64_t> localStateIndices;  // The position of each state within the states of its observation
+    storm::storage::BitVector fixedStates;    // States whose value is known a priori (targets and, for probabilities, sinks)
+    std::vector<ValueType> fixedValues;
+    std::vector<ValueType> choiceRewards;  // Empty for probabilities
+};
+
+}  // namespace modelchecker
+}  // namespace pomdp
+}  // namespace storm
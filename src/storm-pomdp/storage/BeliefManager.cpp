@@ -1,11 +1,15 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <cmath>
+#include <type_traits>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/solver/GlpkLpSolver.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace storage {
@@ -31,51 +35,26 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::FreudenthalDiff::oper
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const {
-    return lhBelief == rhBelief;
+BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefSlice::BeliefSlice(BeliefEntryType const *first, BeliefEntryType const *last)
+    : first(first), last(last) {
+    // Intentionally left empty
 }
 
-template<>
-bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Belief_equal_to::operator()(const BeliefType &lhBelief,
-                                                                                                        const BeliefType &rhBelief) const {
-    // If the sizes are different, we don't have to look inside the belief
-    if (lhBelief.size() != rhBelief.size()) {
-        return false;
-    }
-    // Assumes that beliefs are ordered
-    auto lhIt = lhBelief.begin();
-    auto rhIt = rhBelief.begin();
-    while (lhIt != lhBelief.end() || rhIt != rhBelief.end()) {
-        // Iterate over the entries simultaneously, beliefs not equal if they contain either different states or different values for the same state
-        if (lhIt->first != rhIt->first || std::fabs(lhIt->second - rhIt->second) > 1e-15) {
-            return false;
-        }
-        ++lhIt;
-        ++rhIt;
-    }
-    return lhIt == lhBelief.end() && rhIt == rhBelief.end();
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefEntryType const *
+BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefSlice::begin() const {
+    return first;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
-    std::size_t seed = 0;
-    // Assumes that beliefs are ordered
-    for (auto const &entry : belief) {
-        boost::hash_combine(seed, entry.first);
-        boost::hash_combine(seed, entry.second);
-    }
-    return seed;
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefEntryType const *
+BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefSlice::end() const {
+    return last;
 }
 
-template<>
-std::size_t BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::BeliefHash::operator()(const BeliefType &belief) const {
-    std::size_t seed = 0;
-    // Assumes that beliefs are ordered
-    for (auto const &entry : belief) {
-        boost::hash_combine(seed, entry.first);
-        boost::hash_combine(seed, round(storm::utility::convertNumber<double>(entry.second) * 1e15));
-    }
-    return seed;
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefSlice::size() const {
+    return last - first;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -83,7 +62,7 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType co
                                                                     TriangulationMode const &triangulationMode)
     : pomdp(pomdp), triangulationMode(triangulationMode) {
     cc = storm::utility::ConstantsComparator<BeliefValueType>(precision, false);
-    beliefToIdMap.resize(pomdp.getNrObservations());
+    beliefOffsets.push_back(0);
     initialBeliefId = computeInitialBelief();
 }
 
@@ -195,7 +174,8 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state,
+                                                                             BeliefValueType const &value) const {
     auto insertionRes = distr.emplace(state, value);
     if (!insertionRes.second) {
         insertionRes.first->second += value;
@@ -204,7 +184,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(Dis
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) const {
     if (distr.size() == 1 && cc.isEqual(distr.begin()->second, storm::utility::one<BeliefValueType>())) {
         // If the distribution consists of only one entry and its value is sufficiently close to 1, make it exactly 1 to avoid numerical problems
         distr.begin()->second = storm::utility::one<BeliefValueType>();
@@ -221,7 +201,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-    return beliefs.size();
+    return beliefOffsets.size() - 1;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -248,25 +228,100 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expand(BeliefId const &bel
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefSlice BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
     BeliefId const &id) const {
     STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existent belief.");
     STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-    return beliefs[id];
+    BeliefEntryType const *entries = beliefEntries.data();
+    return BeliefSlice(entries + beliefOffsets[id], entries + beliefOffsets[id + 1]);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(
     BeliefType const &belief) const {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto idIt = beliefToIdMap[obs].find(belief);
-    STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-    return idIt->second;
+    STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
+    BeliefId id = beliefIndex[findBeliefIndexSlot(belief)];
+    STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+    return id;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+template<typename BeliefRangeType>
+std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::computeBeliefHash(BeliefRangeType const &belief) const {
+    std::size_t seed = 0;
+    // Assumes that beliefs are ordered
+    for (auto const &entry : belief) {
+        boost::hash_combine(seed, entry.first);
+        if constexpr (std::is_same<BeliefValueType, double>::value) {
+            // Beliefs whose values only differ slightly are considered equal, so we need to make sure that they get the same hash
+            boost::hash_combine(seed, round(entry.second * 1e15));
+        } else {
+            boost::hash_combine(seed, entry.second);
+        }
+    }
+    return seed;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::isStoredBelief(BeliefType const &belief, BeliefSlice const &storedBelief) const {
+    // If the sizes are different, we don't have to look inside the belief
+    if (belief.size() != storedBelief.size()) {
+        return false;
+    }
+    // Assumes that beliefs are ordered
+    auto storedIt = storedBelief.begin();
+    for (auto const &entry : belief) {
+        // Beliefs are not equal if they contain either different states or different values for the same state
+        if (entry.first != storedIt->first) {
+            return false;
+        }
+        if constexpr (std::is_same<BeliefValueType, double>::value) {
+            if (std::fabs(entry.second - storedIt->second) > 1e-15) {
+                return false;
+            }
+        } else if (entry.second != storedIt->second) {
+            return false;
+        }
+        ++storedIt;
+    }
+    return true;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::findBeliefIndexSlot(BeliefType const &belief) const {
+    STORM_LOG_ASSERT(!beliefIndex.empty(), "The belief index has no slots.");
+    uint64_t const slotMask = beliefIndex.size() - 1;
+    uint64_t slot = computeBeliefHash(belief) & slotMask;
+    while (beliefIndex[slot] != noId() && !isStoredBelief(belief, getBelief(beliefIndex[slot]))) {
+        slot = (slot + 1) & slotMask;
+    }
+    return slot;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::growBeliefIndex() {
+    beliefIndex.assign(std::max<uint64_t>(16, 2 * beliefIndex.size()), noId());
+    uint64_t const slotMask = beliefIndex.size() - 1;
+    for (BeliefId id = 0; id < getNumberOfBeliefIds(); ++id) {
+        // Stored beliefs are pairwise different, so we only need to find an empty slot.
+        uint64_t slot = computeBeliefHash(getBelief(id)) & slotMask;
+        while (beliefIndex[slot] != noId()) {
+            slot = (slot + 1) & slotMask;
+        }
+        beliefIndex[slot] = id;
+    }
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+template<typename BeliefRangeType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType BeliefManager<PomdpType, BeliefValueType, StateType>::toBeliefType(
+    BeliefRangeType const &belief) const {
+    return BeliefType(boost::container::ordered_unique_range, belief.begin(), belief.end());
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+template<typename BeliefRangeType>
+std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefRangeType const &belief) const {
     std::stringstream str;
     str << "{ ";
     bool first = true;
@@ -283,7 +338,8 @@ std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(Belie
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const {
     if (first.size() != second.size()) {
         return false;
     }
@@ -301,7 +357,8 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType co
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefType const &belief) const {
+template<typename BeliefRangeType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefRangeType const &belief) const {
     auto sum = storm::utility::zero<BeliefValueType>();
     std::optional<uint32_t> observation;
     for (auto const &entry : belief) {
@@ -342,12 +399,13 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefTy
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
+template<typename BeliefRangeType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefRangeType const &belief, GridTriangulation const &triangulation) const {
     if (triangulation.weights.size() != triangulation.gridPoints.size()) {
         STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
         return false;
     }
-    if (triangulation.size() == 0) {
+    if (triangulation.weights.empty()) {
         STORM_LOG_ERROR("Empty triangulation.");
         return false;
     }
@@ -366,7 +424,7 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
             STORM_LOG_ERROR("Weight greater than one in triangulation.");
         }
         weightSum += triangulation.weights[i];
-        BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
+        BeliefType const &gridPoint = triangulation.gridPoints[i];
         for (auto const &pointEntry : gridPoint) {
             BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<BeliefValueType>()).first->second;
             triangulatedValue += triangulation.weights[i] * pointEntry.second;
@@ -387,14 +445,16 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+template<typename BeliefRangeType>
+uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefRangeType const &belief) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
     return pomdp.getObservation(belief.begin()->first);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                        Triangulation &result) {
+template<typename BeliefRangeType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefRangeType const &belief, BeliefValueType const &resolution,
+                                                                                        GridTriangulation &result) const {
     STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
     StateType numEntries = belief.size();
@@ -443,15 +503,16 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
                     gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                 }
             }
-            result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            result.gridPoints.push_back(std::move(gridPoint));
         }
         previousSortedDiff = currentSortedDiff++;
     }
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                    Triangulation &result) {
+template<typename BeliefRangeType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefRangeType const &belief, BeliefValueType const &resolution,
+                                                                                    GridTriangulation &result) const {
     // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is
     // minimal
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
@@ -489,14 +550,15 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDyna
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
-    BeliefType const &belief, BeliefValueType const &resolution) {
+template<typename BeliefRangeType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::GridTriangulation
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(BeliefRangeType const &belief, BeliefValueType const &resolution) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-    Triangulation result;
+    GridTriangulation result;
     // Quickly triangulate Dirac beliefs
     if (belief.size() == 1u) {
         result.weights.push_back(storm::utility::one<BeliefValueType>());
-        result.gridPoints.push_back(getOrAddBeliefId(belief));
+        result.gridPoints.push_back(toBeliefType(belief));
     } else {
         auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
         switch (triangulationMode) {
@@ -510,19 +572,28 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
                 STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
         }
     }
-    STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+    STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation.");
     return result;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
-                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
-                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
-    std::vector<std::pair<BeliefId, ValueType>> destinations;
+template<typename BeliefRangeType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
+    BeliefRangeType const &belief, BeliefValueType const &resolution) {
+    GridTriangulation gridTriangulation = computeTriangulation(belief, resolution);
+    Triangulation result;
+    result.weights = std::move(gridTriangulation.weights);
+    result.gridPoints.reserve(gridTriangulation.gridPoints.size());
+    for (auto const &gridPoint : gridTriangulation.gridPoints) {
+        result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+    }
+    return result;
+}
 
-    BeliefType belief = getBelief(beliefId);
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, BeliefValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefSlice const &belief, uint64_t actionIndex) const {
+    std::vector<std::pair<BeliefType, BeliefValueType>> successors;
 
     // Find the probability we go to each observation
     BeliefType successorObs;  // This is actually not a belief but has the same type
@@ -537,7 +608,8 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
     }
     adjustDistribution(successorObs);
 
-    // Now for each successor observation we find and potentially triangulate the successor belief
+    // Now for each successor observation we find the successor belief
+    successors.reserve(successorObs.size());
     for (auto const &successor : successorObs) {
         BeliefType successorBelief;
         for (auto const &pointEntry : belief) {
@@ -551,37 +623,119 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
         }
         adjustDistribution(successorBelief);
         STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+        successors.emplace_back(std::move(successorBelief), successor.second);
+    }
+    return successors;
+}
 
-        // Insert the destination. We know that destinations have to be disjoint since they have different observations
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::PendingExpansion BeliefManager<PomdpType, BeliefValueType, StateType>::computeExpansion(
+    BeliefSlice const &belief, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+    PendingExpansion result;
+    result.triangulated = observationTriangulationResolutions.has_value();
+    for (auto &successor : computeSuccessorBeliefs(belief, actionIndex)) {
+        // We know that destinations have to be disjoint since they have different observations
         if (observationTriangulationResolutions) {
-            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successor.first]);
-            for (size_t j = 0; j < triangulation.size(); ++j) {
+            uint32_t successorObservation = pomdp.getObservation(successor.first.begin()->first);
+            GridTriangulation triangulation = computeTriangulation(successor.first, observationTriangulationResolutions.value()[successorObservation]);
+            for (size_t j = 0; j < triangulation.gridPoints.size(); ++j) {
                 // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                BeliefValueType a = triangulation.weights[j] * successor.second;
-                destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
-            }
-        } else if (observationGridClippingResolutions) {
-            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successor.first],
-                                                       storm::storage::BitVector(pomdp.getNumberOfStates()));
-            if (clipping.isClippable) {
-                BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
-                destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
-            } else {
-                // Belief on Grid
-                destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+                result.destinations.emplace_back(std::move(triangulation.gridPoints[j]), triangulation.weights[j] * successor.second);
             }
         } else {
-            destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+            result.destinations.push_back(std::move(successor));
         }
     }
+    return result;
+}
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::commitExpansion(PendingExpansion const &expansion) {
+    std::vector<std::pair<BeliefId, ValueType>> destinations;
+    destinations.reserve(expansion.destinations.size());
+    for (auto const &destination : expansion.destinations) {
+        destinations.emplace_back(getOrAddBeliefId(destination.first), storm::utility::convertNumber<ValueType>(destination.second));
+    }
+    return destinations;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::precomputeExpansions(std::vector<BeliefId> const &beliefIds,
+                                                                                std::optional<std::vector<BeliefValueType>> const &observationResolutions,
+                                                                                uint64_t numberOfThreads) {
+    // Gather the belief-action pairs that still need to be expanded.
+    std::vector<std::pair<BeliefId, uint64_t>> tasks;
+    for (auto const &beliefId : beliefIds) {
+        for (uint64_t action = 0, numActions = getBeliefNumberOfChoices(beliefId); action < numActions; ++action) {
+            auto precomputedIt = precomputedExpansions.find(std::make_pair(beliefId, action));
+            if (precomputedIt == precomputedExpansions.end() || precomputedIt->second.triangulated != observationResolutions.has_value()) {
+                tasks.emplace_back(beliefId, action);
+            }
+        }
+    }
+
+    // The workers only read the belief table, so the expansions can be computed concurrently.
+    std::vector<PendingExpansion> results(tasks.size());
+    storm::utility::parallel::forEachTask(tasks.size(), numberOfThreads, [&](uint64_t, uint64_t task) {
+        results[task] = computeExpansion(getBelief(tasks[task].first), tasks[task].second, observationResolutions);
+    });
+    for (uint64_t task = 0; task < tasks.size(); ++task) {
+        precomputedExpansions[tasks[task]] = std::move(results[task]);
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::hasPrecomputedExpansion(BeliefId const &beliefId, uint64_t actionIndex) const {
+    return precomputedExpansions.count(std::make_pair(beliefId, actionIndex)) > 0;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::clearPrecomputedExpansions() {
+    precomputedExpansions.clear();
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
+                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
+    if (!observationGridClippingResolutions) {
+        // Use a precomputed expansion, if available
+        auto precomputedIt = precomputedExpansions.find(std::make_pair(beliefId, actionIndex));
+        if (precomputedIt != precomputedExpansions.end()) {
+            PendingExpansion expansion = std::move(precomputedIt->second);
+            precomputedExpansions.erase(precomputedIt);
+            if (expansion.triangulated == observationTriangulationResolutions.has_value()) {
+                return commitExpansion(expansion);
+            }
+        }
+        return commitExpansion(computeExpansion(getBelief(beliefId), actionIndex, observationTriangulationResolutions));
+    }
+
+    std::vector<std::pair<BeliefId, ValueType>> destinations;
+    for (auto const &successor : computeSuccessorBeliefs(getBelief(beliefId), actionIndex)) {
+        uint32_t successorObservation = pomdp.getObservation(successor.first.begin()->first);
+        BeliefClipping clipping = clipBeliefToGrid(successor.first, observationGridClippingResolutions.value()[successorObservation],
+                                                   storm::storage::BitVector(pomdp.getNumberOfStates()));
+        if (clipping.isClippable) {
+            BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
+            destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
+        } else {
+            // Belief on Grid
+            destinations.emplace_back(getOrAddBeliefId(successor.first), storm::utility::convertNumber<ValueType>(successor.second));
+        }
+    }
     return destinations;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
     BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite) {
-    auto res = clipBeliefToGrid(getBelief(beliefId), resolution, isInfinite);
+    // Clipping might add new beliefs, so we can not refer to the stored belief
+    auto res = clipBeliefToGrid(toBeliefType(getBelief(beliefId)), resolution, isInfinite);
     res.startingBelief = beliefId;
     return res;
 }
@@ -589,8 +743,7 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping Be
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
     BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite) {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
+    STORM_LOG_ASSERT(getBeliefObservation(belief) < pomdp.getNrObservations(), "Belief has unknown observation.");
     if (!lpSolver) {
         lpSolver = storm::utility::solver::getLpSolver<BeliefValueType>("POMDP LP Solver");
     } else {
@@ -769,16 +922,22 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefMa
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
     BeliefType const &belief) {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-    if (insertioRes.second) {
-        // There actually was an insertion, so add the new belief
-        STORM_LOG_TRACE("Add Belief " << beliefs.size() << " " << toString(belief));
-        beliefs.push_back(belief);
+    STORM_LOG_ASSERT(getBeliefObservation(belief) < pomdp.getNrObservations(), "Belief has unknown observation.");
+    // Keep the load factor of the index at most 1/2
+    if (2 * (getNumberOfBeliefIds() + 1) > beliefIndex.size()) {
+        growBeliefIndex();
+    }
+    uint64_t slot = findBeliefIndexSlot(belief);
+    if (beliefIndex[slot] == noId()) {
+        // The belief is new, so add its entries to the arena
+        BeliefId newId = getNumberOfBeliefIds();
+        STORM_LOG_TRACE("Add Belief " << newId << " " << toString(belief));
+        beliefEntries.insert(beliefEntries.end(), belief.begin(), belief.end());
+        beliefOffsets.push_back(beliefEntries.size());
+        beliefIndex[slot] = newId;
     }
     // Return the id
-    return insertioRes.first->second;
+    return beliefIndex[slot];
 }
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getRepresentativeState(BeliefId const &beliefId) {
@@ -801,7 +960,7 @@ std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefAsVector(const BeliefType &belief) {
+std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefAsVector(BeliefSlice const &belief) {
     std::vector<BeliefValueType> res(pomdp.getNumberOfStates(), storm::utility::zero<BeliefValueType>());
     for (auto const &stateprob : belief) {
         res[stateprob.first] = stateprob.second;
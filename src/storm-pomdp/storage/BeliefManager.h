@@ -2,6 +2,7 @@
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
+#include <map>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -79,12 +80,18 @@ class BeliefManager {
     Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
     template<typename DistributionType>
-    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
     void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
     BeliefId getNumberOfBeliefIds() const;
 
+    /*!
+     * Retrieves the id of the given belief. If the belief is not stored yet, it gets a new id.
+     * Beliefs whose values only differ by rounding errors get the same id.
+     */
+    BeliefId getOrAddBeliefId(BeliefType const &belief);
+
     std::vector<std::pair<BeliefId, ValueType>> expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex,
                                                                      std::vector<BeliefValueType> const &observationResolutions);
 
@@ -93,6 +100,30 @@ class BeliefManager {
 
     std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+    /*!
+     * Computes the successors of the given beliefs under each of their actions using (at most) the given number of threads.
+     * If observation resolutions are given, the successors are triangulated as in expandAndTriangulate. Otherwise, they are computed as in expand.
+     * The results are kept until the expansion of the corresponding belief and action is requested via expandAndTriangulate (or expand).
+     * Successor beliefs that have not been found before only get an id once the expansion is requested. Ids are thus assigned in the same order
+     * as without precomputation.
+     *
+     * @param beliefIds The beliefs to expand. Beliefs whose expansions have already been precomputed are skipped.
+     * @param observationResolutions If given, the resolutions used to triangulate the successor beliefs.
+     * @param numberOfThreads The number of threads. Zero means that the number is determined automatically.
+     */
+    void precomputeExpansions(std::vector<BeliefId> const &beliefIds, std::optional<std::vector<BeliefValueType>> const &observationResolutions,
+                              uint64_t numberOfThreads);
+
+    /*!
+     * Retrieves whether the expansion of the given belief under the given action has been precomputed (and not yet requested).
+     */
+    bool hasPrecomputedExpansion(BeliefId const &beliefId, uint64_t actionIndex) const;
+
+    /*!
+     * Drops all expansions that were precomputed but not requested.
+     */
+    void clearPrecomputedExpansions();
+
     BeliefClipping clipBeliefToGrid(BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite = storm::storage::BitVector());
 
     std::string getObservationLabel(BeliefId const &beliefId);
@@ -102,19 +133,39 @@ class BeliefManager {
    private:
     std::vector<BeliefValueType> getBeliefAsVector(BeliefId const &beliefId);
 
-    std::vector<BeliefValueType> getBeliefAsVector(const BeliefType &belief);
+    std::vector<BeliefValueType> getBeliefAsVector(BeliefSlice const &belief);
 
     BeliefClipping clipBeliefToGrid(BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
 
     template<typename DistributionType>
-    void adjustDistribution(DistributionType &distr);
+    void adjustDistribution(DistributionType &distr) const;
 
-    struct BeliefHash {
-        std::size_t operator()(const BeliefType &belief) const;
+    typedef std::pair<StateType, BeliefValueType> BeliefEntryType;
+
+    /// A belief as it is stored in the belief arena, i.e., a contiguous range of (state, probability) entries that is ordered by the states.
+    /// The range is only valid until the next belief is added.
+    class BeliefSlice {
+       public:
+        BeliefSlice(BeliefEntryType const *first, BeliefEntryType const *last);
+        BeliefEntryType const *begin() const;
+        BeliefEntryType const *end() const;
+        uint64_t size() const;
+
+       private:
+        BeliefEntryType const *first;
+        BeliefEntryType const *last;
+    };
+
+    /// A triangulation whose grid points are given explicitly, i.e., they do not necessarily have an id yet.
+    struct GridTriangulation {
+        std::vector<BeliefType> gridPoints;
+        std::vector<BeliefValueType> weights;
     };
 
-    struct Belief_equal_to {
-        bool operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const;
+    /// The (triangulated) successors of a belief under an action. The successor beliefs do not necessarily have an id yet.
+    struct PendingExpansion {
+        bool triangulated;
+        std::vector<std::pair<BeliefType, BeliefValueType>> destinations;
     };
 
     struct FreudenthalDiff {
@@ -125,25 +176,77 @@ class BeliefManager {
         bool operator>(FreudenthalDiff const &other) const;
     };
 
-    BeliefType const &getBelief(BeliefId const &id) const;
+    BeliefSlice getBelief(BeliefId const &id) const;
 
     BeliefId getId(BeliefType const &belief) const;
 
-    std::string toString(BeliefType const &belief) const;
+    /*!
+     * Computes the hash of the given belief that is used to find it in the belief index.
+     */
+    template<typename BeliefRangeType>
+    std::size_t computeBeliefHash(BeliefRangeType const &belief) const;
+
+    /*!
+     * Retrieves whether the given belief coincides with the given stored belief, i.e., whether both get the same id.
+     */
+    bool isStoredBelief(BeliefType const &belief, BeliefSlice const &storedBelief) const;
+
+    /*!
+     * Retrieves the slot of the belief index that either holds the id of the given belief or (if the belief is not stored) is empty.
+     */
+    uint64_t findBeliefIndexSlot(BeliefType const &belief) const;
+
+    /*!
+     * Doubles the number of slots of the belief index and re-inserts all stored beliefs.
+     */
+    void growBeliefIndex();
 
-    bool isEqual(BeliefType const &first, BeliefType const &second) const;
+    template<typename BeliefRangeType>
+    BeliefType toBeliefType(BeliefRangeType const &belief) const;
 
-    bool assertBelief(BeliefType const &belief) const;
+    template<typename BeliefRangeType>
+    std::string toString(BeliefRangeType const &belief) const;
 
-    bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+    template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+    bool isEqual(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const;
 
-    uint32_t getBeliefObservation(BeliefType belief) const;
+    template<typename BeliefRangeType>
+    bool assertBelief(BeliefRangeType const &belief) const;
 
-    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    template<typename BeliefRangeType>
+    bool assertTriangulation(BeliefRangeType const &belief, GridTriangulation const &triangulation) const;
 
-    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    template<typename BeliefRangeType>
+    uint32_t getBeliefObservation(BeliefRangeType const &belief) const;
 
-    Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
+    template<typename BeliefRangeType>
+    void triangulateBeliefFreudenthal(BeliefRangeType const &belief, BeliefValueType const &resolution, GridTriangulation &result) const;
+
+    template<typename BeliefRangeType>
+    void triangulateBeliefDynamic(BeliefRangeType const &belief, BeliefValueType const &resolution, GridTriangulation &result) const;
+
+    template<typename BeliefRangeType>
+    GridTriangulation computeTriangulation(BeliefRangeType const &belief, BeliefValueType const &resolution) const;
+
+    template<typename BeliefRangeType>
+    Triangulation triangulateBelief(BeliefRangeType const &belief, BeliefValueType const &resolution);
+
+    /*!
+     * Computes the successor beliefs of the given belief under the given action together with the probability to reach them.
+     * The successors are ordered by their observation.
+     */
+    std::vector<std::pair<BeliefType, BeliefValueType>> computeSuccessorBeliefs(BeliefSlice const &belief, uint64_t actionIndex) const;
+
+    /*!
+     * Computes the (possibly triangulated) successors of the given belief without modifying the belief table. Can thus be called concurrently.
+     */
+    PendingExpansion computeExpansion(BeliefSlice const &belief, uint64_t actionIndex,
+                                      std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const;
+
+    /*!
+     * Inserts the destinations of the given expansion into the belief table (in the order of the destinations) and returns their ids.
+     */
+    std::vector<std::pair<BeliefId, ValueType>> commitExpansion(PendingExpansion const &expansion);
 
     std::vector<std::pair<BeliefId, ValueType>> expandInternal(
         BeliefId const &beliefId, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = std::nullopt,
@@ -151,13 +254,16 @@ class BeliefManager {
 
     BeliefId computeInitialBelief();
 
-    BeliefId getOrAddBeliefId(BeliefType const &belief);
-
     PomdpType const &pomdp;
     std::vector<ValueType> pomdpActionRewardVector;
 
-    std::vector<BeliefType> beliefs;
-    std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash, Belief_equal_to>> beliefToIdMap;
+    // The entries of all beliefs are stored consecutively in an arena. The entries of the belief with id i are given by the range
+    // [beliefOffsets[i], beliefOffsets[i+1]) of beliefEntries.
+    std::vector<BeliefEntryType> beliefEntries;
+    std::vector<uint64_t> beliefOffsets;
+    // Open addressing hash table (with linear probing) that maps beliefs to their id. Empty slots hold noId().
+    // The number of slots is always a power of two.
+    std::vector<BeliefId> beliefIndex;
     BeliefId initialBeliefId;
 
     storm::utility::ConstantsComparator<BeliefValueType> cc;
@@ -165,6 +271,8 @@ class BeliefManager {
     std::shared_ptr<storm::solver::LpSolver<BeliefValueType>> lpSolver;
 
     TriangulationMode triangulationMode;
+
+    std::map<std::pair<BeliefId, uint64_t>, PendingExpansion> precomputedExpansions;
 };
 }  // namespace storage
 }  // namespace storm
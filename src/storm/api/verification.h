@@ -32,6 +32,7 @@
 #include "storm/settings/modules/EliminationSettings.h"
 
 #include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/ExecutionScope.h"
 
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -325,12 +326,14 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithHybridEngine(storm::
                                                                          std::shared_ptr<storm::models::symbolic::Dtmc<DdType, ValueType>> const& dtmc,
                                                                          storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
-    dtmc->getManager().execute([&]() {
+    {
+        // The workers of the DD library are only kept awake here, the sparse parts of the hybrid engine suspend them.
+        storm::dd::ExecutionScope<DdType> executionScope;
         storm::modelchecker::HybridDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<DdType, ValueType>> modelchecker(*dtmc);
         if (modelchecker.canHandle(task)) {
             result = modelchecker.check(env, task);
         }
-    });
+    }
     return result;
 }
 
@@ -346,12 +349,13 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithHybridEngine(storm::
                                                                          std::shared_ptr<storm::models::symbolic::Ctmc<DdType, ValueType>> const& ctmc,
                                                                          storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
-    ctmc->getManager().execute([&]() {
+    {
+        storm::dd::ExecutionScope<DdType> executionScope;
         storm::modelchecker::HybridCtmcCslModelChecker<storm::models::symbolic::Ctmc<DdType, ValueType>> modelchecker(*ctmc);
         if (modelchecker.canHandle(task)) {
             result = modelchecker.check(env, task);
         }
-    });
+    }
     return result;
 }
 
@@ -367,12 +371,13 @@ typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value
 verifyWithHybridEngine(storm::Environment const& env, std::shared_ptr<storm::models::symbolic::Mdp<DdType, ValueType>> const& mdp,
                        storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
-    mdp->getManager().execute([&]() {
+    {
+        storm::dd::ExecutionScope<DdType> executionScope;
         storm::modelchecker::HybridMdpPrctlModelChecker<storm::models::symbolic::Mdp<DdType, ValueType>> modelchecker(*mdp);
         if (modelchecker.canHandle(task)) {
             result = modelchecker.check(env, task);
         }
-    });
+    }
     return result;
 }
 
@@ -395,12 +400,13 @@ typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value
 verifyWithHybridEngine(storm::Environment const& env, std::shared_ptr<storm::models::symbolic::MarkovAutomaton<DdType, ValueType>> const& ma,
                        storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
-    ma->getManager().execute([&]() {
+    {
+        storm::dd::ExecutionScope<DdType> executionScope;
         storm::modelchecker::HybridMarkovAutomatonCslModelChecker<storm::models::symbolic::MarkovAutomaton<DdType, ValueType>> modelchecker(*ma);
         if (modelchecker.canHandle(task)) {
             result = modelchecker.check(env, task);
         }
-    });
+    }
     return result;
 }
 
@@ -539,6 +539,10 @@ struct ComposerResult {
     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
     storm::dd::Bdd<Type> illegalFragment;
     uint64_t numberOfNondeterminismVariables;
+
+    // The transitions of the individual actions (without the action and nondeterminism encodings). Their sum covers the same transitions as the
+    // overall transition DD and they serve as the partitions of the transition relation during the reachability analysis.
+    std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
 };
 
 // A class that is responsible for performing the actual composition. This
@@ -2020,6 +2024,7 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
 
             // Add missing global variable identities, action and nondeterminism encodings.
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
+            std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
             std::unordered_set<ActionIdentification, ActionIdentificationHash> containedActions;
             for (auto& action : automaton.actions) {
                 STORM_LOG_TRACE("Treating action with index " << action.first.actionIndex << (action.first.isMarkovian() ? " (Markovian)" : "") << ".");
@@ -2047,16 +2052,20 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
                 }
 
                 result += extendedTransitions;
+                actionTransitions.push_back(action.second.transitions);
             }
 
-            return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment,
-                                                   numberOfUsedNondeterminismVariables);
+            ComposerResult<Type, ValueType> composerResult(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment,
+                                                           numberOfUsedNondeterminismVariables);
+            composerResult.actionTransitions = std::move(actionTransitions);
+            return composerResult;
         } else if (modelType == storm::jani::ModelType::DTMC || modelType == storm::jani::ModelType::CTMC) {
             // Simply add all actions, but make sure to include the missing global variable identities.
 
             storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
             storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
+            std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
             std::unordered_set<uint64_t> actionIndices;
             for (auto& action : automaton.actions) {
                 STORM_LOG_THROW(actionIndices.find(action.first.actionIndex) == actionIndices.end(), storm::exceptions::WrongFormatException,
@@ -2066,9 +2075,12 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
                 addMissingGlobalVariableIdentities(action.second);
                 addToTransientAssignmentMap(transientEdgeAssignments, action.second.transientEdgeAssignments);
                 result += action.second.transitions;
+                actionTransitions.push_back(action.second.transitions);
             }
 
-            return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+            ComposerResult<Type, ValueType> composerResult(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+            composerResult.actionTransitions = std::move(actionTransitions);
+            return composerResult;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Model type '" << this->model.getModelType() << "' not supported.");
         }
@@ -2379,9 +2391,23 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
         model.getModelType() == storm::jani::ModelType::MA) {
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
     }
-    modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables,
-                                                                                 variables.columnMetaVariables)
-                                          .first;
+    if (options.reachabilityStrategy == storm::builder::SymbolicReachabilityStrategy::Bfs) {
+        modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd,
+                                                                                     variables.rowMetaVariables, variables.columnMetaVariables)
+                                              .first;
+    } else {
+        std::vector<storm::dd::Bdd<Type>> transitionPartitions;
+        for (auto const& actionTransitions : system.actionTransitions) {
+            storm::dd::Bdd<Type> partition = actionTransitions.notZero().existsAbstract(variables.allNondeterminismVariables) && !terminalStates;
+            if (!partition.isZero()) {
+                transitionPartitions.push_back(partition);
+            }
+        }
+        modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionPartitions,
+                                                                                     variables.rowMetaVariables, variables.columnMetaVariables,
+                                                                                     options.reachabilityStrategy)
+                                              .first;
+    }
 
     // Check that the reachable fragment does not overlap with the illegal fragment.
     storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
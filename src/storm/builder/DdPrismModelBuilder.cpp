@@ -1239,6 +1239,33 @@ storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSyst
     return result;
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+std::vector<storm::dd::Bdd<Type>> DdPrismModelBuilder<Type, ValueType>::createTransitionPartitions(GenerationInformation const& generationInfo,
+                                                                                                  ModuleDecisionDiagram const& module) {
+    // Each action of the module yields one partition. As the partitions are only used to compute the reachable states, they do not need to encode the
+    // nondeterminism or the synchronization, but they need to keep the global variables that are not written by the action.
+    auto createPartition = [&generationInfo](ActionDecisionDiagram const& action) {
+        storm::dd::Bdd<Type> partition = action.transitionsDd.notZero();
+        for (auto const& variable : generationInfo.allGlobalVariables) {
+            if (action.assignedGlobalVariables.find(variable) == action.assignedGlobalVariables.end()) {
+                partition &= generationInfo.variableToIdentityMap.at(variable).notZero();
+            }
+        }
+        if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::MDP) {
+            partition = partition.existsAbstract(generationInfo.allNondeterminismVariables);
+        }
+        return partition;
+    };
+
+    std::vector<storm::dd::Bdd<Type>> result;
+    result.push_back(createPartition(module.independentAction));
+    for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
+        result.push_back(createPartition(synchronizingAction.second));
+    }
+    result.erase(std::remove_if(result.begin(), result.end(), [](storm::dd::Bdd<Type> const& partition) { return partition.isZero(); }), result.end());
+    return result;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 typename DdPrismModelBuilder<Type, ValueType>::SystemResult DdPrismModelBuilder<Type, ValueType>::createSystemDecisionDiagram(
     GenerationInformation& generationInfo) {
@@ -1457,9 +1484,20 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
     }
 
-    storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
-                                                                                            generationInfo.columnMetaVariables)
-                                               .first;
+    storm::dd::Bdd<Type> reachableStates;
+    if (options.reachabilityStrategy == storm::builder::SymbolicReachabilityStrategy::Bfs) {
+        reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
+                                                                           generationInfo.columnMetaVariables)
+                              .first;
+    } else {
+        std::vector<storm::dd::Bdd<Type>> transitionPartitions = createTransitionPartitions(generationInfo, globalModule);
+        for (auto& partition : transitionPartitions) {
+            partition &= !terminalStatesBdd;
+        }
+        reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionPartitions, generationInfo.rowMetaVariables,
+                                                                           generationInfo.columnMetaVariables, options.reachabilityStrategy)
+                              .first;
+    }
     storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
     transitionMatrix *= reachableStatesAdd;
     if (system.stateActionDd) {
@@ -7,6 +7,7 @@
 
 #include "storm/storage/prism/Program.h"
 
+#include "storm/builder/SymbolicReachabilityStrategy.h"
 #include "storm/builder/TerminalStatesGetter.h"
 
 #include "storm/logic/Formulas.h"
@@ -99,6 +100,9 @@ class DdPrismModelBuilder {
         // An optional set of expression or labels that characterizes (a subset of) the terminal states of the model.
         // If this is set, the outgoing transitions of these states are replaced with a self-loop.
         storm::builder::TerminalStates terminalStates;
+
+        // The strategy used to compute the reachable states. All strategies other than BFS operate on one transition partition per action.
+        storm::builder::SymbolicReachabilityStrategy reachabilityStrategy = storm::builder::SymbolicReachabilityStrategy::Bfs;
     };
 
     /*!
@@ -286,6 +290,8 @@ class DdPrismModelBuilder {
 
     static storm::dd::Add<Type, ValueType> createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module);
 
+    static std::vector<storm::dd::Bdd<Type>> createTransitionPartitions(GenerationInformation const& generationInfo, ModuleDecisionDiagram const& module);
+
     static std::unordered_map<std::string, storm::models::symbolic::StandardRewardModel<Type, ValueType>> createRewardModelDecisionDiagrams(
         std::vector<std::reference_wrapper<storm::prism::RewardModel const>> const& selectedRewardModels, SystemResult& system,
         GenerationInformation& generationInfo, ModuleDecisionDiagram const& globalModule, storm::dd::Add<Type, ValueType> const& reachableStatesAdd,
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+namespace builder {
+
+// An enum that contains all strategies that the symbolic builders support for computing the reachable states.
+enum class SymbolicReachabilityStrategy {
+    // Breadth-first image computation on the monolithic transition relation.
+    Bfs,
+    // Images are computed with respect to one transition partition (e.g. one action) at a time, each step using the states found by the previous ones.
+    Chaining,
+    // Transition partitions are ordered by the topmost variable their guard depends on and each partition is only applied once all partitions
+    // below it have reached a fixpoint.
+    Saturation
+};
+
+std::ostream& operator<<(std::ostream& out, SymbolicReachabilityStrategy const& strategy);
+
+}  // namespace builder
+}  // namespace storm
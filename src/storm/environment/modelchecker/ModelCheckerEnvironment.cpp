@@ -17,6 +17,13 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    if (mcSettings.isHybridMatrixEntryLimitSet()) {
+        hybridMatrixEntryLimit = mcSettings.getHybridMatrixEntryLimit();
+    }
+    epochThreads = mcSettings.getEpochThreads();
+    if (mcSettings.isEpochMemoryLimitSet()) {
+        epochMemoryLimit = mcSettings.getEpochMemoryLimit();
+    }
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     steadyStateDistributionAlgorithm = ioSettings.getSteadyStateDistributionAlgorithm();
 }
@@ -57,4 +64,46 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+bool ModelCheckerEnvironment::isHybridMatrixEntryLimitSet() const {
+    return hybridMatrixEntryLimit.is_initialized();
+}
+
+uint64_t ModelCheckerEnvironment::getHybridMatrixEntryLimit() const {
+    return hybridMatrixEntryLimit.get();
+}
+
+void ModelCheckerEnvironment::setHybridMatrixEntryLimit(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The matrix entry limit must be positive.");
+    hybridMatrixEntryLimit = value;
+}
+
+void ModelCheckerEnvironment::unsetHybridMatrixEntryLimit() {
+    hybridMatrixEntryLimit = boost::none;
+}
+
+uint64_t ModelCheckerEnvironment::getEpochThreads() const {
+    return epochThreads;
+}
+
+void ModelCheckerEnvironment::setEpochThreads(uint64_t value) {
+    epochThreads = value;
+}
+
+bool ModelCheckerEnvironment::isEpochMemoryLimitSet() const {
+    return epochMemoryLimit.is_initialized();
+}
+
+uint64_t ModelCheckerEnvironment::getEpochMemoryLimit() const {
+    return epochMemoryLimit.get();
+}
+
+void ModelCheckerEnvironment::setEpochMemoryLimit(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The epoch memory limit must be positive.");
+    epochMemoryLimit = value;
+}
+
+void ModelCheckerEnvironment::unsetEpochMemoryLimit() {
+    epochMemoryLimit = boost::none;
+}
+
 }  // namespace storm
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -29,9 +30,25 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    bool isHybridMatrixEntryLimitSet() const;
+    uint64_t getHybridMatrixEntryLimit() const;
+    void setHybridMatrixEntryLimit(uint64_t value);
+    void unsetHybridMatrixEntryLimit();
+
+    uint64_t getEpochThreads() const;
+    void setEpochThreads(uint64_t value);
+
+    bool isEpochMemoryLimitSet() const;
+    uint64_t getEpochMemoryLimit() const;
+    void setEpochMemoryLimit(uint64_t value);
+    void unsetEpochMemoryLimit();
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    boost::optional<uint64_t> hybridMatrixEntryLimit;
+    uint64_t epochThreads;
+    boost::optional<uint64_t> epochMemoryLimit;
     SteadyStateDistributionAlgorithm steadyStateDistributionAlgorithm;
 };
 }  // namespace storm
@@ -49,6 +49,7 @@ MultiObjectiveModelCheckerEnvironment::MultiObjectiveModelCheckerEnvironment() {
 
     printResults = multiobjectiveSettings.isPrintResultsSet();
     useLexicographicModelChecking = multiobjectiveSettings.isLexicographicModelCheckingSet();
+    paretoThreads = multiobjectiveSettings.getParetoThreads();
 }
 
 MultiObjectiveModelCheckerEnvironment::~MultiObjectiveModelCheckerEnvironment() {
@@ -196,4 +197,12 @@ bool MultiObjectiveModelCheckerEnvironment::isLexicographicModelCheckingSet() co
 void MultiObjectiveModelCheckerEnvironment::setLexicographicModelChecking(bool value) {
     useLexicographicModelChecking = value;
 }
+
+uint64_t MultiObjectiveModelCheckerEnvironment::getParetoThreads() const {
+    return paretoThreads;
+}
+
+void MultiObjectiveModelCheckerEnvironment::setParetoThreads(uint64_t value) {
+    paretoThreads = value;
+}
 }  // namespace storm
\ No newline at end of file
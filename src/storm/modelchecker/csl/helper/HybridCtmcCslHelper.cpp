@@ -10,6 +10,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ExecutionScope.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
@@ -74,19 +75,31 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeBoundedUntilProbabiliti
     if (env.solver().isForceSoundness() && env.solver().timeBounded().getRelativeTerminationCriterion()) {
         // Forward this query to the sparse engine
         storm::utility::Stopwatch conversionWatch(true);
-        storm::dd::Odd odd = model.getReachableStates().createOdd();
-        storm::storage::SparseMatrix<ValueType> explicitRateMatrix = rateMatrix.toMatrix(odd, odd);
-        std::vector<ValueType> explicitExitRateVector = exitRateVector.toVector(odd);
+        storm::dd::Odd odd;
+        storm::storage::SparseMatrix<ValueType> explicitRateMatrix;
+        std::vector<ValueType> explicitExitRateVector;
+        storm::storage::BitVector explicitPhiStates;
+        storm::storage::BitVector explicitPsiStates;
         storm::solver::SolveGoal<ValueType> goal;
-        if (onlyInitialStatesRelevant) {
-            goal.setRelevantValues(model.getInitialStates().toVector(odd));
-        }
+        // The DD-heavy parts are run as tasks of the DD library, only the sparse solver runs outside of them.
+        model.getManager().execute([&]() {
+            odd = model.getReachableStates().createOdd();
+            explicitRateMatrix = rateMatrix.toMatrix(odd, odd);
+            explicitExitRateVector = exitRateVector.toVector(odd);
+            explicitPhiStates = phiStates.toVector(odd);
+            explicitPsiStates = psiStates.toVector(odd);
+            if (onlyInitialStatesRelevant) {
+                goal.setRelevantValues(model.getInitialStates().toVector(odd));
+            }
+        });
         conversionWatch.stop();
         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
+        // The workers of the DD library are not needed by the sparse computation, so they are suspended in the meantime.
+        storm::dd::SuspensionScope<DdType> suspensionScope;
         std::vector<ValueType> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities<ValueType>(
-            env, std::move(goal), explicitRateMatrix, explicitRateMatrix.transpose(true), phiStates.toVector(odd), psiStates.toVector(odd),
-            explicitExitRateVector, qualitative, lowerBound, upperBound);
+            env, std::move(goal), explicitRateMatrix, explicitRateMatrix.transpose(true), explicitPhiStates, explicitPsiStates, explicitExitRateVector,
+            qualitative, lowerBound, upperBound);
 
         return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(
             model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(),
@@ -101,9 +114,13 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeBoundedUntilProbabiliti
 
     // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
     // further computations.
-    storm::dd::Bdd<DdType> statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(model, rateMatrix.notZero(), phiStates, psiStates);
+    storm::dd::Bdd<DdType> statesWithProbabilityGreater0;
+    storm::dd::Bdd<DdType> statesWithProbabilityGreater0NonPsi;
+    model.getManager().execute([&]() {
+        statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(model, rateMatrix.notZero(), phiStates, psiStates);
+        statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 && !psiStates;
+    });
     STORM_LOG_INFO("Found " << statesWithProbabilityGreater0.getNonZeroCount() << " states with probability greater 0.");
-    storm::dd::Bdd<DdType> statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 && !psiStates;
     STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNonZeroCount() << " 'maybe' states.");
 
     if (!statesWithProbabilityGreater0NonPsi.isZero()) {
@@ -115,34 +132,41 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeBoundedUntilProbabiliti
             if (storm::utility::isZero(lowerBound)) {
                 // In this case, the interval is of the form [0, t].
                 // Note that this excludes [0, inf] since this is untimed reachability and we considered this case earlier.
+                ValueType uniformizationRate;
+                storm::utility::Stopwatch conversionWatch;
+                storm::dd::Odd odd;
+                storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix;
+                std::vector<ValueType> explicitB;
+                model.getManager().execute([&]() {
+                    // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                    uniformizationRate = 1.02 * (statesWithProbabilityGreater0NonPsi.template toAdd<ValueType>() * exitRateVector).getMax();
+                    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
-                // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
-                ValueType uniformizationRate = 1.02 * (statesWithProbabilityGreater0NonPsi.template toAdd<ValueType>() * exitRateVector).getMax();
-                STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
-
-                // Compute the uniformized matrix.
-                storm::dd::Add<DdType, ValueType> uniformizedMatrix =
-                    computeUniformizedMatrix(model, rateMatrix, exitRateVector, statesWithProbabilityGreater0NonPsi, uniformizationRate);
+                    // Compute the uniformized matrix.
+                    storm::dd::Add<DdType, ValueType> uniformizedMatrix =
+                        computeUniformizedMatrix(model, rateMatrix, exitRateVector, statesWithProbabilityGreater0NonPsi, uniformizationRate);
 
-                // Compute the vector that is to be added as a compensation for removing the absorbing states.
-                storm::dd::Add<DdType, ValueType> b = (statesWithProbabilityGreater0NonPsi.template toAdd<ValueType>() * rateMatrix *
-                                                       psiStates.swapVariables(model.getRowColumnMetaVariablePairs()).template toAdd<ValueType>())
-                                                          .sumAbstract(model.getColumnVariables()) /
-                                                      model.getManager().getConstant(uniformizationRate);
+                    // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                    storm::dd::Add<DdType, ValueType> b = (statesWithProbabilityGreater0NonPsi.template toAdd<ValueType>() * rateMatrix *
+                                                           psiStates.swapVariables(model.getRowColumnMetaVariablePairs()).template toAdd<ValueType>())
+                                                              .sumAbstract(model.getColumnVariables()) /
+                                                          model.getManager().getConstant(uniformizationRate);
 
-                storm::utility::Stopwatch conversionWatch(true);
+                    conversionWatch.start();
 
-                // Create an ODD for the translation to an explicit representation.
-                storm::dd::Odd odd = statesWithProbabilityGreater0NonPsi.createOdd();
+                    // Create an ODD for the translation to an explicit representation.
+                    odd = statesWithProbabilityGreater0NonPsi.createOdd();
 
-                // Convert the symbolic parts to their explicit representation.
-                storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
-                std::vector<ValueType> explicitB = b.toVector(odd);
-                conversionWatch.stop();
+                    // Convert the symbolic parts to their explicit representation.
+                    explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                    explicitB = b.toVector(odd);
+                    conversionWatch.stop();
+                });
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Finally compute the transient probabilities.
                 std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNonZeroCount(), storm::utility::zero<ValueType>());
+                storm::dd::SuspensionScope<DdType> suspensionScope;
                 std::vector<ValueType> subresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(
                     env, explicitUniformizedMatrix, &explicitB, upperBound, uniformizationRate, values, epsilon);
 
@@ -157,44 +181,50 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeBoundedUntilProbabiliti
                 std::unique_ptr<CheckResult> unboundedResult =
                     computeUntilProbabilities(env, model, rateMatrix, exitRateVector, phiStates, psiStates, qualitative);
 
-                // Compute the set of relevant states.
-                storm::dd::Bdd<DdType> relevantStates = statesWithProbabilityGreater0 && phiStates;
-
-                // Filter the unbounded result such that it only contains values for the relevant states.
-                unboundedResult->filter(SymbolicQualitativeCheckResult<DdType>(model.getReachableStates(), relevantStates));
-
+                storm::dd::Bdd<DdType> relevantStates;
                 storm::utility::Stopwatch conversionWatch;
+                storm::dd::Odd odd;
+                std::vector<ValueType> result;
+                ValueType uniformizationRate;
+                storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix;
+                model.getManager().execute([&]() {
+                    // Compute the set of relevant states.
+                    relevantStates = statesWithProbabilityGreater0 && phiStates;
 
-                // Build an ODD for the relevant states.
-                conversionWatch.start();
-                storm::dd::Odd odd = relevantStates.createOdd();
-                conversionWatch.stop();
+                    // Filter the unbounded result such that it only contains values for the relevant states.
+                    unboundedResult->filter(SymbolicQualitativeCheckResult<DdType>(model.getReachableStates(), relevantStates));
 
-                std::vector<ValueType> result;
-                if (unboundedResult->isHybridQuantitativeCheckResult()) {
+                    // Build an ODD for the relevant states.
                     conversionWatch.start();
-                    std::unique_ptr<CheckResult> explicitUnboundedResult =
-                        unboundedResult->asHybridQuantitativeCheckResult<DdType, ValueType>().toExplicitQuantitativeCheckResult();
+                    odd = relevantStates.createOdd();
                     conversionWatch.stop();
-                    result = std::move(explicitUnboundedResult->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
-                } else {
-                    STORM_LOG_THROW(unboundedResult->isSymbolicQuantitativeCheckResult(), storm::exceptions::InvalidStateException,
-                                    "Expected check result of different type.");
-                    result = unboundedResult->asSymbolicQuantitativeCheckResult<DdType, ValueType>().getValueVector().toVector(odd);
-                }
 
-                // Determine the uniformization rate for the transient probability computation.
-                ValueType uniformizationRate = 1.02 * (relevantStates.template toAdd<ValueType>() * exitRateVector).getMax();
+                    if (unboundedResult->isHybridQuantitativeCheckResult()) {
+                        conversionWatch.start();
+                        std::unique_ptr<CheckResult> explicitUnboundedResult =
+                            unboundedResult->asHybridQuantitativeCheckResult<DdType, ValueType>().toExplicitQuantitativeCheckResult();
+                        conversionWatch.stop();
+                        result = std::move(explicitUnboundedResult->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+                    } else {
+                        STORM_LOG_THROW(unboundedResult->isSymbolicQuantitativeCheckResult(), storm::exceptions::InvalidStateException,
+                                        "Expected check result of different type.");
+                        result = unboundedResult->asSymbolicQuantitativeCheckResult<DdType, ValueType>().getValueVector().toVector(odd);
+                    }
+
+                    // Determine the uniformization rate for the transient probability computation.
+                    uniformizationRate = 1.02 * (relevantStates.template toAdd<ValueType>() * exitRateVector).getMax();
 
-                // Compute the uniformized matrix.
-                storm::dd::Add<DdType, ValueType> uniformizedMatrix =
-                    computeUniformizedMatrix(model, rateMatrix, exitRateVector, relevantStates, uniformizationRate);
-                conversionWatch.start();
-                storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
-                conversionWatch.stop();
+                    // Compute the uniformized matrix.
+                    storm::dd::Add<DdType, ValueType> uniformizedMatrix =
+                        computeUniformizedMatrix(model, rateMatrix, exitRateVector, relevantStates, uniformizationRate);
+                    conversionWatch.start();
+                    explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                    conversionWatch.stop();
+                });
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Compute the transient probabilities.
+                storm::dd::SuspensionScope<DdType> suspensionScope;
                 result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(
                     env, explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, result, epsilon);
 
@@ -206,72 +236,88 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeBoundedUntilProbabiliti
 
                 if (lowerBound != upperBound) {
                     // In this case, the interval is of the form [t, t'] with t != 0, t' != inf and t != t'.
-
-                    // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
-                    ValueType uniformizationRate = 1.02 * (statesWithProbabilityGreater0NonPsi.template toAdd<ValueType>() * exitRateVector).getMax();
-                    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
-
-                    // Compute the (first) uniformized matrix.
-                    storm::dd::Add<DdType, ValueType> uniformizedMatrix =
-                        computeUniformizedMatrix(model, rateMatrix, exitRateVector, statesWithProbabilityGreater0NonPsi, uniformizationRate);
-
-                    // Create the one-step vector.
-                    storm::dd::Add<DdType, ValueType> b = (statesWithProbabilityGreater0NonPsi.template toAdd<ValueType>() * rateMatrix *
-                                                           psiStates.swapVariables(model.getRowColumnMetaVariablePairs()).template toAdd<ValueType>())
-                                                              .sumAbstract(model.getColumnVariables()) /
-                                                          model.getManager().getConstant(uniformizationRate);
-
-                    // Build an ODD for the relevant states and translate the symbolic parts to their explicit representation.
-                    storm::utility::Stopwatch conversionWatch(true);
-                    storm::dd::Odd odd = statesWithProbabilityGreater0NonPsi.createOdd();
-                    storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
-                    std::vector<ValueType> explicitB = b.toVector(odd);
-                    conversionWatch.stop();
+                    ValueType uniformizationRate;
+                    storm::utility::Stopwatch conversionWatch;
+                    storm::dd::Odd odd;
+                    storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix;
+                    std::vector<ValueType> explicitB;
+                    model.getManager().execute([&]() {
+                        // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                        uniformizationRate = 1.02 * (statesWithProbabilityGreater0NonPsi.template toAdd<ValueType>() * exitRateVector).getMax();
+                        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+                        // Compute the (first) uniformized matrix.
+                        storm::dd::Add<DdType, ValueType> uniformizedMatrix =
+                            computeUniformizedMatrix(model, rateMatrix, exitRateVector, statesWithProbabilityGreater0NonPsi, uniformizationRate);
+
+                        // Create the one-step vector.
+                        storm::dd::Add<DdType, ValueType> b = (statesWithProbabilityGreater0NonPsi.template toAdd<ValueType>() * rateMatrix *
+                                                               psiStates.swapVariables(model.getRowColumnMetaVariablePairs()).template toAdd<ValueType>())
+                                                                  .sumAbstract(model.getColumnVariables()) /
+                                                              model.getManager().getConstant(uniformizationRate);
+
+                        // Build an ODD for the relevant states and translate the symbolic parts to their explicit representation.
+                        conversionWatch.start();
+                        odd = statesWithProbabilityGreater0NonPsi.createOdd();
+                        explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                        explicitB = b.toVector(odd);
+                        conversionWatch.stop();
+                    });
 
                     // Compute the transient probabilities.
                     std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNonZeroCount(), storm::utility::zero<ValueType>());
-                    std::vector<ValueType> subResult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(
-                        env, explicitUniformizedMatrix, &explicitB, upperBound - lowerBound, uniformizationRate, values, epsilon);
-
-                    // Transform the explicit result to a hybrid check result, so we can easily convert it to
-                    // a symbolic qualitative format.
-                    HybridQuantitativeCheckResult<DdType> hybridResult(
-                        model.getReachableStates(), psiStates || (!statesWithProbabilityGreater0 && model.getReachableStates()),
-                        psiStates.template toAdd<ValueType>(), statesWithProbabilityGreater0NonPsi, odd, subResult);
-
-                    // Compute the set of relevant states.
-                    storm::dd::Bdd<DdType> relevantStates = statesWithProbabilityGreater0 && phiStates;
-
-                    // Filter the unbounded result such that it only contains values for the relevant states.
-                    hybridResult.filter(SymbolicQualitativeCheckResult<DdType>(model.getReachableStates(), relevantStates));
+                    std::vector<ValueType> subResult;
+                    {
+                        storm::dd::SuspensionScope<DdType> suspensionScope;
+                        subResult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(
+                            env, explicitUniformizedMatrix, &explicitB, upperBound - lowerBound, uniformizationRate, values, epsilon);
+                    }
 
-                    // Build an ODD for the relevant states.
-                    conversionWatch.start();
-                    odd = relevantStates.createOdd();
+                    storm::dd::Bdd<DdType> relevantStates;
+                    std::vector<ValueType> newSubresult;
+                    model.getManager().execute([&]() {
+                        // Transform the explicit result to a hybrid check result, so we can easily convert it to
+                        // a symbolic qualitative format.
+                        HybridQuantitativeCheckResult<DdType> hybridResult(
+                            model.getReachableStates(), psiStates || (!statesWithProbabilityGreater0 && model.getReachableStates()),
+                            psiStates.template toAdd<ValueType>(), statesWithProbabilityGreater0NonPsi, odd, subResult);
 
-                    std::unique_ptr<CheckResult> explicitResult = hybridResult.toExplicitQuantitativeCheckResult();
-                    conversionWatch.stop();
-                    std::vector<ValueType> newSubresult = std::move(explicitResult->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+                        // Compute the set of relevant states.
+                        relevantStates = statesWithProbabilityGreater0 && phiStates;
 
-                    // Then compute the transient probabilities of being in such a state after t time units. For this,
-                    // we must re-uniformize the CTMC, so we need to compute the second uniformized matrix.
-                    uniformizationRate = 1.02 * (relevantStates.template toAdd<ValueType>() * exitRateVector).getMax();
-                    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                        // Filter the unbounded result such that it only contains values for the relevant states.
+                        hybridResult.filter(SymbolicQualitativeCheckResult<DdType>(model.getReachableStates(), relevantStates));
 
-                    // If the lower and upper bounds coincide, we have only determined the relevant states at this
-                    // point, but we still need to construct the starting vector.
-                    if (lowerBound == upperBound) {
+                        // Build an ODD for the relevant states.
+                        conversionWatch.start();
                         odd = relevantStates.createOdd();
-                        newSubresult = psiStates.template toAdd<ValueType>().toVector(odd);
-                    }
 
-                    // Finally, we compute the second set of transient probabilities.
-                    uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector, relevantStates, uniformizationRate);
-                    conversionWatch.start();
-                    explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
-                    conversionWatch.stop();
+                        std::unique_ptr<CheckResult> explicitResult = hybridResult.toExplicitQuantitativeCheckResult();
+                        conversionWatch.stop();
+                        newSubresult = std::move(explicitResult->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+
+                        // Then compute the transient probabilities of being in such a state after t time units. For this,
+                        // we must re-uniformize the CTMC, so we need to compute the second uniformized matrix.
+                        uniformizationRate = 1.02 * (relevantStates.template toAdd<ValueType>() * exitRateVector).getMax();
+                        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+                        // If the lower and upper bounds coincide, we have only determined the relevant states at this
+                        // point, but we still need to construct the starting vector.
+                        if (lowerBound == upperBound) {
+                            odd = relevantStates.createOdd();
+                            newSubresult = psiStates.template toAdd<ValueType>().toVector(odd);
+                        }
+
+                        // Finally, we compute the second set of transient probabilities.
+                        storm::dd::Add<DdType, ValueType> uniformizedMatrix =
+                            computeUniformizedMatrix(model, rateMatrix, exitRateVector, relevantStates, uniformizationRate);
+                        conversionWatch.start();
+                        explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                        conversionWatch.stop();
+                    });
                     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
+                    storm::dd::SuspensionScope<DdType> suspensionScope;
                     newSubresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(
                         env, explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon);
 
@@ -280,29 +326,34 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeBoundedUntilProbabiliti
                                                                   model.getManager().template getAddZero<ValueType>(), relevantStates, odd, newSubresult));
                 } else {
                     // In this case, the interval is of the form [t, t] with t != 0, t != inf.
-
                     storm::utility::Stopwatch conversionWatch;
+                    storm::dd::Odd odd;
+                    std::vector<ValueType> newSubresult;
+                    ValueType uniformizationRate;
+                    storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix;
+                    model.getManager().execute([&]() {
+                        // Build an ODD for the relevant states.
+                        conversionWatch.start();
+                        odd = statesWithProbabilityGreater0.createOdd();
 
-                    // Build an ODD for the relevant states.
-                    conversionWatch.start();
-                    storm::dd::Odd odd = statesWithProbabilityGreater0.createOdd();
-
-                    std::vector<ValueType> newSubresult = psiStates.template toAdd<ValueType>().toVector(odd);
-                    conversionWatch.stop();
-
-                    // Then compute the transient probabilities of being in such a state after t time units. For this,
-                    // we must re-uniformize the CTMC, so we need to compute the second uniformized matrix.
-                    ValueType uniformizationRate = 1.02 * (statesWithProbabilityGreater0.template toAdd<ValueType>() * exitRateVector).getMax();
-                    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
-
-                    // Finally, we compute the second set of transient probabilities.
-                    storm::dd::Add<DdType, ValueType> uniformizedMatrix =
-                        computeUniformizedMatrix(model, rateMatrix, exitRateVector, statesWithProbabilityGreater0, uniformizationRate);
-                    conversionWatch.start();
-                    storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
-                    conversionWatch.stop();
+                        newSubresult = psiStates.template toAdd<ValueType>().toVector(odd);
+                        conversionWatch.stop();
+
+                        // Then compute the transient probabilities of being in such a state after t time units. For this,
+                        // we must re-uniformize the CTMC, so we need to compute the second uniformized matrix.
+                        uniformizationRate = 1.02 * (statesWithProbabilityGreater0.template toAdd<ValueType>() * exitRateVector).getMax();
+                        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+                        // Finally, we compute the second set of transient probabilities.
+                        storm::dd::Add<DdType, ValueType> uniformizedMatrix =
+                            computeUniformizedMatrix(model, rateMatrix, exitRateVector, statesWithProbabilityGreater0, uniformizationRate);
+                        conversionWatch.start();
+                        explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                        conversionWatch.stop();
+                    });
                     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
+                    storm::dd::SuspensionScope<DdType> suspensionScope;
                     newSubresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(
                         env, explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon);
 
@@ -336,28 +387,36 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeInstantaneousRewards(
                     "Computing instantaneous rewards for a reward model that does not define any state-rewards. The result is trivially 0.");
 
     storm::utility::Stopwatch conversionWatch;
+    storm::dd::Odd odd;
+    std::vector<ValueType> result;
+    ValueType maxValue;
+    // The DD-heavy parts are run as tasks of the DD library, only the sparse solver runs outside of them.
+    model.getManager().execute([&]() {
+        // Create ODD for the translation.
+        conversionWatch.start();
+        odd = model.getReachableStates().createOdd();
+        conversionWatch.stop();
 
-    // Create ODD for the translation.
-    conversionWatch.start();
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
-    conversionWatch.stop();
-
-    // Initialize result to state rewards of the model.
-    auto rewardsAdd = rewardModel.getStateRewardVector();
-    std::vector<ValueType> result = rewardsAdd.toVector(odd);
-    ValueType maxValue = std::max(rewardsAdd.getMax(), -rewardsAdd.getMin());
+        // Initialize result to state rewards of the model.
+        auto rewardsAdd = rewardModel.getStateRewardVector();
+        result = rewardsAdd.toVector(odd);
+        maxValue = std::max(rewardsAdd.getMax(), -rewardsAdd.getMin());
+    });
 
     // If the rewards are not zero and the time-bound is not zero, we need to perform a transient analysis.
     if (!storm::utility::isZero(maxValue) && timeBound > 0) {
         ValueType uniformizationRate = 1.02 * exitRateVector.getMax();
         STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
-        storm::dd::Add<DdType, ValueType> uniformizedMatrix =
-            computeUniformizedMatrix(model, rateMatrix, exitRateVector, model.getReachableStates(), uniformizationRate);
+        storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix;
+        model.getManager().execute([&]() {
+            storm::dd::Add<DdType, ValueType> uniformizedMatrix =
+                computeUniformizedMatrix(model, rateMatrix, exitRateVector, model.getReachableStates(), uniformizationRate);
 
-        conversionWatch.start();
-        storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
-        conversionWatch.stop();
+            conversionWatch.start();
+            explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+            conversionWatch.stop();
+        });
         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
         // Set the possible error allowed for truncation (epsilon for fox-glynn)
@@ -379,6 +438,7 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeInstantaneousRewards(
 
         // Loop until the desired precision is reached.
         do {
+            storm::dd::SuspensionScope<DdType> suspensionScope;
             result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, explicitUniformizedMatrix, nullptr,
                                                                                                                 timeBound, uniformizationRate, result, epsilon);
         } while (storm::modelchecker::helper::SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result, relevantValues));
@@ -418,27 +478,33 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeCumulativeRewards(
     STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
     storm::utility::Stopwatch conversionWatch;
+    storm::dd::Odd odd;
+    storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix;
+    std::vector<ValueType> explicitTotalRewardVector;
+    ValueType maxReward;
+    // The DD-heavy parts are run as tasks of the DD library, only the sparse solver runs outside of them.
+    model.getManager().execute([&]() {
+        // Create ODD for the translation.
+        conversionWatch.start();
+        odd = model.getReachableStates().createOdd();
+        conversionWatch.stop();
 
-    // Create ODD for the translation.
-    conversionWatch.start();
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
-    conversionWatch.stop();
-
-    // Compute the uniformized matrix.
-    storm::dd::Add<DdType, ValueType> uniformizedMatrix =
-        computeUniformizedMatrix(model, rateMatrix, exitRateVector, model.getReachableStates(), uniformizationRate);
-    conversionWatch.start();
-    storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
-    conversionWatch.stop();
-
-    // Then compute the state reward vector to use in the computation.
-    storm::dd::Add<DdType, ValueType> totalRewardVector = rewardModel.getTotalRewardVector(rateMatrix, model.getColumnVariables(), exitRateVector, false);
-    conversionWatch.start();
-    std::vector<ValueType> explicitTotalRewardVector = totalRewardVector.toVector(odd);
-    conversionWatch.stop();
-    STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+        // Compute the uniformized matrix.
+        storm::dd::Add<DdType, ValueType> uniformizedMatrix =
+            computeUniformizedMatrix(model, rateMatrix, exitRateVector, model.getReachableStates(), uniformizationRate);
+        conversionWatch.start();
+        explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+        conversionWatch.stop();
 
-    ValueType maxReward = std::max(totalRewardVector.getMax(), -totalRewardVector.getMin());
+        // Then compute the state reward vector to use in the computation.
+        storm::dd::Add<DdType, ValueType> totalRewardVector = rewardModel.getTotalRewardVector(rateMatrix, model.getColumnVariables(), exitRateVector, false);
+        conversionWatch.start();
+        explicitTotalRewardVector = totalRewardVector.toVector(odd);
+        conversionWatch.stop();
+
+        maxReward = std::max(totalRewardVector.getMax(), -totalRewardVector.getMin());
+    });
+    STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
     // If all rewards are zero, the result is the constant zero vector.
     if (storm::utility::isZero(maxReward)) {
@@ -467,6 +533,7 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeCumulativeRewards(
     // Finally, compute the transient probabilities.
     // Loop until the desired precision is reached.
     do {
+        storm::dd::SuspensionScope<DdType> suspensionScope;
         result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType, true>(
             env, explicitUniformizedMatrix, nullptr, timeBound, uniformizationRate, explicitTotalRewardVector, epsilon);
     } while (storm::modelchecker::helper::SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result, relevantValues));
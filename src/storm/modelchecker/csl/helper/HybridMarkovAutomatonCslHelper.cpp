@@ -6,6 +6,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ExecutionScope.h"
 
 #include "storm/solver/SolveGoal.h"
 #include "storm/utility/constants.h"
@@ -69,16 +70,30 @@ std::unique_ptr<CheckResult> HybridMarkovAutomatonCslHelper::computeBoundedUntil
 
     // If we reach this point, we convert this query to an instance for the sparse engine.
     storm::utility::Stopwatch conversionWatch(true);
-    // Create ODD for the translation.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
-    storm::storage::SparseMatrix<ValueType> explicitTransitionMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
-    std::vector<ValueType> explicitExitRateVector = exitRateVector.toVector(odd);
+    storm::dd::Odd odd;
+    storm::storage::SparseMatrix<ValueType> explicitTransitionMatrix;
+    std::vector<ValueType> explicitExitRateVector;
+    storm::storage::BitVector explicitMarkovianStates;
+    storm::storage::BitVector explicitPhiStates;
+    storm::storage::BitVector explicitPsiStates;
+    // The conversion is run as a task of the DD library, only the sparse solver runs outside of it.
+    model.getManager().execute([&]() {
+        // Create ODD for the translation.
+        odd = model.getReachableStates().createOdd();
+        explicitTransitionMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+        explicitExitRateVector = exitRateVector.toVector(odd);
+        explicitMarkovianStates = markovianStates.toVector(odd);
+        explicitPhiStates = phiStates.toVector(odd);
+        explicitPsiStates = psiStates.toVector(odd);
+    });
     conversionWatch.stop();
     STORM_LOG_INFO("Converting symbolic matrix to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
+    // The workers of the DD library are not needed by the sparse computation, so they are suspended in the meantime.
+    storm::dd::SuspensionScope<DdType> suspensionScope;
     auto explicitResult = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(
-        env, storm::solver::SolveGoal<ValueType>(dir), explicitTransitionMatrix, explicitExitRateVector, markovianStates.toVector(odd), phiStates.toVector(odd),
-        psiStates.toVector(odd), {lowerBound, upperBound});
+        env, storm::solver::SolveGoal<ValueType>(dir), explicitTransitionMatrix, explicitExitRateVector, explicitMarkovianStates, explicitPhiStates,
+        explicitPsiStates, {lowerBound, upperBound});
     return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(
         model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(),
         std::move(odd), std::move(explicitResult)));
@@ -0,0 +1,49 @@
+#ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_CONCURRENTEXPLORATION_H_
+#define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_CONCURRENTEXPLORATION_H_
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <shared_mutex>
+
+#include "storm/modelchecker/exploration/Statistics.h"
+
+namespace storm {
+namespace modelchecker {
+namespace exploration_detail {
+
+// The data shared by all workers of a concurrent exploration.
+template<typename StateType, typename ValueType>
+struct ConcurrentExploration {
+    ConcurrentExploration(StateType const& initialStateIndex) : initialStateIndex(initialStateIndex), version(0), terminate(false) {
+        // Intentionally left empty.
+    }
+
+    // The index of the (only) initial state.
+    StateType initialStateIndex;
+
+    // Guards the exploration information and the bounds. Sampling a path holds it in shared mode, all modifications hold it in exclusive mode.
+    std::shared_mutex mutex;
+
+    // Incremented whenever a precomputation changes the row groups of explored states (by collapsing MECs). Actions that were sampled before such a
+    // change may no longer belong to the corresponding state, so paths sampled against an older version are discarded.
+    std::atomic<uint64_t> version;
+
+    // Set as soon as the workers are to stop, i.e., once the bounds of the initial state have converged or something went wrong.
+    std::atomic<bool> terminate;
+
+    // Precomputations are performed one at a time in the background. The future of the most recent precomputation is guarded by the mutex, and a
+    // new precomputation is only started once the previous one has finished.
+    std::mutex precomputationMutex;
+    std::future<void> precomputation;
+
+    // The statistics of the precomputations. Since precomputations never overlap, no synchronization is needed.
+    Statistics<StateType, ValueType> precomputationStats;
+};
+
+}  // namespace exploration_detail
+}  // namespace modelchecker
+}  // namespace storm
+
+#endif /* STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_CONCURRENTEXPLORATION_H_ */
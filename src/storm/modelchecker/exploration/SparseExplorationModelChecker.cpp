@@ -1,6 +1,11 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+
 #include "storm/modelchecker/exploration/Bounds.h"
+#include "storm/modelchecker/exploration/ConcurrentExploration.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/modelchecker/exploration/Statistics.h"
@@ -29,6 +34,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/prism.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
@@ -37,13 +43,41 @@
 
 namespace storm {
 namespace modelchecker {
+namespace exploration_detail {
+
+// The intermediate results of a precomputation.
+template<typename StateType, typename ValueType>
+struct PrecomputationData {
+    // The states (of the exploration) that are part of the considered fragment. Their index in this vector is their index in the fragment.
+    std::vector<StateType> relevantStates;
+
+    // The index of the state in the fragment that represents all states outside of the fragment.
+    StateType sink;
+
+    storm::storage::BitVector targetStates;
+    storm::storage::SparseMatrix<ValueType> relevantStatesMatrix;
+
+    storm::storage::BitVector statesWithProbability0;
+    storm::storage::BitVector statesWithProbability1;
+
+    // The MEC decomposition of the fragment (only computed when maximizing).
+    storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition;
+};
+
+}  // namespace exploration_detail
 
 template<typename ModelType, typename StateType>
 SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program)
     : program(program.substituteConstantsFormulas()),
       randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
+      numberOfWorkers(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfWorkers()),
       comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
-    // Intentionally left empty.
+    setNumberOfWorkers(numberOfWorkers);
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::setNumberOfWorkers(uint64_t numberOfWorkers) {
+    this->numberOfWorkers = storm::utility::parallel::resolveNumberOfThreads(numberOfWorkers, std::numeric_limits<uint64_t>::max());
 }
 
 template<typename ModelType, typename StateType>
@@ -79,7 +113,9 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
                                                           targetFormula.toExpression(program.getManager(), labelToExpressionMapping));
 
     // Compute and return result.
-    std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation);
+    std::tuple<StateType, ValueType, ValueType> boundsForInitialState =
+        numberOfWorkers > 1 ? performConcurrentExploration(stateGeneration, explorationInformation, numberOfWorkers)
+                            : performExploration(stateGeneration, explorationInformation);
     return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
 }
 
@@ -182,11 +218,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         if (!foundTerminalState) {
             // At this point, we can be sure that the state was expanded and that we can sample according to the
             // probabilities in the matrix.
-            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
             stack.back().second = chosenAction;
             STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
 
-            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
             STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
 
             // Put the successor state and a dummy action on top of the stack.
@@ -206,13 +242,269 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
     return foundTerminalState;
 }
 
+template<typename ModelType, typename StateType>
+std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType>
+SparseExplorationModelChecker<ModelType, StateType>::performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                  ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                  uint64_t numberOfWorkers) const {
+    // Generate the initial state so we know where to start the simulation.
+    stateGeneration.computeInitialStates();
+    STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException,
+                    "Currently only models with one initial state are supported by the exploration engine.");
+    StateType initialStateIndex = stateGeneration.getFirstInitialState();
+
+    // Create a structure that holds the bounds for the states and actions.
+    Bounds<StateType, ValueType> bounds;
+
+    // Note that this structure has to be destroyed before the bounds as it may hold a running precomputation.
+    ConcurrentExploration<StateType, ValueType> concurrentExploration(initialStateIndex);
+
+    // Every worker needs its own generator, but all of them share the state storage of the given state generation.
+    std::vector<std::unique_ptr<StateGeneration<StateType, ValueType>>> workerStateGenerations;
+    std::vector<std::default_random_engine> workerRandomGenerators;
+    std::vector<Statistics<StateType, ValueType>> workerStats(numberOfWorkers);
+    for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+        workerStateGenerations.push_back(
+            std::make_unique<StateGeneration<StateType, ValueType>>(program, stateGeneration, explorationInformation, concurrentExploration.mutex));
+        workerRandomGenerators.emplace_back(randomGenerator());
+    }
+
+    STORM_LOG_INFO("Sampling paths with " << numberOfWorkers << " concurrent workers.");
+    storm::utility::parallel::forEachTask(numberOfWorkers, numberOfWorkers, [&](uint64_t, uint64_t worker) {
+        runConcurrentWorker(concurrentExploration, *workerStateGenerations[worker], explorationInformation, bounds, workerStats[worker],
+                            workerRandomGenerators[worker]);
+    });
+
+    // Wait for a precomputation that might still be running.
+    if (concurrentExploration.precomputation.valid()) {
+        concurrentExploration.precomputation.get();
+    }
+
+    // Show statistics if required.
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        Statistics<StateType, ValueType> stats;
+        for (auto const& singleWorkerStats : workerStats) {
+            stats.add(singleWorkerStats);
+        }
+        stats.add(concurrentExploration.precomputationStats);
+        stats.printToStream(std::cout, explorationInformation);
+    }
+
+    return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation),
+                           bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::runConcurrentWorker(ConcurrentExploration<StateType, ValueType>& concurrentExploration,
+                                                                              StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                              ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                              Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats,
+                                                                              std::default_random_engine& workerRandomGenerator) const {
+    StateActionStack stack;
+    try {
+        while (!concurrentExploration.terminate.load()) {
+            samplePathConcurrently(concurrentExploration, stateGeneration, explorationInformation, stack, bounds, stats, workerRandomGenerator);
+            stats.sampledPath();
+
+            {
+                std::shared_lock<std::shared_mutex> lock(concurrentExploration.mutex);
+                ValueType difference = bounds.getDifferenceOfStateBounds(concurrentExploration.initialStateIndex, explorationInformation);
+                STORM_LOG_TRACE("Difference after sampling a path is " << difference << ".");
+                if (comparator.isZero(difference)) {
+                    concurrentExploration.terminate.store(true);
+                }
+            }
+
+            // If the number of sampled paths exceeds a certain threshold, trigger a precomputation.
+            if (!concurrentExploration.terminate.load() &&
+                explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+                triggerBackgroundPrecomputation(concurrentExploration, stack, explorationInformation, bounds);
+            }
+        }
+    } catch (...) {
+        // Make sure the other workers stop as well.
+        concurrentExploration.terminate.store(true);
+        throw;
+    }
+}
+
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::samplePathConcurrently(ConcurrentExploration<StateType, ValueType>& concurrentExploration,
+                                                                                 StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                 ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                 StateActionStack& stack, Bounds<StateType, ValueType>& bounds,
+                                                                                 Statistics<StateType, ValueType>& stats,
+                                                                                 std::default_random_engine& workerRandomGenerator) const {
+    // Start the search from the initial state.
+    stack.clear();
+    stack.emplace_back(concurrentExploration.initialStateIndex, 0);
+    uint64_t version = concurrentExploration.version.load();
+
+    // As long as we didn't find a terminal (accepting or rejecting) state in the search, sample a new successor.
+    bool foundTerminalState = false;
+    while (!foundTerminalState) {
+        if (concurrentExploration.terminate.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        StateType currentStateId = stack.back().first;
+        boost::optional<storm::generator::CompressedState> unexploredState;
+        {
+            std::shared_lock<std::shared_mutex> lock(concurrentExploration.mutex);
+            if (concurrentExploration.version.load() != version) {
+                STORM_LOG_TRACE("Aborting sampling of path, because a precomputation changed the explored fragment.");
+                return false;
+            }
+
+            auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+            if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                unexploredState = unexploredIt->second;
+            } else if (explorationInformation.isTerminal(currentStateId)) {
+                STORM_LOG_TRACE("Found already explored terminal state: " << currentStateId << ".");
+                foundTerminalState = true;
+            } else {
+                ActionType chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, workerRandomGenerator);
+                stack.back().second = chosenAction;
+                StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, workerRandomGenerator);
+                STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
+                stack.emplace_back(successor, 0);
+            }
+        }
+
+        if (unexploredState) {
+            foundTerminalState =
+                exploreStateConcurrently(concurrentExploration, stateGeneration, currentStateId, *unexploredState, explorationInformation, bounds, stats);
+            if (!foundTerminalState) {
+                // The state is explored now, so the successor can be sampled right away.
+                continue;
+            }
+        }
+
+        // Notify the stats about the performed exploration step.
+        stats.explorationStep();
+
+        // If the number of exploration steps exceeds a certain threshold, trigger a precomputation.
+        if (!foundTerminalState && explorationInformation.performPrecomputationExcessiveExplorationSteps(stats.explorationStepsSinceLastPrecomputation)) {
+            triggerBackgroundPrecomputation(concurrentExploration, stack, explorationInformation, bounds);
+            STORM_LOG_TRACE("Aborting the search after triggering a precomputation.");
+            stack.clear();
+            return false;
+        }
+    }
+    stats.updateMaxPathLength(stack.size());
+
+    // Update the bounds along the path to the terminal state unless the explored fragment was restructured in the meantime.
+    std::unique_lock<std::shared_mutex> lock(concurrentExploration.mutex);
+    if (concurrentExploration.version.load() != version) {
+        return false;
+    }
+    STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+    updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+    return true;
+}
+
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::exploreStateConcurrently(ConcurrentExploration<StateType, ValueType>& concurrentExploration,
+                                                                                   StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                   StateType const& currentStateId,
+                                                                                   storm::generator::CompressedState const& currentState,
+                                                                                   ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                   Bounds<StateType, ValueType>& bounds,
+                                                                                   Statistics<StateType, ValueType>& stats) const {
+    // The behavior is generated without holding the lock, because registering newly discovered successors acquires it.
+    stateGeneration.load(currentState);
+    bool isTargetState = stateGeneration.isTargetState();
+    bool isConditionState = !isTargetState && stateGeneration.isConditionState();
+    storm::generator::StateBehavior<ValueType, StateType> behavior;
+    if (isConditionState) {
+        behavior = stateGeneration.expand();
+    }
+
+    std::unique_lock<std::shared_mutex> lock(concurrentExploration.mutex);
+    auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+    if (unexploredIt == explorationInformation.unexploredStatesEnd()) {
+        // Another worker explored the state in the meantime, so we drop the behavior we generated.
+        return explorationInformation.isTerminal(currentStateId);
+    }
+    bool isTerminalState = commitExploredState(currentStateId, isTargetState, isConditionState, behavior, explorationInformation, bounds, stats);
+    explorationInformation.removeUnexploredState(unexploredIt);
+    return isTerminalState;
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::triggerBackgroundPrecomputation(ConcurrentExploration<StateType, ValueType>& concurrentExploration,
+                                                                                          StateActionStack const& stack,
+                                                                                          ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                          Bounds<StateType, ValueType>& bounds) const {
+    // Workers that find another worker triggering a precomputation do not wait for it.
+    std::unique_lock<std::mutex> precomputationLock(concurrentExploration.precomputationMutex, std::try_to_lock);
+    if (!precomputationLock.owns_lock()) {
+        STORM_LOG_TRACE("Not triggering precomputation, because another worker is triggering one.");
+        return;
+    }
+
+    if (concurrentExploration.precomputation.valid()) {
+        if (concurrentExploration.precomputation.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            STORM_LOG_TRACE("Not triggering precomputation, because another one is still running.");
+            return;
+        }
+        // Collect the previous precomputation (in particular any exception it may have thrown).
+        concurrentExploration.precomputation.get();
+    }
+
+    concurrentExploration.precomputation = std::async(std::launch::async, [this, &concurrentExploration, &explorationInformation, &bounds, stack]() {
+        try {
+            Statistics<StateType, ValueType>& stats = concurrentExploration.precomputationStats;
+            ++stats.numberOfPrecomputations;
+            STORM_LOG_TRACE("Starting " << (explorationInformation.useLocalPrecomputation() ? "local" : "global") << " background precomputation.");
+
+            // Only building the matrix of the relevant fragment and applying the results block the workers. The analysis runs concurrently.
+            PrecomputationData<StateType, ValueType> data;
+            {
+                std::shared_lock<std::shared_mutex> lock(concurrentExploration.mutex);
+                data = preparePrecomputation(stack, explorationInformation, bounds);
+            }
+            analyzePrecomputation(data, explorationInformation, stats);
+            {
+                std::unique_lock<std::shared_mutex> lock(concurrentExploration.mutex);
+                if (applyPrecomputation(data, explorationInformation, bounds)) {
+                    ++concurrentExploration.version;
+                }
+            }
+        } catch (...) {
+            concurrentExploration.terminate.store(true);
+            throw;
+        }
+    });
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId,
                                                                        storm::generator::CompressedState const& currentState,
                                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
                                                                        Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+    // Before generating the behavior of the state, we need to determine whether it's a target state that
+    // does not need to be expanded.
+    stateGeneration.load(currentState);
+    bool isTargetState = stateGeneration.isTargetState();
+    bool isConditionState = !isTargetState && stateGeneration.isConditionState();
+    storm::generator::StateBehavior<ValueType, StateType> behavior;
+    if (isConditionState) {
+        STORM_LOG_TRACE("Exploring state.");
+
+        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
+        behavior = stateGeneration.expand();
+        STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
+    }
+    return commitExploredState(currentStateId, isTargetState, isConditionState, behavior, explorationInformation, bounds, stats);
+}
+
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::commitExploredState(StateType const& currentStateId, bool isTargetState, bool isConditionState,
+                                                                              storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                                                                              ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                              Bounds<StateType, ValueType>& bounds,
+                                                                              Statistics<StateType, ValueType>& stats) const {
     bool isTerminalState = false;
-    bool isTargetState = false;
 
     ++stats.numberOfExploredStates;
 
@@ -224,20 +516,10 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
     // all states that have been assigned to a row-group.
     bounds.initializeBoundsForNextState();
 
-    // Before generating the behavior of the state, we need to determine whether it's a target state that
-    // does not need to be expanded.
-    stateGeneration.load(currentState);
-    if (stateGeneration.isTargetState()) {
+    if (isTargetState) {
         ++stats.numberOfTargetStates;
-        isTargetState = true;
         isTerminalState = true;
-    } else if (stateGeneration.isConditionState()) {
-        STORM_LOG_TRACE("Exploring state.");
-
-        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
-        storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
-        STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
-
+    } else if (isConditionState) {
         // Clumsily check whether we have found a state that forms a trivial BMEC.
         bool otherSuccessor = false;
         for (auto const& choice : behavior) {
@@ -319,7 +601,8 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
 
 template<typename ModelType, typename StateType>
 typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(
-    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+    std::default_random_engine& randomEngine) const {
     // Determine the values of all available actions.
     std::vector<std::pair<ActionType, ValueType>> actionValues;
     StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -355,13 +638,13 @@ typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseE
 
     // Now sample from all maximizing actions.
     std::uniform_int_distribution<ActionType> distribution(0, std::distance(actionValues.begin(), end) - 1);
-    return actionValues[distribution(randomGenerator)].first;
+    return actionValues[distribution(randomEngine)].first;
 }
 
 template<typename ModelType, typename StateType>
 StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(
     ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-    Bounds<StateType, ValueType> const& bounds) const {
+    Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomEngine) const {
     std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
     if (row.size() == 1) {
         return row.front().getColumn();
@@ -382,11 +665,11 @@ StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFr
 
         // Now sample according to the probabilities.
         std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(randomEngine)].getColumn();
     } else {
         STORM_LOG_ASSERT(explorationInformation.useUniformHeuristic(), "Illegal next-state heuristic.");
         std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(randomEngine)].getColumn();
     }
 }
 
@@ -402,12 +685,23 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
     // 2. use this matrix to compute states with probability 0/1 and an MEC decomposition (in the max case).
     // 3. use MEC decomposition to collapse MECs.
     STORM_LOG_TRACE("Starting " << (explorationInformation.useLocalPrecomputation() ? "local" : "global") << " precomputation.");
+    PrecomputationData<StateType, ValueType> data = preparePrecomputation(stack, explorationInformation, bounds);
+    analyzePrecomputation(data, explorationInformation, stats);
+    applyPrecomputation(data, explorationInformation, bounds);
+    return true;
+}
+
+template<typename ModelType, typename StateType>
+PrecomputationData<StateType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::preparePrecomputation(
+    StateActionStack const& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation,
+    Bounds<StateType, ValueType> const& bounds) const {
+    PrecomputationData<StateType, ValueType> data;
 
     // Construct the matrix that represents the fragment of the system contained in the currently sampled path.
     storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true, 0);
 
     // Determine the set of states that was expanded.
-    std::vector<StateType> relevantStates;
+    std::vector<StateType>& relevantStates = data.relevantStates;
     if (explorationInformation.useLocalPrecomputation()) {
         for (auto const& stateActionPair : stack) {
             if (explorationInformation.maximize() || !storm::utility::isOne(bounds.getLowerBoundForState(stateActionPair.first, explorationInformation))) {
@@ -426,11 +720,13 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
         }
     }
     StateType sink = relevantStates.size();
+    data.sink = sink;
 
     // Create a mapping for faster look-up during the translation of flexible matrix to the real sparse matrix.
     // While doing so, record all target states.
     std::unordered_map<StateType, StateType> relevantStateToNewRowGroupMapping;
-    storm::storage::BitVector targetStates(sink + 1);
+    storm::storage::BitVector& targetStates = data.targetStates;
+    targetStates = storm::storage::BitVector(sink + 1);
     for (StateType index = 0; index < relevantStates.size(); ++index) {
         relevantStateToNewRowGroupMapping.emplace(relevantStates[index], index);
         if (storm::utility::isOne(bounds.getLowerBoundForState(relevantStates[index], explorationInformation))) {
@@ -464,13 +760,23 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
     // Then, make the unexpanded state absorbing.
     builder.newRowGroup(currentRow);
     builder.addNextValue(currentRow, sink, storm::utility::one<ValueType>());
-    storm::storage::SparseMatrix<ValueType> relevantStatesMatrix = builder.build();
-    storm::storage::SparseMatrix<ValueType> transposedMatrix = relevantStatesMatrix.transpose(true);
+    data.relevantStatesMatrix = builder.build();
     STORM_LOG_TRACE("Successfully built matrix for precomputation.");
+    return data;
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::analyzePrecomputation(PrecomputationData<StateType, ValueType>& data,
+                                                                                ExplorationInformation<StateType, ValueType> const& explorationInformation,
+                                                                                Statistics<StateType, ValueType>& stats) const {
+    storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix = data.relevantStatesMatrix;
+    storm::storage::SparseMatrix<ValueType> transposedMatrix = relevantStatesMatrix.transpose(true);
+    StateType sink = data.sink;
+    storm::storage::BitVector targetStates = data.targetStates;
 
     storm::storage::BitVector allStates(sink + 1, true);
-    storm::storage::BitVector statesWithProbability0;
-    storm::storage::BitVector statesWithProbability1;
+    storm::storage::BitVector& statesWithProbability0 = data.statesWithProbability0;
+    storm::storage::BitVector& statesWithProbability1 = data.statesWithProbability1;
     if (explorationInformation.maximize()) {
         // If we are computing maximal probabilities, we first perform a detection of states that have
         // probability 01 and then additionally perform an MEC decomposition. The reason for this somewhat
@@ -483,7 +789,8 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
         statesWithProbability1 =
             storm::utility::graph::performProb1E(relevantStatesMatrix, relevantStatesMatrix.getRowGroupIndices(), transposedMatrix, allStates, targetStates);
 
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(relevantStatesMatrix, relevantStatesMatrix.transpose(true));
+        data.mecDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(relevantStatesMatrix, transposedMatrix);
+        storm::storage::MaximalEndComponentDecomposition<ValueType> const& mecDecomposition = data.mecDecomposition;
         ++stats.ecDetections;
         STORM_LOG_TRACE("Successfully computed MEC decomposition. Found " << (mecDecomposition.size() > 1 ? (mecDecomposition.size() - 1) : 0) << " MEC(s).");
 
@@ -493,16 +800,6 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
             ++stats.failedEcDetections;
         } else {
             stats.totalNumberOfEcDetected += mecDecomposition.size() - 1;
-
-            // 3. Analyze the MEC decomposition.
-            for (auto const& mec : mecDecomposition) {
-                // Ignore the (expected) MEC of the sink state.
-                if (mec.containsState(sink)) {
-                    continue;
-                }
-
-                collapseMec(mec, relevantStates, relevantStatesMatrix, explorationInformation, bounds);
-            }
         }
     } else {
         // If we are computing minimal probabilities, we do not need to perform an EC-detection. We rather
@@ -517,9 +814,29 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
             storm::utility::graph::performProb1A(relevantStatesMatrix, relevantStatesMatrix.getRowGroupIndices(), transposedMatrix, allStates, targetStates);
     }
 
-    // Set the bounds of the identified states.
     STORM_LOG_ASSERT((statesWithProbability0 & statesWithProbability1).empty(), "States with probability 0 and 1 overlap.");
-    for (auto state : statesWithProbability0) {
+}
+
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::applyPrecomputation(PrecomputationData<StateType, ValueType> const& data,
+                                                                              ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                              Bounds<StateType, ValueType>& bounds) const {
+    std::vector<StateType> const& relevantStates = data.relevantStates;
+    StateType sink = data.sink;
+
+    // 3. Analyze the MEC decomposition.
+    bool collapsedMec = false;
+    for (auto const& mec : data.mecDecomposition) {
+        // Ignore the (expected) MEC of the sink state.
+        if (mec.containsState(sink)) {
+            continue;
+        }
+
+        collapsedMec |= collapseMec(mec, relevantStates, data.relevantStatesMatrix, explorationInformation, bounds);
+    }
+
+    // Set the bounds of the identified states.
+    for (auto state : data.statesWithProbability0) {
         // Skip the sink state as it is not contained in the original system.
         if (state == sink) {
             continue;
@@ -529,7 +846,7 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
         bounds.setUpperBoundForState(originalState, explorationInformation, storm::utility::zero<ValueType>());
         explorationInformation.addTerminalState(originalState);
     }
-    for (auto state : statesWithProbability1) {
+    for (auto state : data.statesWithProbability1) {
         // Skip the sink state as it is not contained in the original system.
         if (state == sink) {
             continue;
@@ -539,11 +856,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
         bounds.setLowerBoundForState(originalState, explorationInformation, storm::utility::one<ValueType>());
         explorationInformation.addTerminalState(originalState);
     }
-    return true;
+    return collapsedMec;
 }
 
 template<typename ModelType, typename StateType>
-void SparseExplorationModelChecker<ModelType, StateType>::collapseMec(storm::storage::MaximalEndComponent const& mec,
+bool SparseExplorationModelChecker<ModelType, StateType>::collapseMec(storm::storage::MaximalEndComponent const& mec,
                                                                       std::vector<StateType> const& relevantStates,
                                                                       storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix,
                                                                       ExplorationInformation<StateType, ValueType>& explorationInformation,
@@ -616,7 +933,9 @@ void SparseExplorationModelChecker<ModelType, StateType>::collapseMec(storm::sto
 
         // Terminate the row group of the newly introduced state.
         explorationInformation.terminateCurrentRowGroup();
+        return true;
     }
+    return false;
 }
 
 template<typename ModelType, typename StateType>
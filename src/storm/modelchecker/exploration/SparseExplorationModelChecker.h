@@ -8,6 +8,7 @@
 #include "storm/storage/prism/Program.h"
 
 #include "storm/generator/CompressedState.h"
+#include "storm/generator/StateBehavior.h"
 #include "storm/generator/VariableInformation.h"
 
 #include "storm/utility/ConstantsComparator.h"
@@ -35,6 +36,10 @@ template<typename StateType, typename ValueType>
 class Bounds;
 template<typename StateType, typename ValueType>
 struct Statistics;
+template<typename StateType, typename ValueType>
+struct PrecomputationData;
+template<typename StateType, typename ValueType>
+struct ConcurrentExploration;
 }  // namespace exploration_detail
 
 using namespace exploration_detail;
@@ -55,10 +60,41 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
                                                                    CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
 
+    /*!
+     * Sets the number of workers that concurrently sample paths (overriding the value given in the exploration settings).
+     * Zero means that the number of workers is determined based on the available cores.
+     */
+    void setNumberOfWorkers(uint64_t numberOfWorkers);
+
    private:
     std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                    ExplorationInformation<StateType, ValueType>& explorationInformation) const;
 
+    /*!
+     * Performs the exploration with several workers that concurrently sample paths and share the exploration information and the bounds.
+     * Precomputations are performed in the background while the workers keep sampling.
+     */
+    std::tuple<StateType, ValueType, ValueType> performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                             ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                             uint64_t numberOfWorkers) const;
+
+    void runConcurrentWorker(ConcurrentExploration<StateType, ValueType>& concurrentExploration, StateGeneration<StateType, ValueType>& stateGeneration,
+                             ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds,
+                             Statistics<StateType, ValueType>& stats, std::default_random_engine& workerRandomGenerator) const;
+
+    bool samplePathConcurrently(ConcurrentExploration<StateType, ValueType>& concurrentExploration, StateGeneration<StateType, ValueType>& stateGeneration,
+                                ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
+                                Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats,
+                                std::default_random_engine& workerRandomGenerator) const;
+
+    bool exploreStateConcurrently(ConcurrentExploration<StateType, ValueType>& concurrentExploration, StateGeneration<StateType, ValueType>& stateGeneration,
+                                  StateType const& currentStateId, storm::generator::CompressedState const& currentState,
+                                  ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds,
+                                  Statistics<StateType, ValueType>& stats) const;
+
+    void triggerBackgroundPrecomputation(ConcurrentExploration<StateType, ValueType>& concurrentExploration, StateActionStack const& stack,
+                                         ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
+
     bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                     ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
                                     Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -67,16 +103,38 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
                       storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation,
                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
 
+    /*!
+     * Inserts the (previously generated) behavior of the given state into the exploration information and initializes its bounds.
+     *
+     * @return True iff the state is a terminal state.
+     */
+    bool commitExploredState(StateType const& currentStateId, bool isTargetState, bool isConditionState,
+                             storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                             ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds,
+                             Statistics<StateType, ValueType>& stats) const;
+
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                   Bounds<StateType, ValueType>& bounds) const;
+                                   Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomEngine) const;
 
     StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                        Bounds<StateType, ValueType> const& bounds) const;
+                                        Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomEngine) const;
 
     bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation,
                                Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
 
-    void collapseMec(storm::storage::MaximalEndComponent const& mec, std::vector<StateType> const& relevantStates,
+    /*!
+     * The three phases of a precomputation: building the matrix of the relevant fragment (reads the exploration information), analyzing it (does not
+     * access the exploration information at all) and applying the results (modifies the exploration information and the bounds).
+     */
+    PrecomputationData<StateType, ValueType> preparePrecomputation(StateActionStack const& stack,
+                                                                   ExplorationInformation<StateType, ValueType> const& explorationInformation,
+                                                                   Bounds<StateType, ValueType> const& bounds) const;
+    void analyzePrecomputation(PrecomputationData<StateType, ValueType>& data, ExplorationInformation<StateType, ValueType> const& explorationInformation,
+                               Statistics<StateType, ValueType>& stats) const;
+    bool applyPrecomputation(PrecomputationData<StateType, ValueType> const& data, ExplorationInformation<StateType, ValueType>& explorationInformation,
+                             Bounds<StateType, ValueType>& bounds) const;
+
+    bool collapseMec(storm::storage::MaximalEndComponent const& mec, std::vector<StateType> const& relevantStates,
                      storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, ExplorationInformation<StateType, ValueType>& explorationInformation,
                      Bounds<StateType, ValueType>& bounds) const;
 
@@ -110,6 +168,9 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     // The random number generator.
     mutable std::default_random_engine randomGenerator;
 
+    // The number of workers that concurrently sample paths.
+    uint64_t numberOfWorkers;
+
     // A comparator used to determine whether values are equal.
     storm::utility::ConstantsComparator<ValueType> comparator;
 };
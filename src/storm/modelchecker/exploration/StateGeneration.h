@@ -1,6 +1,9 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 
+#include <memory>
+#include <shared_mutex>
+
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/PrismNextStateGenerator.h"
 
@@ -24,6 +27,13 @@ class StateGeneration {
     StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation,
                     storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression);
 
+    /*!
+     * Creates a state generation that shares the state storage with the given one. This is used by concurrent workers, each of which needs its own
+     * generator. Newly discovered states are registered while holding the given mutex exclusively.
+     */
+    StateGeneration(storm::prism::Program const& program, StateGeneration<StateType, ValueType> const& other,
+                    ExplorationInformation<StateType, ValueType>& explorationInformation, std::shared_mutex& explorationMutex);
+
     void load(storm::generator::CompressedState const& state);
 
     std::vector<StateType> getInitialStates();
@@ -41,10 +51,15 @@ class StateGeneration {
     bool isTargetState() const;
 
    private:
+    void initializeStateToIdCallback(ExplorationInformation<StateType, ValueType>& explorationInformation);
+
     storm::generator::PrismNextStateGenerator<ValueType, StateType> generator;
     std::function<StateType(storm::generator::CompressedState const&)> stateToIdCallback;
 
-    storm::storage::sparse::StateStorage<StateType> stateStorage;
+    std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> stateStorage;
+
+    // If set, the mutex that needs to be held when registering new states.
+    std::shared_mutex* explorationMutex;
 
     storm::expressions::Expression conditionStateExpression;
     storm::expressions::Expression targetStateExpression;
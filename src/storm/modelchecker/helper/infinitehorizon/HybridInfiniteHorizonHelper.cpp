@@ -9,6 +9,7 @@
 #include "storm/models/symbolic/NondeterministicModel.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/dd/ExecutionScope.h"
 
 #include "storm/utility/macros.h"
 
@@ -47,26 +48,34 @@ std::unique_ptr<HybridQuantitativeCheckResult<DdType, ValueType>>
 HybridInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::computeLongRunAverageProbabilities(Environment const& env,
                                                                                                      storm::dd::Bdd<DdType> const& psiStates) {
     // Convert this query to an instance for the sparse engine.
-    // Create ODD for the translation.
-    storm::dd::Odd odd = _model.getReachableStates().createOdd();
-    // Translate all required components
+    storm::dd::Odd odd;
     storm::storage::SparseMatrix<ValueType> explicitTransitionMatrix;
-    if (Nondeterministic) {
-        explicitTransitionMatrix = _transitionMatrix.toMatrix(
-            dynamic_cast<storm::models::symbolic::NondeterministicModel<DdType, ValueType> const&>(_model).getNondeterminismVariables(), odd, odd);
-    } else {
-        explicitTransitionMatrix = _transitionMatrix.toMatrix(odd, odd);
-    }
     std::vector<ValueType> explicitExitRateVector;
     storm::storage::BitVector explicitMarkovianStates;
-    if (isContinuousTime()) {
-        explicitExitRateVector = _exitRates->toVector(odd);
-        if (_markovianStates) {
-            explicitMarkovianStates = _markovianStates->toVector(odd);
+    storm::storage::BitVector explicitPsiStates;
+    // The conversion is run as a task of the DD library, only the sparse solver runs outside of it.
+    _model.getManager().execute([&]() {
+        // Create ODD for the translation.
+        odd = _model.getReachableStates().createOdd();
+        // Translate all required components
+        if (Nondeterministic) {
+            explicitTransitionMatrix = _transitionMatrix.toMatrix(
+                dynamic_cast<storm::models::symbolic::NondeterministicModel<DdType, ValueType> const&>(_model).getNondeterminismVariables(), odd, odd);
+        } else {
+            explicitTransitionMatrix = _transitionMatrix.toMatrix(odd, odd);
         }
-    }
+        if (isContinuousTime()) {
+            explicitExitRateVector = _exitRates->toVector(odd);
+            if (_markovianStates) {
+                explicitMarkovianStates = _markovianStates->toVector(odd);
+            }
+        }
+        explicitPsiStates = psiStates.toVector(odd);
+    });
     auto sparseHelper = createSparseHelper(explicitTransitionMatrix, explicitMarkovianStates, explicitExitRateVector, odd);
-    auto explicitResult = sparseHelper->computeLongRunAverageProbabilities(env, psiStates.toVector(odd));
+    // The workers of the DD library are not needed by the sparse computation, so they are suspended in the meantime.
+    storm::dd::SuspensionScope<DdType> suspensionScope;
+    auto explicitResult = sparseHelper->computeLongRunAverageProbabilities(env, explicitPsiStates);
     return std::make_unique<HybridQuantitativeCheckResult<DdType, ValueType>>(_model.getReachableStates(), _model.getManager().getBddZero(),
                                                                               _model.getManager().template getAddZero<ValueType>(), _model.getReachableStates(),
                                                                               std::move(odd), std::move(explicitResult));
@@ -77,47 +86,52 @@ std::unique_ptr<HybridQuantitativeCheckResult<DdType, ValueType>>
 HybridInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::computeLongRunAverageRewards(
     Environment const& env, storm::models::symbolic::StandardRewardModel<DdType, ValueType> const& rewardModel) {
     // Convert this query to an instance for the sparse engine.
-    // Create ODD for the translation.
-    storm::dd::Odd odd = _model.getReachableStates().createOdd();
-
-    // Translate all required components
-    // Transitions and rewards
+    storm::dd::Odd odd;
     storm::storage::SparseMatrix<ValueType> explicitTransitionMatrix;
     std::vector<ValueType> explicitStateRewards, explicitActionRewards;
-    if (rewardModel.hasStateRewards()) {
-        explicitStateRewards = rewardModel.getStateRewardVector().toVector(odd);
-    }
-    if (Nondeterministic && rewardModel.hasStateActionRewards()) {
-        // Matrix and action-based vector have to be produced at the same time to guarantee the correct order
-        auto matrixRewards = _transitionMatrix.toMatrixVector(
-            rewardModel.getStateActionRewardVector(),
-            dynamic_cast<storm::models::symbolic::NondeterministicModel<DdType, ValueType> const&>(_model).getNondeterminismVariables(), odd, odd);
-        explicitTransitionMatrix = std::move(matrixRewards.first);
-        explicitActionRewards = std::move(matrixRewards.second);
-    } else {
-        // Translate matrix only
-        if (Nondeterministic) {
-            explicitTransitionMatrix = _transitionMatrix.toMatrix(
+    std::vector<ValueType> explicitExitRateVector;
+    storm::storage::BitVector explicitMarkovianStates;
+    // The conversion is run as a task of the DD library, only the sparse solver runs outside of it.
+    _model.getManager().execute([&]() {
+        // Create ODD for the translation.
+        odd = _model.getReachableStates().createOdd();
+
+        // Translate all required components
+        // Transitions and rewards
+        if (rewardModel.hasStateRewards()) {
+            explicitStateRewards = rewardModel.getStateRewardVector().toVector(odd);
+        }
+        if (Nondeterministic && rewardModel.hasStateActionRewards()) {
+            // Matrix and action-based vector have to be produced at the same time to guarantee the correct order
+            auto matrixRewards = _transitionMatrix.toMatrixVector(
+                rewardModel.getStateActionRewardVector(),
                 dynamic_cast<storm::models::symbolic::NondeterministicModel<DdType, ValueType> const&>(_model).getNondeterminismVariables(), odd, odd);
+            explicitTransitionMatrix = std::move(matrixRewards.first);
+            explicitActionRewards = std::move(matrixRewards.second);
         } else {
-            explicitTransitionMatrix = _transitionMatrix.toMatrix(odd, odd);
+            // Translate matrix only
+            if (Nondeterministic) {
+                explicitTransitionMatrix = _transitionMatrix.toMatrix(
+                    dynamic_cast<storm::models::symbolic::NondeterministicModel<DdType, ValueType> const&>(_model).getNondeterminismVariables(), odd, odd);
+            } else {
+                explicitTransitionMatrix = _transitionMatrix.toMatrix(odd, odd);
+            }
+            if (rewardModel.hasStateActionRewards()) {
+                // For deterministic models we can translate the action rewards easily
+                explicitActionRewards = rewardModel.getStateActionRewardVector().toVector(odd);
+            }
         }
-        if (rewardModel.hasStateActionRewards()) {
-            // For deterministic models we can translate the action rewards easily
-            explicitActionRewards = rewardModel.getStateActionRewardVector().toVector(odd);
+        STORM_LOG_THROW(!rewardModel.hasTransitionRewards(), storm::exceptions::NotSupportedException, "Transition rewards are not supported in this engine.");
+        // Continuous time information
+        if (isContinuousTime()) {
+            explicitExitRateVector = _exitRates->toVector(odd);
+            if (_markovianStates) {
+                explicitMarkovianStates = _markovianStates->toVector(odd);
+            }
         }
-    }
-    STORM_LOG_THROW(!rewardModel.hasTransitionRewards(), storm::exceptions::NotSupportedException, "Transition rewards are not supported in this engine.");
-    // Continuous time information
-    std::vector<ValueType> explicitExitRateVector;
-    storm::storage::BitVector explicitMarkovianStates;
-    if (isContinuousTime()) {
-        explicitExitRateVector = _exitRates->toVector(odd);
-        if (_markovianStates) {
-            explicitMarkovianStates = _markovianStates->toVector(odd);
-        }
-    }
+    });
     auto sparseHelper = createSparseHelper(explicitTransitionMatrix, explicitMarkovianStates, explicitExitRateVector, odd);
+    storm::dd::SuspensionScope<DdType> suspensionScope;
     auto explicitResult = sparseHelper->computeLongRunAverageValues(env, rewardModel.hasStateRewards() ? &explicitStateRewards : nullptr,
                                                                     rewardModel.hasStateActionRewards() ? &explicitActionRewards : nullptr);
     return std::make_unique<HybridQuantitativeCheckResult<DdType, ValueType>>(_model.getReachableStates(), _model.getManager().getBddZero(),
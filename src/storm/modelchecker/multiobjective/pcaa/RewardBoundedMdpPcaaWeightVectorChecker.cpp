@@ -1,5 +1,6 @@
 #include "storm/modelchecker/multiobjective/pcaa/RewardBoundedMdpPcaaWeightVectorChecker.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -22,6 +23,8 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/parallelEnvironment.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -61,8 +64,8 @@ RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::~RewardBoundedMdpPc
         STORM_PRINT_AND_LOG("           #checked epochs overall: " << numCheckedEpochs << ".\n");
         STORM_PRINT_AND_LOG("# checked epochs per weight vector: " << numCheckedEpochs / numChecks << ".\n");
         STORM_PRINT_AND_LOG("                      overall Time: " << swAll << ".\n");
-        STORM_PRINT_AND_LOG("         Epoch Model building time: " << swEpochModelBuild << ".\n");
-        STORM_PRINT_AND_LOG("         Epoch Model checking time: " << swEpochModelAnalysis << ".\n");
+        STORM_PRINT_AND_LOG("                  Epoch model time: " << swEpochs << ".\n");
+        STORM_PRINT_AND_LOG("         Epoch Model checking time: " << swEpochModelAnalysis << " (summed over all threads).\n");
         STORM_PRINT_AND_LOG("--------------------------------------------------\n");
     }
 }
@@ -77,18 +80,30 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::check(Environm
 
     auto initEpoch = rewardUnfolding.getStartEpoch();
     auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
-    EpochCheckingData cachedData;
+    if (env.modelchecker().isEpochMemoryLimitSet()) {
+        rewardUnfolding.setSolutionMemoryLimit(env.modelchecker().getEpochMemoryLimit() * 1024 * 1024);
+    }
+    // Each thread that analyzes epochs maintains its own solver data
+    uint64_t numberOfThreads = storm::utility::parallel::resolveNumberOfThreads(env.modelchecker().getEpochThreads(), epochOrder.size());
+    std::vector<EpochCheckingData> cachedData(numberOfThreads);
+    std::vector<storm::utility::Stopwatch> swAnalyses(numberOfThreads);
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
         initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
     Environment newEnv = env;
     newEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
     newEnv.solver().setLinearEquationSolverPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
+    std::vector<Environment> threadEnvs = storm::utility::parallel::createThreadEnvironments(newEnv, numberOfThreads);
     storm::utility::ProgressMeasurement progress("epochs");
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
-    uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        computeEpochSolution(newEnv, epoch, weightVector, cachedData);
+    uint64_t numCheckedEpochsOfWeightVector = 0;
+    auto analyzeEpochModel = [&](uint64_t threadIndex, auto const&, auto& epochModel) {
+        swAnalyses[threadIndex].start();
+        auto solution = this->analyzeEpochModel(threadEnvs[threadIndex], epochModel, weightVector, cachedData[threadIndex]);
+        swAnalyses[threadIndex].stop();
+        return solution;
+    };
+    auto epochAnalyzed = [&](auto const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -104,10 +119,15 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::check(Environm
             cdfData.push_back(std::move(cdfEntry));
         }
         ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
-        }
+        ++numCheckedEpochsOfWeightVector;
+        progress.updateProgress(numCheckedEpochsOfWeightVector);
+        return !storm::utility::resources::isTerminate();
+    };
+    swEpochs.start();
+    rewardUnfolding.analyzeEpochs(epochOrder, numberOfThreads, analyzeEpochModel, epochAnalyzed);
+    swEpochs.stop();
+    for (auto const& swAnalysis : swAnalyses) {
+        swEpochModelAnalysis.add(swAnalysis);
     }
 
     if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
@@ -131,14 +151,10 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::check(Environm
 }
 
 template<class SparseMdpModelType>
-void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSolution(
-    Environment const& env, typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const& epoch,
-    std::vector<ValueType> const& weightVector, EpochCheckingData& cachedData) {
-    ++numCheckedEpochs;
-    swEpochModelBuild.start();
-    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-    swEpochModelBuild.stop();
-    swEpochModelAnalysis.start();
+std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<typename SparseMdpModelType::ValueType, false>::SolutionType>
+RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::analyzeEpochModel(Environment const& env,
+                                                                               helper::rewardbounded::EpochModel<ValueType, false>& epochModel,
+                                                                               std::vector<ValueType> const& weightVector, EpochCheckingData& cachedData) {
     std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> result;
     result.reserve(epochModel.epochInStates.getNumberOfSetBits());
     uint64_t solutionSize = this->objectives.size() + 1;
@@ -318,8 +334,7 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
             }
         }
     }
-    rewardUnfolding.setSolutionForCurrentEpoch(std::move(result));
-    swEpochModelAnalysis.stop();
+    return result;
 }
 
 template<class SparseMdpModelType>
@@ -60,13 +60,17 @@ class RewardBoundedMdpPcaaWeightVectorChecker : public PcaaWeightVectorChecker<S
         std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> solutions;
     };
 
-    void computeEpochSolution(Environment const& env, typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const& epoch,
-                              std::vector<ValueType> const& weightVector, EpochCheckingData& cachedData);
+    /*!
+     * Computes the solutions for the in-states of the given epoch model. Invocations with different cached data can be executed concurrently.
+     */
+    std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> analyzeEpochModel(
+        Environment const& env, helper::rewardbounded::EpochModel<ValueType, false>& epochModel, std::vector<ValueType> const& weightVector,
+        EpochCheckingData& cachedData);
 
     void updateCachedData(Environment const& env, typename helper::rewardbounded::EpochModel<ValueType, false> const& epochModel, EpochCheckingData& cachedData,
                           std::vector<ValueType> const& weightVector);
 
-    storm::utility::Stopwatch swAll, swEpochModelBuild, swEpochModelAnalysis;
+    storm::utility::Stopwatch swAll, swEpochs, swEpochModelAnalysis;
     uint64_t numCheckedEpochs, numChecks;
 
     helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false> rewardUnfolding;
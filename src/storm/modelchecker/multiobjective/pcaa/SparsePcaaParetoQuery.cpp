@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
@@ -63,37 +65,48 @@ void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchi
                     storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
     // First consider the objectives individually
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-        direction[objIndex] = storm::utility::one<GeometryValueType>();
-        this->performRefinementStep(env, std::move(direction));
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    uint_fast64_t objIndex = 0;
+    while (objIndex < this->objectives.size() && !this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
+        std::vector<WeightVector> directions;
+        for (uint64_t batchSize = this->getRefinementBatchSize(env); directions.size() < batchSize && objIndex < this->objectives.size(); ++objIndex) {
+            directions.emplace_back(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+            directions.back()[objIndex] = storm::utility::one<GeometryValueType>();
         }
+        this->performRefinementSteps(env, std::move(directions));
     }
 
+    GeometryValueType precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+        // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation.
+        // If multiple weight vectors are checked concurrently, we take the normal vectors of the halfspaces with the largest distances.
         std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
         std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-        uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+        std::vector<std::pair<GeometryValueType, uint_fast64_t>> halfspaceDistances;
         for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+            GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
             for (auto const& vertex : overApproxVertices) {
-                GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                if (distance > farestDistance) {
-                    farestHalfspaceIndex = halfspaceIndex;
-                    farestDistance = distance;
-                }
+                farestDistance = std::max(farestDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
+            }
+            if (farestDistance >= precision) {
+                halfspaceDistances.emplace_back(std::move(farestDistance), halfspaceIndex);
             }
         }
-        if (farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+        if (halfspaceDistances.empty()) {
             // Goal precision reached!
             return;
         }
-        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-        WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-        this->performRefinementStep(env, std::move(direction));
+        std::stable_sort(halfspaceDistances.begin(), halfspaceDistances.end(), [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first; });
+        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~"
+                       << storm::utility::convertNumber<double>(halfspaceDistances.front().first));
+        std::vector<WeightVector> directions;
+        uint64_t batchSize = this->getRefinementBatchSize(env);
+        for (auto const& halfspaceDistance : halfspaceDistances) {
+            if (directions.size() == batchSize) {
+                break;
+            }
+            directions.push_back(underApproxHalfspaces[halfspaceDistance.second].normalVector());
+        }
+        this->performRefinementSteps(env, std::move(directions));
     }
     STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
 }
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/io/export.h"
@@ -12,6 +15,8 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/geometry/Hyperrectangle.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/parallelEnvironment.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnexpectedException.h"
@@ -29,7 +34,10 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::~SparsePcaaQuery() {
 
 template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
-    : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+    : originalModel(preprocessorResult.originalModel),
+      originalFormula(preprocessorResult.originalFormula),
+      objectives(preprocessorResult.objectives),
+      preprocessorResult(preprocessorResult) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
@@ -89,16 +97,57 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
 
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
+    refinementSteps.push_back(computeRefinementStep(env, std::move(direction), *weightVectorChecker));
+
+    updateOverApproximation(refinementSteps.back());
+    updateUnderApproximation();
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    if (directions.size() == 1) {
+        performRefinementStep(env, std::move(directions.front()));
+        return;
+    }
+
+    // Make sure that there is one weight vector checker for each direction
+    while (additionalWeightVectorCheckers.size() + 1 < directions.size()) {
+        additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+    }
+    for (auto& checker : additionalWeightVectorCheckers) {
+        checker->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+    }
+
+    std::vector<Environment> directionEnvs = storm::utility::parallel::createThreadEnvironments(env, directions.size());
+    std::vector<RefinementStep> steps(directions.size());
+    storm::utility::parallel::forEachTask(directions.size(), directions.size(), [&](uint64_t, uint64_t directionIndex) {
+        auto& checker = directionIndex == 0 ? *weightVectorChecker : *additionalWeightVectorCheckers[directionIndex - 1];
+        steps[directionIndex] = computeRefinementStep(directionEnvs[directionIndex], std::move(directions[directionIndex]), checker);
+    });
+
+    uint64_t firstNewStep = refinementSteps.size();
+    for (auto& step : steps) {
+        refinementSteps.push_back(std::move(step));
+    }
+    for (uint64_t stepIndex = firstNewStep; stepIndex < refinementSteps.size(); ++stepIndex) {
+        updateOverApproximation(refinementSteps[stepIndex]);
+    }
+    updateUnderApproximation();
+}
+
+template<class SparseModelType, typename GeometryValueType>
+typename SparsePcaaQuery<SparseModelType, GeometryValueType>::RefinementStep SparsePcaaQuery<SparseModelType, GeometryValueType>::computeRefinementStep(
+    Environment const& env, WeightVector&& direction, PcaaWeightVectorChecker<SparseModelType>& checker) const {
     // Normalize the direction vector so that the entries sum up to one
     storm::utility::vector::scaleVectorInPlace(
         direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+    checker.check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
     STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                        storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
     RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+    step.weightVector = std::move(direction);
+    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
     // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -106,16 +155,23 @@ void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(
             step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
         }
     }
-    refinementSteps.push_back(std::move(step));
+    return step;
+}
 
-    updateOverApproximation();
-    updateUnderApproximation();
+template<class SparseModelType, typename GeometryValueType>
+uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getRefinementBatchSize(Environment const& env) const {
+    uint64_t result = storm::utility::parallel::resolveNumberOfThreads(env.modelchecker().multi().getParetoThreads(), std::numeric_limits<uint64_t>::max());
+    if (env.modelchecker().multi().isMaxStepsSet()) {
+        uint64_t maxSteps = env.modelchecker().multi().getMaxSteps();
+        result = std::min<uint64_t>(result, maxSteps > refinementSteps.size() ? maxSteps - refinementSteps.size() : 0);
+    }
+    return result;
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation() {
-    storm::storage::geometry::Halfspace<GeometryValueType> h(
-        refinementSteps.back().weightVector, storm::utility::vector::dotProduct(refinementSteps.back().weightVector, refinementSteps.back().upperBoundPoint));
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation(RefinementStep const& newStep) {
+    storm::storage::geometry::Halfspace<GeometryValueType> h(newStep.weightVector,
+                                                             storm::utility::vector::dotProduct(newStep.weightVector, newStep.upperBoundPoint));
 
     // Due to numerical issues, it might be the case that the updated overapproximation does not contain the underapproximation,
     // e.g., when the new point is strictly contained in the underapproximation. Check if this is the case.
@@ -127,7 +183,7 @@ void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximatio
         // We correct the issue by shifting the halfspace such that it contains the underapproximation
         h.offset() = maximumOffset;
         STORM_LOG_WARN("Numerical issues: The overapproximation would not contain the underapproximation. Hence, a halfspace is shifted by "
-                       << storm::utility::convertNumber<double>(h.invert().euclideanDistance(refinementSteps.back().upperBoundPoint)) << ".");
+                       << storm::utility::convertNumber<double>(h.invert().euclideanDistance(newStep.upperBoundPoint)) << ".");
     }
     overApproximation = overApproximation->intersection(h);
     STORM_LOG_DEBUG("Updated OverApproximation to " << overApproximation->toString(true));
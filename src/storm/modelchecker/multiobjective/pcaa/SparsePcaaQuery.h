@@ -69,11 +69,23 @@ class SparsePcaaQuery {
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
     /*
-     * Updates the overapproximation after a refinement step has been performed
+     * Refines the current result w.r.t. each of the given direction vectors. The directions are checked concurrently, each on a separate weight vector
+     * checker. The approximations are updated once all directions have been checked.
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
+    /*
+     * Returns the number of direction vectors that should be passed to performRefinementSteps, taking into account the number of threads for
+     * concurrent weight vector checks and the maximum number of refinement steps.
+     */
+    uint64_t getRefinementBatchSize(Environment const& env) const;
+
+    /*
+     * Updates the overapproximation after the given refinement step has been performed
      *
-     * @note The last entry of this->refinementSteps should be the newest step whose information is not yet included in the approximation.
+     * @note The given step should already be contained in this->refinementSteps but its information is not yet included in the approximation.
      */
-    void updateOverApproximation();
+    void updateOverApproximation(RefinementStep const& newStep);
 
     /*
      * Updates the underapproximation after a refinement step has been performed
@@ -87,6 +99,11 @@ class SparsePcaaQuery {
      */
     bool maxStepsPerformed(Environment const& env) const;
 
+    /*
+     * Checks the given direction on the given weight vector checker and returns the obtained information.
+     */
+    RefinementStep computeRefinementStep(Environment const& env, WeightVector&& direction, PcaaWeightVectorChecker<SparseModelType>& checker) const;
+
     SparseModelType const& originalModel;
     storm::logic::MultiObjectiveFormula const& originalFormula;
 
@@ -94,6 +111,9 @@ class SparsePcaaQuery {
 
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+    // Further weight vector checkers for concurrent refinement steps. They are created on demand from the preprocessor result.
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
+    preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> preprocessorResult;
 
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
@@ -1,17 +1,27 @@
 #include "storm/modelchecker/prctl/helper/HybridDtmcPrctlHelper.h"
 
+#include <algorithm>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ExecutionScope.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/SparseMatrixStream.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/vector.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -32,6 +42,57 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+// Determines whether the given matrix has more entries than the hybrid engine may store explicitly. Such matrices are converted block by block
+// (see storm::dd::SparseMatrixStream). Since iterative computations on such matrices use value iteration, they are only supported for inexact
+// value types.
+template<storm::dd::DdType DdType, typename ValueType>
+inline bool requiresMatrixStream(Environment const& env, storm::dd::Add<DdType, ValueType> const& matrix, bool iterative) {
+    if (!env.modelchecker().isHybridMatrixEntryLimitSet() || matrix.getNonZeroCount() <= env.modelchecker().getHybridMatrixEntryLimit()) {
+        return false;
+    }
+    bool supported = !iterative || !storm::NumberTraits<ValueType>::IsExact;
+    STORM_LOG_WARN_COND(supported, "Ignoring the matrix entry limit of the hybrid engine, because the values need to be computed exactly.");
+    return supported;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+inline storm::dd::SparseMatrixStream<DdType, ValueType> createMatrixStream(Environment const& env,
+                                                                           storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                                           storm::dd::Add<DdType, ValueType> const& matrix, storm::dd::Odd const& odd) {
+    // The blocks are small compared to the limit, such that most of the limit can be used to keep blocks across iterations.
+    uint64_t entryLimit = env.modelchecker().getHybridMatrixEntryLimit();
+    uint64_t maximalBlockEntries = std::max<uint64_t>(1, entryLimit / 8);
+    return storm::dd::SparseMatrixStream<DdType, ValueType>(matrix, model.getRowVariables(), model.getColumnVariables(), odd, odd, maximalBlockEntries,
+                                                            entryLimit - maximalBlockEntries);
+}
+
+// Solves x = A*x + b by value iteration, where A is converted block by block in every iteration. The precision and the maximal number of
+// iterations are taken from the native solver environment.
+template<storm::dd::DdType DdType, typename ValueType>
+inline void solveEquationsWithMatrixStream(Environment const& env, storm::dd::SparseMatrixStream<DdType, ValueType>& matrix, std::vector<ValueType>& x,
+                                           std::vector<ValueType> const& b) {
+    if constexpr (storm::NumberTraits<ValueType>::IsExact) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Value iteration on streamed matrices is not supported for exact values.");
+    } else {
+        ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+        bool relative = env.solver().native().getRelativeTerminationCriterion();
+        uint64_t maximalNumberOfIterations = env.solver().native().getMaximalNumberOfIterations();
+
+        std::vector<ValueType> newX(x.size());
+        uint64_t iterations = 0;
+        bool converged = false;
+        while (!converged && iterations < maximalNumberOfIterations) {
+            matrix.multiply(x, &b, newX);
+            converged = storm::utility::vector::equalModuloPrecision(x, newX, precision, relative);
+            std::swap(x, newX);
+            ++iterations;
+        }
+        STORM_LOG_WARN_COND(converged, "Value iteration did not converge within " << iterations << " iterations.");
+        STORM_LOG_INFO("Value iteration on matrix with " << matrix.getEntryCount() << " entries in " << matrix.getNumberOfBlocks() << " blocks took "
+                                                         << iterations << " iterations and " << matrix.getNumberOfBlockConversions() << " block conversions.");
+    }
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env,
                                                                                                  storm::models::symbolic::Model<DdType, ValueType> const& model,
@@ -41,9 +102,13 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
     // We need to identify the states which have to be taken out of the matrix, i.e. all states that have
     // probability 0 and 1 of satisfying the until-formula.
     STORM_LOG_TRACE("Found " << phiStates.getNonZeroCount() << " phi states and " << psiStates.getNonZeroCount() << " psi states.");
-    std::pair<storm::dd::Bdd<DdType>, storm::dd::Bdd<DdType>> statesWithProbability01 =
-        storm::utility::graph::performProb01(model, transitionMatrix.notZero(), phiStates, psiStates);
-    storm::dd::Bdd<DdType> maybeStates = !statesWithProbability01.first && !statesWithProbability01.second && model.getReachableStates();
+    // The DD-heavy parts are run as tasks of the DD library, only the sparse solver runs outside of them.
+    std::pair<storm::dd::Bdd<DdType>, storm::dd::Bdd<DdType>> statesWithProbability01;
+    storm::dd::Bdd<DdType> maybeStates;
+    model.getManager().execute([&]() {
+        statesWithProbability01 = storm::utility::graph::performProb01(model, transitionMatrix.notZero(), phiStates, psiStates);
+        maybeStates = !statesWithProbability01.first && !statesWithProbability01.second && model.getReachableStates();
+    });
 
     STORM_LOG_INFO("Preprocessing: " << statesWithProbability01.first.getNonZeroCount() << " states with probability 0, "
                                      << statesWithProbability01.second.getNonZeroCount() << " with probability 1 (" << maybeStates.getNonZeroCount()
@@ -61,24 +126,33 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
         if (!maybeStates.isZero()) {
             storm::utility::Stopwatch conversionWatch;
 
-            // Create the ODD for the translation between symbolic and explicit storage.
-            conversionWatch.start();
-            storm::dd::Odd odd = maybeStates.createOdd();
-            conversionWatch.stop();
-
-            // Create the matrix and the vector for the equation system.
-            storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
-
-            // Start by cutting away all rows that do not belong to maybe states. Note that this leaves columns targeting
-            // non-maybe states in the matrix.
-            storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * maybeStatesAdd;
-
-            // Then compute the vector that contains the one-step probabilities to a state with probability 1 for all
-            // maybe states.
-            storm::dd::Add<DdType, ValueType> prob1StatesAsColumn = statesWithProbability01.second.template toAdd<ValueType>();
-            prob1StatesAsColumn = prob1StatesAsColumn.swapVariables(model.getRowColumnMetaVariablePairs());
-            storm::dd::Add<DdType, ValueType> subvector = submatrix * prob1StatesAsColumn;
-            subvector = subvector.sumAbstract(model.getColumnVariables());
+            storm::dd::Odd odd;
+            storm::dd::Add<DdType, ValueType> maybeStatesAdd;
+            storm::dd::Add<DdType, ValueType> submatrix;
+            storm::dd::Add<DdType, ValueType> subvector;
+            model.getManager().execute([&]() {
+                // Create the ODD for the translation between symbolic and explicit storage.
+                conversionWatch.start();
+                odd = maybeStates.createOdd();
+                conversionWatch.stop();
+
+                // Create the matrix and the vector for the equation system.
+                maybeStatesAdd = maybeStates.template toAdd<ValueType>();
+
+                // Start by cutting away all rows that do not belong to maybe states. Note that this leaves columns targeting
+                // non-maybe states in the matrix.
+                submatrix = transitionMatrix * maybeStatesAdd;
+
+                // Then compute the vector that contains the one-step probabilities to a state with probability 1 for all
+                // maybe states.
+                storm::dd::Add<DdType, ValueType> prob1StatesAsColumn = statesWithProbability01.second.template toAdd<ValueType>();
+                prob1StatesAsColumn = prob1StatesAsColumn.swapVariables(model.getRowColumnMetaVariablePairs());
+                subvector = submatrix * prob1StatesAsColumn;
+                subvector = subvector.sumAbstract(model.getColumnVariables());
+
+                // Finally cut away all columns targeting non-maybe states.
+                submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+            });
 
             storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
             auto req = linearEquationSolverFactory.getRequirements(env);
@@ -91,26 +165,39 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
 
-            // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
-            // into the matrix needed for solving the equation system (i.e. compute (I-A)).
-            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-            if (convertToEquationSystem) {
-                submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
-            }
-
             // Create the solution vector.
             std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::convertNumber<ValueType>(0.5));
 
-            // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
-            conversionWatch.start();
-            storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
-            std::vector<ValueType> b = subvector.toVector(odd);
-            conversionWatch.stop();
-            STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
-
-            std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
-            solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
-            solver->solveEquations(env, x, b);
+            if (requiresMatrixStream(env, submatrix, true)) {
+                // The matrix is too large to be converted as a whole, so we perform value iteration on the matrix block by block.
+                std::vector<ValueType> b = subvector.toVector(odd);
+                storm::dd::SparseMatrixStream<DdType, ValueType> matrixStream = createMatrixStream(env, model, submatrix, odd);
+                // Value iteration starts from the lower bound.
+                std::fill(x.begin(), x.end(), storm::utility::zero<ValueType>());
+                solveEquationsWithMatrixStream(env, matrixStream, x, b);
+            } else {
+                storm::storage::SparseMatrix<ValueType> explicitSubmatrix;
+                std::vector<ValueType> b;
+                model.getManager().execute([&]() {
+                    // Potentially convert the matrix into the matrix needed for solving the equation system (i.e. compute (I-A)).
+                    if (convertToEquationSystem) {
+                        submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
+                    }
+
+                    // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
+                    conversionWatch.start();
+                    explicitSubmatrix = submatrix.toMatrix(odd, odd);
+                    b = subvector.toVector(odd);
+                    conversionWatch.stop();
+                });
+                STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+                solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+                // The workers of the DD library are not needed by the sparse computation, so they are suspended in the meantime.
+                storm::dd::SuspensionScope<DdType> suspensionScope;
+                solver->solveEquations(env, x, b);
+            }
 
             // Return a hybrid check result that stores the numerical values explicitly.
             return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
@@ -182,15 +269,20 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeBo
         // Create the solution vector.
         std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::zero<ValueType>());
 
-        // Translate the symbolic matrix/vector to their explicit representations.
-        conversionWatch.start();
-        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
-        std::vector<ValueType> b = subvector.toVector(odd);
-        conversionWatch.stop();
-        STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+        if (requiresMatrixStream(env, submatrix, false)) {
+            std::vector<ValueType> b = subvector.toVector(odd);
+            createMatrixStream(env, model, submatrix, odd).repeatedMultiply(x, &b, stepBound);
+        } else {
+            // Translate the symbolic matrix/vector to their explicit representations.
+            conversionWatch.start();
+            storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+            std::vector<ValueType> b = subvector.toVector(odd);
+            conversionWatch.stop();
+            STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitSubmatrix);
-        multiplier->repeatedMultiply(env, x, &b, stepBound);
+            auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitSubmatrix);
+            multiplier->repeatedMultiply(env, x, &b, stepBound);
+        }
 
         // Return a hybrid check result that stores the numerical values explicitly.
         return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
@@ -217,14 +309,19 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeIn
     // Create the solution vector (and initialize it to the state rewards of the model).
     std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
 
-    // Translate the symbolic matrix to its explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
-    conversionWatch.stop();
-    STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+    if (requiresMatrixStream(env, transitionMatrix, false)) {
+        conversionWatch.stop();
+        createMatrixStream(env, model, transitionMatrix, odd).repeatedMultiply(x, nullptr, stepBound);
+    } else {
+        // Translate the symbolic matrix to its explicit representations.
+        storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+        conversionWatch.stop();
+        STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-    // Perform the matrix-vector multiplication.
-    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
-    multiplier->repeatedMultiply(env, x, nullptr, stepBound);
+        // Perform the matrix-vector multiplication.
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+        multiplier->repeatedMultiply(env, x, nullptr, stepBound);
+    }
 
     // Return a hybrid check result that stores the numerical values explicitly.
     return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(
@@ -250,15 +347,20 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeCu
     // Create the ODD for the translation between symbolic and explicit storage.
     storm::dd::Odd odd = model.getReachableStates().createOdd();
 
-    // Translate the symbolic matrix/vector to their explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
     std::vector<ValueType> b = totalRewardVector.toVector(odd);
-    conversionWatch.stop();
-    STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+    if (requiresMatrixStream(env, transitionMatrix, false)) {
+        conversionWatch.stop();
+        createMatrixStream(env, model, transitionMatrix, odd).repeatedMultiply(x, &b, stepBound);
+    } else {
+        // Translate the symbolic matrix to its explicit representation.
+        storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+        conversionWatch.stop();
+        STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-    // Perform the matrix-vector multiplication.
-    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
-    multiplier->repeatedMultiply(env, x, &b, stepBound);
+        // Perform the matrix-vector multiplication.
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+        multiplier->repeatedMultiply(env, x, &b, stepBound);
+    }
 
     // Return a hybrid check result that stores the numerical values explicitly.
     return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(
@@ -289,9 +391,14 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
     STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Missing reward model for formula. Skipping formula.");
 
     // Determine which states have a reward of infinity by definition.
-    storm::dd::Bdd<DdType> infinityStates = storm::utility::graph::performProb1(model, transitionMatrix.notZero(), model.getReachableStates(), targetStates);
-    infinityStates = !infinityStates && model.getReachableStates();
-    storm::dd::Bdd<DdType> maybeStates = (!targetStates && !infinityStates) && model.getReachableStates();
+    // The DD-heavy parts are run as tasks of the DD library, only the sparse solver runs outside of them.
+    storm::dd::Bdd<DdType> infinityStates;
+    storm::dd::Bdd<DdType> maybeStates;
+    model.getManager().execute([&]() {
+        infinityStates = storm::utility::graph::performProb1(model, transitionMatrix.notZero(), model.getReachableStates(), targetStates);
+        infinityStates = !infinityStates && model.getReachableStates();
+        maybeStates = (!targetStates && !infinityStates) && model.getReachableStates();
+    });
 
     STORM_LOG_INFO("Preprocessing: " << infinityStates.getNonZeroCount() << " states with reward infinity, " << targetStates.getNonZeroCount()
                                      << " target states (" << maybeStates.getNonZeroCount() << " states remaining).");
@@ -309,34 +416,14 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
         if (!maybeStates.isZero()) {
             storm::utility::Stopwatch conversionWatch;
 
-            // Create the ODD for the translation between symbolic and explicit storage.
-            conversionWatch.start();
-            storm::dd::Odd odd = maybeStates.createOdd();
-            conversionWatch.stop();
-
-            // Create the matrix and the vector for the equation system.
-            storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
-
-            // Start by cutting away all rows that do not belong to maybe states. Note that this leaves columns targeting
-            // non-maybe states in the matrix.
-            storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * maybeStatesAdd;
-
-            // Then compute the state reward vector to use in the computation.
-            storm::dd::Add<DdType, ValueType> subvector = rewardModel.getTotalRewardVector(maybeStatesAdd, submatrix, model.getColumnVariables());
-
             // Check the requirements of a linear equation solver
             // We might need to compute upper reward bounds for which the oneStepTargetProbabilities are needed.
             boost::optional<storm::dd::Add<DdType, ValueType>> oneStepTargetProbs;
             storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
             auto req = linearEquationSolverFactory.getRequirements(env);
             req.clearLowerBounds();
-            if (req.upperBounds()) {
-                storm::dd::Add<DdType, ValueType> targetStatesAsColumn = targetStates.template toAdd<ValueType>();
-                targetStatesAsColumn = targetStatesAsColumn.swapVariables(model.getRowColumnMetaVariablePairs());
-                oneStepTargetProbs = submatrix * targetStatesAsColumn;
-                oneStepTargetProbs = oneStepTargetProbs->sumAbstract(model.getColumnVariables());
-                req.clearUpperBounds();
-            }
+            bool computeOneStepTargetProbs = req.upperBounds();
+            req.clearUpperBounds();
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                             "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
 
@@ -344,38 +431,85 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
 
-            // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
-            // into the matrix needed for solving the equation system (i.e. compute (I-A)).
-            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-            if (convertToEquationSystem) {
-                submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
-            }
+            storm::dd::Odd odd;
+            storm::dd::Add<DdType, ValueType> maybeStatesAdd;
+            storm::dd::Add<DdType, ValueType> submatrix;
+            storm::dd::Add<DdType, ValueType> subvector;
+            model.getManager().execute([&]() {
+                // Create the ODD for the translation between symbolic and explicit storage.
+                conversionWatch.start();
+                odd = maybeStates.createOdd();
+                conversionWatch.stop();
+
+                // Create the matrix and the vector for the equation system.
+                maybeStatesAdd = maybeStates.template toAdd<ValueType>();
+
+                // Start by cutting away all rows that do not belong to maybe states. Note that this leaves columns targeting
+                // non-maybe states in the matrix.
+                submatrix = transitionMatrix * maybeStatesAdd;
+
+                // Then compute the state reward vector to use in the computation.
+                subvector = rewardModel.getTotalRewardVector(maybeStatesAdd, submatrix, model.getColumnVariables());
+
+                if (computeOneStepTargetProbs) {
+                    storm::dd::Add<DdType, ValueType> targetStatesAsColumn = targetStates.template toAdd<ValueType>();
+                    targetStatesAsColumn = targetStatesAsColumn.swapVariables(model.getRowColumnMetaVariablePairs());
+                    oneStepTargetProbs = submatrix * targetStatesAsColumn;
+                    oneStepTargetProbs = oneStepTargetProbs->sumAbstract(model.getColumnVariables());
+                }
+
+                // Finally cut away all columns targeting non-maybe states.
+                submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+            });
 
             // Create the solution vector.
             std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::convertNumber<ValueType>(0.5));
 
-            // Translate the symbolic matrix/vector to their explicit representations.
-            conversionWatch.start();
-            storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
-            std::vector<ValueType> b = subvector.toVector(odd);
-            conversionWatch.stop();
-            STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
-
-            // Create the upper bounds vector if one was requested.
-            boost::optional<std::vector<ValueType>> upperBounds;
-            if (oneStepTargetProbs) {
-                // FIXME: This will fail if we already converted the matrix to the equation problem format.
-                STORM_LOG_ASSERT(!convertToEquationSystem, "Upper reward bounds required, but the matrix is in the wrong format for the computation.");
-                upperBounds = computeUpperRewardBounds(explicitSubmatrix, b, oneStepTargetProbs->toVector(odd));
-            }
-
-            // Now solve the resulting equation system.
-            std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
-            solver->setLowerBound(storm::utility::zero<ValueType>());
-            if (upperBounds) {
-                solver->setUpperBounds(std::move(upperBounds.get()));
+            if (requiresMatrixStream(env, submatrix, true)) {
+                // The matrix is too large to be converted as a whole, so we perform value iteration on the matrix block by block.
+                std::vector<ValueType> b = subvector.toVector(odd);
+                storm::dd::SparseMatrixStream<DdType, ValueType> matrixStream = createMatrixStream(env, model, submatrix, odd);
+                // Value iteration starts from the lower bound.
+                std::fill(x.begin(), x.end(), storm::utility::zero<ValueType>());
+                solveEquationsWithMatrixStream(env, matrixStream, x, b);
+            } else {
+                storm::storage::SparseMatrix<ValueType> explicitSubmatrix;
+                std::vector<ValueType> b;
+                std::vector<ValueType> oneStepTargetProbsVector;
+                model.getManager().execute([&]() {
+                    // Potentially convert the matrix into the matrix needed for solving the equation system (i.e. compute (I-A)).
+                    if (convertToEquationSystem) {
+                        submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
+                    }
+
+                    // Translate the symbolic matrix/vector to their explicit representations.
+                    conversionWatch.start();
+                    explicitSubmatrix = submatrix.toMatrix(odd, odd);
+                    b = subvector.toVector(odd);
+                    if (oneStepTargetProbs) {
+                        oneStepTargetProbsVector = oneStepTargetProbs->toVector(odd);
+                    }
+                    conversionWatch.stop();
+                });
+                STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+
+                // Create the upper bounds vector if one was requested.
+                boost::optional<std::vector<ValueType>> upperBounds;
+                if (oneStepTargetProbs) {
+                    // FIXME: This will fail if we already converted the matrix to the equation problem format.
+                    STORM_LOG_ASSERT(!convertToEquationSystem, "Upper reward bounds required, but the matrix is in the wrong format for the computation.");
+                    upperBounds = computeUpperRewardBounds(explicitSubmatrix, b, oneStepTargetProbsVector);
+                }
+
+                // Now solve the resulting equation system.
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+                solver->setLowerBound(storm::utility::zero<ValueType>());
+                if (upperBounds) {
+                    solver->setUpperBounds(std::move(upperBounds.get()));
+                }
+                storm::dd::SuspensionScope<DdType> suspensionScope;
+                solver->solveEquations(env, x, b);
             }
-            solver->solveEquations(env, x, b);
 
             // Return a hybrid check result that stores the numerical values explicitly.
             return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
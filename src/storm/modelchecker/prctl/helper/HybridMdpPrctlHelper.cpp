@@ -6,6 +6,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ExecutionScope.h"
 #include "storm/storage/dd/Odd.h"
 
 #include "storm/utility/constants.h"
@@ -140,14 +141,19 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
     bool qualitative) {
     // We need to identify the states which have to be taken out of the matrix, i.e. all states that have
     // probability 0 and 1 of satisfying the until-formula.
-    storm::dd::Bdd<DdType> transitionMatrixBdd = transitionMatrix.notZero();
+    // The DD-heavy parts are run as tasks of the DD library, only the sparse solver runs outside of them.
+    storm::dd::Bdd<DdType> transitionMatrixBdd;
     std::pair<storm::dd::Bdd<DdType>, storm::dd::Bdd<DdType>> statesWithProbability01;
-    if (dir == OptimizationDirection::Minimize) {
-        statesWithProbability01 = storm::utility::graph::performProb01Min(model, transitionMatrixBdd, phiStates, psiStates);
-    } else {
-        statesWithProbability01 = storm::utility::graph::performProb01Max(model, transitionMatrixBdd, phiStates, psiStates);
-    }
-    storm::dd::Bdd<DdType> maybeStates = !statesWithProbability01.first && !statesWithProbability01.second && model.getReachableStates();
+    storm::dd::Bdd<DdType> maybeStates;
+    model.getManager().execute([&]() {
+        transitionMatrixBdd = transitionMatrix.notZero();
+        if (dir == OptimizationDirection::Minimize) {
+            statesWithProbability01 = storm::utility::graph::performProb01Min(model, transitionMatrixBdd, phiStates, psiStates);
+        } else {
+            statesWithProbability01 = storm::utility::graph::performProb01Max(model, transitionMatrixBdd, phiStates, psiStates);
+        }
+        maybeStates = !statesWithProbability01.first && !statesWithProbability01.second && model.getReachableStates();
+    });
 
     STORM_LOG_INFO("Preprocessing: " << statesWithProbability01.first.getNonZeroCount() << " states with probability 1, "
                                      << statesWithProbability01.second.getNonZeroCount() << " with probability 0 (" << maybeStates.getNonZeroCount()
@@ -189,69 +195,72 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
                                 "Solver requirements " + clearedRequirements.getEnabledRequirementsAsString() + " not checked.");
             }
 
-            storm::dd::Bdd<DdType> extendedMaybeStates = maybeStates;
-            if (extendMaybeStates) {
-                // Extend the maybe states by all non-maybe states that can be reached from a maybe state within one step (they
-                // either are states with probability 0 or 1).
-                extendedMaybeStates |= maybeStates.relationalProduct(transitionMatrixBdd.existsAbstract(model.getNondeterminismVariables()),
-                                                                     model.getRowVariables(), model.getColumnVariables());
-            }
-
             storm::utility::Stopwatch conversionWatch;
+            storm::dd::Bdd<DdType> extendedMaybeStates;
+            storm::dd::Odd odd;
+            std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation;
+            model.getManager().execute([&]() {
+                extendedMaybeStates = maybeStates;
+                if (extendMaybeStates) {
+                    // Extend the maybe states by all non-maybe states that can be reached from a maybe state within one step (they
+                    // either are states with probability 0 or 1).
+                    extendedMaybeStates |= maybeStates.relationalProduct(transitionMatrixBdd.existsAbstract(model.getNondeterminismVariables()),
+                                                                         model.getRowVariables(), model.getColumnVariables());
+                }
 
-            // Create the ODD for the translation between symbolic and explicit storage.
-            conversionWatch.start();
-            storm::dd::Odd odd = extendedMaybeStates.createOdd();
-            conversionWatch.stop();
+                // Create the ODD for the translation between symbolic and explicit storage.
+                conversionWatch.start();
+                odd = extendedMaybeStates.createOdd();
+                conversionWatch.stop();
 
-            // Convert the maybe states BDD to an ADD.
-            storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
+                // Convert the maybe states BDD to an ADD.
+                storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
 
-            // Start by cutting away all rows that do not belong to maybe states. Note that this leaves columns targeting
-            // non-maybe states in the matrix.
-            storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * maybeStatesAdd;
+                // Start by cutting away all rows that do not belong to maybe states. Note that this leaves columns targeting
+                // non-maybe states in the matrix.
+                storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * maybeStatesAdd;
 
-            // If the maybe states were extended, we generate the explicit representation slightly differently.
-            std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation;
-            if (extendMaybeStates) {
-                // Eliminate all transitions to non-extended-maybe states.
-                submatrix *= extendedMaybeStates.template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs());
+                // If the maybe states were extended, we generate the explicit representation slightly differently.
+                if (extendMaybeStates) {
+                    // Eliminate all transitions to non-extended-maybe states.
+                    submatrix *= extendedMaybeStates.template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs());
 
-                // Only translate the matrix for now.
-                conversionWatch.start();
-                explicitRepresentation.first = submatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+                    // Only translate the matrix for now.
+                    conversionWatch.start();
+                    explicitRepresentation.first = submatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
 
-                // Get all original maybe states in the extended matrix.
-                solverRequirementsData.properMaybeStates = maybeStates.toVector(odd);
+                    // Get all original maybe states in the extended matrix.
+                    solverRequirementsData.properMaybeStates = maybeStates.toVector(odd);
 
-                // Compute the target states within the set of extended maybe states.
-                storm::storage::BitVector targetStates = (extendedMaybeStates && statesWithProbability01.second).toVector(odd);
-                conversionWatch.stop();
+                    // Compute the target states within the set of extended maybe states.
+                    storm::storage::BitVector targetStates = (extendedMaybeStates && statesWithProbability01.second).toVector(odd);
+                    conversionWatch.stop();
 
-                // Eliminate the end components and remove the states that are not interesting (target or non-filter).
-                eliminateEndComponentsAndExtendedStatesUntilProbabilities(explicitRepresentation, solverRequirementsData, targetStates);
+                    // Eliminate the end components and remove the states that are not interesting (target or non-filter).
+                    eliminateEndComponentsAndExtendedStatesUntilProbabilities(explicitRepresentation, solverRequirementsData, targetStates);
 
-            } else {
-                // Then compute the vector that contains the one-step probabilities to a state with probability 1 for all
-                // maybe states.
-                storm::dd::Add<DdType, ValueType> prob1StatesAsColumn = statesWithProbability01.second.template toAdd<ValueType>();
-                prob1StatesAsColumn = prob1StatesAsColumn.swapVariables(model.getRowColumnMetaVariablePairs());
-                storm::dd::Add<DdType, ValueType> subvector = submatrix * prob1StatesAsColumn;
-                subvector = subvector.sumAbstract(model.getColumnVariables());
+                } else {
+                    // Then compute the vector that contains the one-step probabilities to a state with probability 1 for all
+                    // maybe states.
+                    storm::dd::Add<DdType, ValueType> prob1StatesAsColumn = statesWithProbability01.second.template toAdd<ValueType>();
+                    prob1StatesAsColumn = prob1StatesAsColumn.swapVariables(model.getRowColumnMetaVariablePairs());
+                    storm::dd::Add<DdType, ValueType> subvector = submatrix * prob1StatesAsColumn;
+                    subvector = subvector.sumAbstract(model.getColumnVariables());
 
-                // Finally cut away all columns targeting non-maybe states.
-                submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                    // Finally cut away all columns targeting non-maybe states.
+                    submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
 
-                // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
-                conversionWatch.start();
-                explicitRepresentation = submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
-                conversionWatch.stop();
+                    // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
+                    conversionWatch.start();
+                    explicitRepresentation = submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
+                    conversionWatch.stop();
 
-                if (requirements.validInitialScheduler()) {
-                    solverRequirementsData.initialScheduler =
-                        computeValidInitialSchedulerForUntilProbabilities<ValueType>(explicitRepresentation.first, explicitRepresentation.second);
+                    if (requirements.validInitialScheduler()) {
+                        solverRequirementsData.initialScheduler =
+                            computeValidInitialSchedulerForUntilProbabilities<ValueType>(explicitRepresentation.first, explicitRepresentation.second);
+                    }
                 }
-            }
+            });
 
             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
@@ -270,6 +279,8 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
             }
             solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
             solver->setRequirementsChecked();
+            // The workers of the DD library are not needed by the sparse computation, so they are suspended in the meantime.
+            storm::dd::SuspensionScope<DdType> suspensionScope;
             solver->solveEquations(env, dir, x, explicitRepresentation.second);
 
             // If we included some target and non-filter states in the ODD, we need to expand the result from the solver.
@@ -584,20 +595,26 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeRea
     STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Missing reward model for formula. Skipping formula.");
 
     // Determine which states have a reward of infinity by definition.
+    // The DD-heavy parts are run as tasks of the DD library, only the sparse solver runs outside of them.
     storm::dd::Bdd<DdType> infinityStates;
-    storm::dd::Bdd<DdType> transitionMatrixBdd = transitionMatrix.notZero();
-    if (dir == OptimizationDirection::Minimize) {
-        infinityStates = storm::utility::graph::performProb1E(
-            model, transitionMatrixBdd, model.getReachableStates(), targetStates,
-            storm::utility::graph::performProbGreater0E(model, transitionMatrixBdd, model.getReachableStates(), targetStates));
-    } else {
-        infinityStates = storm::utility::graph::performProb1A(
-            model, transitionMatrixBdd, targetStates,
-            storm::utility::graph::performProbGreater0A(model, transitionMatrixBdd, model.getReachableStates(), targetStates));
-    }
-    infinityStates = !infinityStates && model.getReachableStates();
-    storm::dd::Bdd<DdType> maybeStatesWithTargetStates = !infinityStates && model.getReachableStates();
-    storm::dd::Bdd<DdType> maybeStates = !targetStates && maybeStatesWithTargetStates;
+    storm::dd::Bdd<DdType> transitionMatrixBdd;
+    storm::dd::Bdd<DdType> maybeStatesWithTargetStates;
+    storm::dd::Bdd<DdType> maybeStates;
+    model.getManager().execute([&]() {
+        transitionMatrixBdd = transitionMatrix.notZero();
+        if (dir == OptimizationDirection::Minimize) {
+            infinityStates = storm::utility::graph::performProb1E(
+                model, transitionMatrixBdd, model.getReachableStates(), targetStates,
+                storm::utility::graph::performProbGreater0E(model, transitionMatrixBdd, model.getReachableStates(), targetStates));
+        } else {
+            infinityStates = storm::utility::graph::performProb1A(
+                model, transitionMatrixBdd, targetStates,
+                storm::utility::graph::performProbGreater0A(model, transitionMatrixBdd, model.getReachableStates(), targetStates));
+        }
+        infinityStates = !infinityStates && model.getReachableStates();
+        maybeStatesWithTargetStates = !infinityStates && model.getReachableStates();
+        maybeStates = !targetStates && maybeStatesWithTargetStates;
+    });
 
     STORM_LOG_INFO("Preprocessing: " << infinityStates.getNonZeroCount() << " states with reward infinity, " << targetStates.getNonZeroCount()
                                      << " target states (" << maybeStates.getNonZeroCount() << " states remaining).");
@@ -649,45 +666,49 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeRea
             storm::dd::Bdd<DdType> requiredMaybeStates = extendMaybeStates ? maybeStatesWithTargetStates : maybeStates;
 
             storm::utility::Stopwatch conversionWatch;
+            storm::dd::Odd odd;
+            std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation;
+            model.getManager().execute([&]() {
+                // Create the ODD for the translation between symbolic and explicit storage.
+                conversionWatch.start();
+                odd = requiredMaybeStates.createOdd();
+                conversionWatch.stop();
+
+                // Create the matrix and the vector for the equation system.
+                storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
+
+                // Start by getting rid of
+                // (a) transitions from non-maybe states, and
+                // (b) the choices in the transition matrix that lead to a state that is neither a maybe state
+                // nor a target state ('infinity choices').
+                storm::dd::Add<DdType, ValueType> choiceFilterAdd =
+                    maybeStatesAdd * (transitionMatrixBdd && maybeStatesWithTargetStates.renameVariables(model.getRowVariables(), model.getColumnVariables()))
+                                         .existsAbstract(model.getColumnVariables())
+                                         .template toAdd<ValueType>();
+                storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * choiceFilterAdd;
+
+                // Then compute the reward vector to use in the computation.
+                storm::dd::Add<DdType, ValueType> subvector =
+                    rewardModel.getTotalRewardVector(maybeStatesAdd, choiceFilterAdd, submatrix, model.getColumnVariables());
+
+                conversionWatch.start();
+                std::vector<uint_fast64_t> rowGroupSizes = (submatrix.notZero().existsAbstract(model.getColumnVariables()) || subvector.notZero())
+                                                               .template toAdd<uint_fast64_t>()
+                                                               .sumAbstract(model.getNondeterminismVariables())
+                                                               .toVector(odd);
+                conversionWatch.stop();
+
+                // Finally cut away all columns targeting non-maybe states (or non-(maybe or target) states, respectively).
+                submatrix *= extendMaybeStates ? maybeStatesWithTargetStates.swapVariables(model.getRowColumnMetaVariablePairs()).template toAdd<ValueType>()
+                                               : maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+
+                // Translate the symbolic matrix/vector to their explicit representations.
+                conversionWatch.start();
+                explicitRepresentation = submatrix.toMatrixVector(std::move(rowGroupSizes), subvector, model.getRowVariables(), model.getColumnVariables(),
+                                                                  model.getNondeterminismVariables(), odd, odd);
+                conversionWatch.stop();
+            });
 
-            // Create the ODD for the translation between symbolic and explicit storage.
-            conversionWatch.start();
-            storm::dd::Odd odd = requiredMaybeStates.createOdd();
-            conversionWatch.stop();
-
-            // Create the matrix and the vector for the equation system.
-            storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
-
-            // Start by getting rid of
-            // (a) transitions from non-maybe states, and
-            // (b) the choices in the transition matrix that lead to a state that is neither a maybe state
-            // nor a target state ('infinity choices').
-            storm::dd::Add<DdType, ValueType> choiceFilterAdd =
-                maybeStatesAdd * (transitionMatrixBdd && maybeStatesWithTargetStates.renameVariables(model.getRowVariables(), model.getColumnVariables()))
-                                     .existsAbstract(model.getColumnVariables())
-                                     .template toAdd<ValueType>();
-            storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * choiceFilterAdd;
-
-            // Then compute the reward vector to use in the computation.
-            storm::dd::Add<DdType, ValueType> subvector =
-                rewardModel.getTotalRewardVector(maybeStatesAdd, choiceFilterAdd, submatrix, model.getColumnVariables());
-
-            conversionWatch.start();
-            std::vector<uint_fast64_t> rowGroupSizes = (submatrix.notZero().existsAbstract(model.getColumnVariables()) || subvector.notZero())
-                                                           .template toAdd<uint_fast64_t>()
-                                                           .sumAbstract(model.getNondeterminismVariables())
-                                                           .toVector(odd);
-            conversionWatch.stop();
-
-            // Finally cut away all columns targeting non-maybe states (or non-(maybe or target) states, respectively).
-            submatrix *= extendMaybeStates ? maybeStatesWithTargetStates.swapVariables(model.getRowColumnMetaVariablePairs()).template toAdd<ValueType>()
-                                           : maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-
-            // Translate the symbolic matrix/vector to their explicit representations.
-            conversionWatch.start();
-            std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = submatrix.toMatrixVector(
-                std::move(rowGroupSizes), subvector, model.getRowVariables(), model.getColumnVariables(), model.getNondeterminismVariables(), odd, odd);
-            conversionWatch.stop();
             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
             // Fulfill the solver's requirements.
@@ -750,6 +771,7 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeRea
 
             solver->setLowerBound(storm::utility::zero<ValueType>());
             solver->setRequirementsChecked();
+            storm::dd::SuspensionScope<DdType> suspensionScope;
             solver->solveEquations(env, dir, x, explicitRepresentation.second);
 
             // If we eliminated end components, we need to extend the solution vector.
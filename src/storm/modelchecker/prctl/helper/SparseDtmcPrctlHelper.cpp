@@ -19,6 +19,7 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -31,6 +32,8 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/parallelEnvironment.h"
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/macros.h"
@@ -56,7 +59,7 @@ std::map<storm::storage::sparse::state_type, storm::RationalFunction> SparseDtmc
 template<typename ValueType, typename RewardModelType>
 std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeRewardBoundedValues(
     Environment const& env, storm::models::sparse::Dtmc<ValueType> const& model, std::shared_ptr<storm::logic::OperatorFormula const> rewardBoundedFormula) {
-    storm::utility::Stopwatch swAll(true), swBuild, swCheck;
+    storm::utility::Stopwatch swAll(true), swEpochs, swCheck;
 
     storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, rewardBoundedFormula);
 
@@ -67,15 +70,21 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     // Initialize epoch models
     auto initEpoch = rewardUnfolding.getStartEpoch();
     auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+    if (env.modelchecker().isEpochMemoryLimitSet()) {
+        rewardUnfolding.setSolutionMemoryLimit(env.modelchecker().getEpochMemoryLimit() * 1024 * 1024);
+    }
 
-    // initialize data that will be needed for each epoch
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
+    // initialize data that will be needed for each epoch (separately for each thread)
+    uint64_t numberOfThreads = storm::utility::parallel::resolveNumberOfThreads(env.modelchecker().getEpochThreads(), epochOrder.size());
+    std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numberOfThreads);
+    std::vector<storm::utility::Stopwatch> swChecks(numberOfThreads);
 
     Environment preciseEnv = env;
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
         initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
     preciseEnv.solver().setLinearEquationSolverPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
+    std::vector<Environment> threadEnvs = storm::utility::parallel::createThreadEnvironments(preciseEnv, numberOfThreads);
 
     // In case of cdf export we store the necessary data.
     std::vector<std::vector<ValueType>> cdfData;
@@ -88,13 +97,14 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
+    auto analyzeEpochModel = [&](uint64_t threadIndex, auto const&, auto& epochModel) {
+        swChecks[threadIndex].start();
+        auto solution =
+            epochModel.analyzeSingleObjective(threadEnvs[threadIndex], x[threadIndex], b[threadIndex], linEqSolvers[threadIndex], lowerBound, upperBound);
+        swChecks[threadIndex].stop();
+        return solution;
+    };
+    auto epochAnalyzed = [&](auto const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -108,9 +118,13 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         }
         ++numCheckedEpochs;
         progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
-        }
+        return !storm::utility::resources::isTerminate();
+    };
+    swEpochs.start();
+    rewardUnfolding.analyzeEpochs(epochOrder, numberOfThreads, analyzeEpochModel, epochAnalyzed);
+    swEpochs.stop();
+    for (auto const& threadSwCheck : swChecks) {
+        swCheck.add(threadSwCheck);
     }
 
     std::map<storm::storage::sparse::state_type, ValueType> result;
@@ -136,8 +150,8 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         STORM_PRINT_AND_LOG("---------------------------------\n");
         STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << ".\n");
         STORM_PRINT_AND_LOG("             overall Time: " << swAll << ".\n");
-        STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << ".\n");
-        STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << ".\n");
+        STORM_PRINT_AND_LOG("         Epoch model Time: " << swEpochs << ".\n");
+        STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << " (summed over " << numberOfThreads << " threads).\n");
         STORM_PRINT_AND_LOG("---------------------------------\n");
     }
 
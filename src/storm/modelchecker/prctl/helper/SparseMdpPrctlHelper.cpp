@@ -37,9 +37,12 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/parallelEnvironment.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -61,7 +64,7 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
     if constexpr (std::is_same_v<ValueType, storm::Interval>) {
         STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We do not support computing reward bounded values with interval models.");
     } else {
-        storm::utility::Stopwatch swAll(true), swBuild, swCheck;
+        storm::utility::Stopwatch swAll(true), swEpochs, swCheck;
 
         // Get lower and upper bounds for the solution.
         auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
@@ -70,15 +73,21 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         // Initialize epoch models
         auto initEpoch = rewardUnfolding.getStartEpoch();
         auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+        if (env.modelchecker().isEpochMemoryLimitSet()) {
+            rewardUnfolding.setSolutionMemoryLimit(env.modelchecker().getEpochMemoryLimit() * 1024 * 1024);
+        }
 
-        // initialize data that will be needed for each epoch
-        std::vector<ValueType> x, b;
-        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;
+        // initialize data that will be needed for each epoch (separately for each thread)
+        uint64_t numberOfThreads = storm::utility::parallel::resolveNumberOfThreads(env.modelchecker().getEpochThreads(), epochOrder.size());
+        std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers(numberOfThreads);
+        std::vector<storm::utility::Stopwatch> swChecks(numberOfThreads);
 
         ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
             initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
         Environment preciseEnv = env;
         preciseEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
+        std::vector<Environment> threadEnvs = storm::utility::parallel::createThreadEnvironments(preciseEnv, numberOfThreads);
 
         // In case of cdf export we store the necessary data.
         std::vector<std::vector<ValueType>> cdfData;
@@ -87,13 +96,14 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         progress.setMaxCount(epochOrder.size());
         progress.startNewMeasurement(0);
         uint64_t numCheckedEpochs = 0;
-        for (auto const& epoch : epochOrder) {
-            swBuild.start();
-            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-            swBuild.stop();
-            swCheck.start();
-            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-            swCheck.stop();
+        auto analyzeEpochModel = [&](uint64_t threadIndex, auto const&, auto& epochModel) {
+            swChecks[threadIndex].start();
+            auto solution = epochModel.analyzeSingleObjective(threadEnvs[threadIndex], dir, x[threadIndex], b[threadIndex], minMaxSolvers[threadIndex],
+                                                              lowerBound, upperBound);
+            swChecks[threadIndex].stop();
+            return solution;
+        };
+        auto epochAnalyzed = [&](auto const& epoch) {
             if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
                 !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                 std::vector<ValueType> cdfEntry;
@@ -107,9 +117,13 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
             }
             ++numCheckedEpochs;
             progress.updateProgress(numCheckedEpochs);
-            if (storm::utility::resources::isTerminate()) {
-                break;
-            }
+            return !storm::utility::resources::isTerminate();
+        };
+        swEpochs.start();
+        rewardUnfolding.analyzeEpochs(epochOrder, numberOfThreads, analyzeEpochModel, epochAnalyzed);
+        swEpochs.stop();
+        for (auto const& threadSwCheck : swChecks) {
+            swCheck.add(threadSwCheck);
         }
 
         std::map<storm::storage::sparse::state_type, ValueType> result;
@@ -135,8 +149,8 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
             STORM_PRINT_AND_LOG("---------------------------------\n");
             STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << ".\n");
             STORM_PRINT_AND_LOG("             overall Time: " << swAll << ".\n");
-            STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << ".\n");
-            STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << ".\n");
+            STORM_PRINT_AND_LOG("         Epoch model Time: " << swEpochs << ".\n");
+            STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << " (summed over " << numberOfThreads << " threads).\n");
             STORM_PRINT_AND_LOG("---------------------------------\n");
         }
 
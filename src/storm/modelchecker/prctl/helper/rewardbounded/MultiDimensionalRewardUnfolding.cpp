@@ -1,11 +1,17 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <functional>
+#include <limits>
+#include <map>
 #include <set>
 #include <string>
+#include <type_traits>
 
 #include "storm/logic/Formulas.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -18,6 +24,7 @@
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -28,6 +35,63 @@ namespace modelchecker {
 namespace helper {
 namespace rewardbounded {
 
+namespace {
+template<typename T>
+void writeToSpillFile(std::FILE* file, T const& value) {
+    if constexpr (std::is_same<T, storm::RationalNumber>::value) {
+        std::string valueAsString = storm::utility::to_string(value);
+        writeToSpillFile<uint64_t>(file, valueAsString.size());
+        STORM_LOG_THROW(std::fwrite(valueAsString.data(), 1, valueAsString.size(), file) == valueAsString.size(), storm::exceptions::FileIoException,
+                        "Unable to write to the spill file for epoch solutions.");
+    } else {
+        STORM_LOG_THROW(std::fwrite(&value, sizeof(T), 1, file) == 1, storm::exceptions::FileIoException,
+                        "Unable to write to the spill file for epoch solutions.");
+    }
+}
+
+template<typename T>
+T readFromSpillFile(std::FILE* file) {
+    if constexpr (std::is_same<T, storm::RationalNumber>::value) {
+        std::string valueAsString(readFromSpillFile<uint64_t>(file), ' ');
+        STORM_LOG_THROW(std::fread(&valueAsString[0], 1, valueAsString.size(), file) == valueAsString.size(), storm::exceptions::FileIoException,
+                        "Unable to read from the spill file for epoch solutions.");
+        return storm::utility::convertNumber<T>(valueAsString);
+    } else {
+        T value;
+        STORM_LOG_THROW(std::fread(&value, sizeof(T), 1, file) == 1, storm::exceptions::FileIoException,
+                        "Unable to read from the spill file for epoch solutions.");
+        return value;
+    }
+}
+
+/*!
+ * Writes the given values as a sequence of runs of equal values. Epoch solutions typically contain many repeated values (e.g. zeros and ones).
+ */
+template<typename T>
+void writeRunsToSpillFile(std::FILE* file, std::vector<T> const& values) {
+    writeToSpillFile<uint64_t>(file, values.size());
+    auto runBegin = values.begin();
+    while (runBegin != values.end()) {
+        auto runEnd = std::find_if(runBegin, values.end(), [&runBegin](T const& value) { return value != *runBegin; });
+        writeToSpillFile<uint64_t>(file, std::distance(runBegin, runEnd));
+        writeToSpillFile(file, *runBegin);
+        runBegin = runEnd;
+    }
+}
+
+template<typename T>
+std::vector<T> readRunsFromSpillFile(std::FILE* file) {
+    uint64_t numberOfValues = readFromSpillFile<uint64_t>(file);
+    std::vector<T> values;
+    values.reserve(numberOfValues);
+    while (values.size() < numberOfValues) {
+        uint64_t runLength = readFromSpillFile<uint64_t>(file);
+        values.insert(values.end(), runLength, readFromSpillFile<T>(file));
+    }
+    return values;
+}
+}  // namespace
+
 template<typename ValueType, bool SingleObjectiveMode>
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::MultiDimensionalRewardUnfolding(
     storm::models::sparse::Model<ValueType> const& model, std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> const& objectives)
@@ -417,7 +481,115 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
     } else {
         epochModel.epochMatrixChanged = false;
     }
+    restoreSuccessorSolutions({epoch});
+    setStepSolutions(epoch, epochModel);
+    currentEpoch = epoch;
+    return epochModel;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(std::vector<Epoch> const& epochs, uint64_t numberOfThreads,
+                                                                                    EpochModelAnalyzer const& analyzeEpochModel,
+                                                                                    std::function<bool(Epoch const&)> const& epochAnalyzed) {
+    STORM_LOG_ASSERT(numberOfThreads > 0, "Invalid number of threads.");
+
+    // Group the epochs into batches that are analyzed one after another. The epochs of a batch belong to the same epoch class and do not depend on each
+    // other. For multiple threads, we partition the epochs of each class into layers such that an epoch only depends on epochs of previous layers
+    // (or of previous epoch classes).
+    std::vector<std::vector<Epoch>> batches;
+    if (numberOfThreads == 1) {
+        batches.reserve(epochs.size());
+        for (auto const& epoch : epochs) {
+            batches.push_back({epoch});
+        }
+    } else {
+        auto classBegin = epochs.begin();
+        while (classBegin != epochs.end()) {
+            auto classEnd = std::find_if(classBegin, epochs.end(), [&](Epoch const& epoch) { return !epochManager.compareEpochClass(epoch, *classBegin); });
+            std::map<Epoch, uint64_t> epochToLayerMap;
+            uint64_t firstLayer = batches.size();
+            for (auto epochIt = classBegin; epochIt != classEnd; ++epochIt) {
+                uint64_t layer = firstLayer;
+                for (auto const& step : possibleEpochSteps) {
+                    auto successorLayerIt = epochToLayerMap.find(epochManager.getSuccessorEpoch(*epochIt, step));
+                    if (successorLayerIt != epochToLayerMap.end()) {
+                        layer = std::max(layer, successorLayerIt->second + 1);
+                    }
+                }
+                epochToLayerMap.emplace(*epochIt, layer);
+                if (layer == batches.size()) {
+                    batches.emplace_back();
+                }
+                batches[layer].push_back(*epochIt);
+            }
+            classBegin = classEnd;
+        }
+    }
 
+    // Track when the solution of each epoch is needed for the last time
+    pendingUses.clear();
+    for (uint64_t batchIndex = 0; batchIndex < batches.size(); ++batchIndex) {
+        for (auto const& epoch : batches[batchIndex]) {
+            std::set<Epoch> successorEpochs;
+            for (auto const& step : possibleEpochSteps) {
+                successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
+            }
+            successorEpochs.erase(epoch);
+            for (auto const& successorEpoch : successorEpochs) {
+                pendingUses[successorEpoch].push_back(batchIndex);
+            }
+        }
+    }
+    for (auto& uses : pendingUses) {
+        std::reverse(uses.second.begin(), uses.second.end());
+    }
+
+    std::vector<EpochModel<ValueType, SingleObjectiveMode>> threadEpochModels;
+    for (uint64_t batchIndex = 0; batchIndex < batches.size(); ++batchIndex) {
+        auto const& batch = batches[batchIndex];
+        if (numberOfThreads == 1) {
+            setSolutionForCurrentEpoch(analyzeEpochModel(0, batch.front(), setCurrentEpoch(batch.front())));
+            if (!epochAnalyzed(batch.front())) {
+                break;
+            }
+            continue;
+        }
+
+        if (batchIndex == 0 || !epochManager.compareEpochClass(batch.front(), batches[batchIndex - 1].front())) {
+            // The epoch model of the class is built once. Each thread then only needs to update the step solutions of its copy.
+            setCurrentEpochClass(batch.front());
+            currentEpoch = boost::none;
+            epochModel.epochMatrixChanged = true;
+            threadEpochModels.clear();
+        }
+        uint64_t numberOfBatchThreads = std::min<uint64_t>(numberOfThreads, batch.size());
+        while (threadEpochModels.size() < numberOfBatchThreads) {
+            threadEpochModels.push_back(epochModel);
+        }
+        restoreSuccessorSolutions(batch);
+        std::vector<std::vector<SolutionType>> batchSolutions(batch.size());
+        storm::utility::parallel::forEachTask(batch.size(), numberOfBatchThreads, [&](uint64_t threadIndex, uint64_t epochIndex) {
+            auto& threadEpochModel = threadEpochModels[threadIndex];
+            setStepSolutions(batch[epochIndex], threadEpochModel);
+            batchSolutions[epochIndex] = analyzeEpochModel(threadIndex, batch[epochIndex], threadEpochModel);
+            threadEpochModel.epochMatrixChanged = false;
+        });
+        // Storing the solutions might erase solutions of successor epochs, so this is only done after the whole batch has been analyzed.
+        bool stop = false;
+        for (uint64_t epochIndex = 0; epochIndex < batch.size() && !stop; ++epochIndex) {
+            setSolutionForEpoch(batch[epochIndex], std::move(batchSolutions[epochIndex]));
+            stop = !epochAnalyzed(batch[epochIndex]);
+        }
+        if (stop) {
+            break;
+        }
+    }
+    pendingUses.clear();
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setStepSolutions(Epoch const& epoch,
+                                                                                       EpochModel<ValueType, SingleObjectiveMode>& epochModel) const {
     bool containsLowerBoundedObjective = false;
     for (auto const& dimension : dimensions) {
         if (dimension.boundType == DimensionBoundType::LowerBound) {
@@ -498,8 +670,6 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
     assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
     assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
     assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
-
-    currentEpoch = epoch;
     /*
     std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
     std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
@@ -511,7 +681,6 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
     }
     std::cout << '\n';
     */
-    return epochModel;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -864,32 +1033,193 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
     STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    setSolutionForEpoch(currentEpoch.get(), std::move(inStateSolutions));
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions) {
     STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
 
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
 
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
+        auto pendingUsesIt = pendingUses.find(successorEpoch);
+        if (pendingUsesIt != pendingUses.end() && !pendingUsesIt->second.empty()) {
+            pendingUsesIt->second.pop_back();
+        }
         auto successorEpochSolutionIt = epochSolutions.find(successorEpoch);
         STORM_LOG_ASSERT(successorEpochSolutionIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
         --successorEpochSolutionIt->second.count;
         if (successorEpochSolutionIt->second.count == 0) {
+            if (!successorEpochSolutionIt->second.spillFilePosition) {
+                solutionMemory -= getSolutionMemory(successorEpochSolutionIt->second.solutions);
+            }
             epochSolutions.erase(successorEpochSolutionIt);
         }
     }
 
     // add the new solution
     EpochSolution solution;
-    solution.count = predecessorEpochs.size();
+    if (retainSolutions || pendingUses.empty()) {
+        solution.count = predecessorEpochs.size();
+    } else {
+        // Only the epochs that are currently analyzed need this solution.
+        auto pendingUsesIt = pendingUses.find(epoch);
+        solution.count = pendingUsesIt == pendingUses.end() ? 0 : pendingUsesIt->second.size();
+    }
     solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    solutionMemory += getSolutionMemory(solution.solutions);
+    auto epochSolutionIt = epochSolutions.find(epoch);
+    if (epochSolutionIt == epochSolutions.end()) {
+        epochSolutions.emplace(epoch, std::move(solution));
+    } else {
+        if (!epochSolutionIt->second.spillFilePosition) {
+            solutionMemory -= getSolutionMemory(epochSolutionIt->second.solutions);
+        }
+        epochSolutionIt->second = std::move(solution);
+    }
+    if (solutionMemoryLimit && solutionMemory > solutionMemoryLimit.get()) {
+        spillSolutions();
+    }
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setRetainSolutions(bool value) {
+    retainSolutions = value;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionMemoryLimit(uint64_t bytes) {
+    solutionMemoryLimit = bytes;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getNumberOfSpilledSolutions() const {
+    return numberOfSpilledSolutions;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getSolutionMemory(std::vector<SolutionType> const& solutions) const {
+    if constexpr (SingleObjectiveMode) {
+        return solutions.size() * sizeof(SolutionType);
+    } else {
+        uint64_t result = solutions.size() * sizeof(SolutionType);
+        for (auto const& solution : solutions) {
+            result += solution.size() * sizeof(ValueType);
+        }
+        return result;
+    }
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::spillSolutions(std::set<Epoch> const& requiredEpochs) {
+    // Spill the solutions whose next use lies furthest in the future until only half of the available memory is occupied.
+    // Solutions that are not needed by the currently analyzed epochs are spilled first. The required solutions are never spilled.
+    std::vector<std::pair<uint64_t, EpochSolution*>> candidates;
+    for (auto& epochSolution : epochSolutions) {
+        if (!epochSolution.second.spillFilePosition && requiredEpochs.count(epochSolution.first) == 0) {
+            auto pendingUsesIt = pendingUses.find(epochSolution.first);
+            bool hasPendingUse = pendingUsesIt != pendingUses.end() && !pendingUsesIt->second.empty();
+            candidates.emplace_back(hasPendingUse ? pendingUsesIt->second.back() : std::numeric_limits<uint64_t>::max(), &epochSolution.second);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first; });
+    uint64_t numberOfNewlySpilledSolutions = 0;
+    for (auto const& candidate : candidates) {
+        if (solutionMemory <= solutionMemoryLimit.get() / 2) {
+            break;
+        }
+        spillSolution(*candidate.second);
+        ++numberOfNewlySpilledSolutions;
+    }
+    numberOfSpilledSolutions += numberOfNewlySpilledSolutions;
+    STORM_LOG_INFO("Moved " << numberOfNewlySpilledSolutions << " epoch solutions to the spill file.");
+    STORM_LOG_INFO_COND(solutionMemory <= solutionMemoryLimit.get(),
+                        "The solutions required for the current epochs occupy " << solutionMemory << " bytes, which exceeds the memory limit.");
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::spillSolution(EpochSolution& epochSolution) {
+    if (!spillFile) {
+        spillFile = std::shared_ptr<std::FILE>(std::tmpfile(), [](std::FILE* file) {
+            if (file) {
+                std::fclose(file);
+            }
+        });
+        STORM_LOG_THROW(spillFile, storm::exceptions::FileIoException, "Unable to create a spill file for epoch solutions.");
+    }
+    // Spilled solutions are always appended. The space of solutions that are released later on is not reused.
+    STORM_LOG_THROW(std::fseek(spillFile.get(), 0, SEEK_END) == 0, storm::exceptions::FileIoException, "Unable to access the spill file for epoch solutions.");
+    epochSolution.spillFilePosition = std::ftell(spillFile.get());
+    if constexpr (SingleObjectiveMode) {
+        writeRunsToSpillFile(spillFile.get(), epochSolution.solutions);
+    } else {
+        std::vector<uint64_t> solutionSizes;
+        std::vector<ValueType> values;
+        solutionSizes.reserve(epochSolution.solutions.size());
+        for (auto const& solution : epochSolution.solutions) {
+            solutionSizes.push_back(solution.size());
+            values.insert(values.end(), solution.begin(), solution.end());
+        }
+        writeRunsToSpillFile(spillFile.get(), solutionSizes);
+        writeRunsToSpillFile(spillFile.get(), values);
+    }
+    solutionMemory -= getSolutionMemory(epochSolution.solutions);
+    epochSolution.solutions = std::vector<SolutionType>();
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::restoreSolution(EpochSolution& epochSolution) {
+    STORM_LOG_ASSERT(epochSolution.spillFilePosition, "Tried to restore a solution that has not been spilled.");
+    STORM_LOG_THROW(std::fseek(spillFile.get(), epochSolution.spillFilePosition.get(), SEEK_SET) == 0, storm::exceptions::FileIoException,
+                    "Unable to access the spill file for epoch solutions.");
+    if constexpr (SingleObjectiveMode) {
+        epochSolution.solutions = readRunsFromSpillFile<ValueType>(spillFile.get());
+    } else {
+        std::vector<uint64_t> solutionSizes = readRunsFromSpillFile<uint64_t>(spillFile.get());
+        std::vector<ValueType> values = readRunsFromSpillFile<ValueType>(spillFile.get());
+        epochSolution.solutions.reserve(solutionSizes.size());
+        auto valueIt = values.begin();
+        for (auto const& solutionSize : solutionSizes) {
+            epochSolution.solutions.emplace_back(std::make_move_iterator(valueIt), std::make_move_iterator(valueIt + solutionSize));
+            valueIt += solutionSize;
+        }
+    }
+    epochSolution.spillFilePosition = boost::none;
+    solutionMemory += getSolutionMemory(epochSolution.solutions);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::restoreSuccessorSolutions(std::vector<Epoch> const& epochs) {
+    std::set<Epoch> requiredEpochs;
+    bool restored = false;
+    for (auto const& epoch : epochs) {
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+            if (successorEpoch != epoch) {
+                auto successorSolIt = epochSolutions.find(successorEpoch);
+                if (successorSolIt != epochSolutions.end()) {
+                    requiredEpochs.insert(successorEpoch);
+                    if (successorSolIt->second.spillFilePosition) {
+                        restoreSolution(successorSolIt->second);
+                        restored = true;
+                    }
+                }
+            }
+        }
+    }
+    // Restoring solutions may exceed the memory limit again, so make room by spilling solutions that are not required right now.
+    if (restored && solutionMemoryLimit && solutionMemory > solutionMemoryLimit.get()) {
+        spillSolutions(requiredEpochs);
+    }
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -897,12 +1227,19 @@ typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Soluti
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
     auto epochSolutionIt = epochSolutions.find(epoch);
     STORM_LOG_ASSERT(epochSolutionIt != epochSolutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
+    if (epochSolutionIt->second.spillFilePosition) {
+        restoreSolution(epochSolutionIt->second);
+        if (solutionMemoryLimit && solutionMemory > solutionMemoryLimit.get()) {
+            spillSolutions({epoch});
+        }
+    }
     return getStateSolution(epochSolutionIt->second, productState);
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions,
+                                                                                  Epoch const& epoch) const {
     auto epochSolutionIt = solutions.find(epoch);
     STORM_LOG_ASSERT(epochSolutionIt != solutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
     return *epochSolutionIt->second;
@@ -910,7 +1247,8 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution,
+                                                                                  uint64_t const& productState) const {
     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution at an unexisting product state.");
     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(),
                      "Requested solution for epoch at product state " << productState << " for which no solution was stored.");
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <set>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/Dimension.h"
@@ -27,6 +31,7 @@ class MultiDimensionalRewardUnfolding {
     typedef typename EpochManager::EpochClass EpochClass;
 
     typedef typename std::conditional<SingleObjectiveMode, ValueType, std::vector<ValueType>>::type SolutionType;
+    typedef std::function<std::vector<SolutionType>(uint64_t, Epoch const&, EpochModel<ValueType, SingleObjectiveMode>&)> EpochModelAnalyzer;
 
     /*
      *
@@ -64,6 +69,36 @@ class MultiDimensionalRewardUnfolding {
 
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
+    /*!
+     * Analyzes the given epochs and stores their solutions. The epochs need to be given in a valid computation order (e.g. as computed by
+     * getEpochComputationOrder). Epochs of the same epoch class that do not depend on each other are analyzed concurrently, where each thread works on its
+     * own copy of the epoch model.
+     * @param numberOfThreads The number of threads (has to be positive). For a single thread, the epochs are analyzed one after another in the given order.
+     * @param analyzeEpochModel Computes the solutions for the in-states of the given epoch model. It receives the index of the executing thread, which allows
+     * to maintain solver data for each thread.
+     * @param epochAnalyzed Invoked (by the calling thread) after the solution of an epoch has been stored. Returning false stops the analysis.
+     */
+    void analyzeEpochs(std::vector<Epoch> const& epochs, uint64_t numberOfThreads, EpochModelAnalyzer const& analyzeEpochModel,
+                       std::function<bool(Epoch const&)> const& epochAnalyzed);
+
+    /*!
+     * If set, the solution of an epoch is kept until all epochs that might depend on it have been analyzed. This allows to analyze further epochs later
+     * on (see getEpochComputationOrder with stopAtComputedEpochs). Otherwise, the solution is released as soon as the last epoch passed to analyzeEpochs
+     * that depends on it has been analyzed. The solutions of epochs without such dependent epochs are always kept.
+     */
+    void setRetainSolutions(bool value);
+
+    /*!
+     * Limits the (approximate) number of bytes occupied by the stored epoch solutions. Whenever the limit is exceeded, the solutions whose next use lies
+     * furthest in the future are moved to a temporary file in a run-length encoded form. They are restored once they are needed again.
+     */
+    void setSolutionMemoryLimit(uint64_t bytes);
+
+    /*!
+     * Returns how often a solution has been moved to the temporary file due to the memory limit.
+     */
+    uint64_t getNumberOfSpilledSolutions() const;
+
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
 
     /*!
@@ -86,6 +121,9 @@ class MultiDimensionalRewardUnfolding {
 
    private:
     void setCurrentEpochClass(Epoch const& epoch);
+    void setStepSolutions(Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& epochModel) const;
+    void setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions);
+    void restoreSuccessorSolutions(std::vector<Epoch> const& epochs);
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -116,13 +154,27 @@ class MultiDimensionalRewardUnfolding {
 
     SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState);
     struct EpochSolution {
-        uint64_t count;
+        uint64_t count;  // The number of epochs that still need this solution
         std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
         std::vector<SolutionType> solutions;
+        boost::optional<long> spillFilePosition;  // Set iff the solutions are currently stored in the spill file
     };
     std::map<Epoch, EpochSolution> epochSolutions;
-    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
-    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
+    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const;
+    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const;
+
+    uint64_t getSolutionMemory(std::vector<SolutionType> const& solutions) const;
+    void spillSolutions(std::set<Epoch> const& requiredEpochs = {});
+    void spillSolution(EpochSolution& epochSolution);
+    void restoreSolution(EpochSolution& epochSolution);
+
+    bool retainSolutions = false;
+    boost::optional<uint64_t> solutionMemoryLimit;
+    uint64_t solutionMemory = 0;  // The (approximate) number of bytes occupied by the solutions that are currently in memory
+    uint64_t numberOfSpilledSolutions = 0;
+    std::shared_ptr<std::FILE> spillFile;
+    // For each epoch, the (descending) indices of the batches analyzed by analyzeEpochs that need the solution of the epoch
+    std::map<Epoch, std::vector<uint64_t>> pendingUses;
 
     storm::models::sparse::Model<ValueType> const& model;
     std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
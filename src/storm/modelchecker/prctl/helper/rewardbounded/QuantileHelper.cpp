@@ -1,10 +1,12 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/QuantileHelper.h"
 
 #include <boost/optional.hpp>
+#include <limits>
 #include <memory>
 #include <set>
 #include <vector>
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
@@ -16,6 +18,8 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/parallelEnvironment.h"
 #include "storm/utility/vector.h"
 
 #include "storm/logic/BoundedUntilFormula.h"
@@ -395,9 +399,28 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                                                 CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding) {
     auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
     auto upperBound = rewardUnfolding.getUpperObjectiveBound();
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;  // Needed for MDP
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;         // Needed for DTMC
+
+    // Epochs analyzed later on build upon the solutions of earlier epochs
+    rewardUnfolding.setRetainSolutions(true);
+    if (env.modelchecker().isEpochMemoryLimitSet()) {
+        rewardUnfolding.setSolutionMemoryLimit(env.modelchecker().getEpochMemoryLimit() * 1024 * 1024);
+    }
+
+    // Solver data is maintained separately for each thread that analyzes epochs
+    uint64_t numberOfThreads = storm::utility::parallel::resolveNumberOfThreads(env.modelchecker().getEpochThreads(), std::numeric_limits<uint64_t>::max());
+    std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers(numberOfThreads);  // Needed for MDP
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numberOfThreads);         // Needed for DTMC
+    std::vector<Environment> threadEnvs = storm::utility::parallel::createThreadEnvironments(env, numberOfThreads);
+    auto analyzeEpochModel = [&](uint64_t threadIndex, EpochManager::Epoch const&, EpochModel<ValueType, true>& epochModel) {
+        if (model.isNondeterministicModel()) {
+            return epochModel.analyzeSingleObjective(threadEnvs[threadIndex], boundedUntilOperator.getOptimalityType(), x[threadIndex], b[threadIndex],
+                                                     minMaxSolvers[threadIndex], lowerBound, upperBound);
+        } else {
+            return epochModel.analyzeSingleObjective(threadEnvs[threadIndex], x[threadIndex], b[threadIndex], linEqSolvers[threadIndex], lowerBound,
+                                                     upperBound);
+        }
+    };
     if (!model.isNondeterministicModel()) {
         rewardUnfolding.setEquationSystemFormatForEpochModel(storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getEquationProblemFormat(env));
     }
@@ -432,18 +455,9 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                 }
                 STORM_LOG_DEBUG("Checking start epoch " << rewardUnfolding.getEpochManager().toString(startEpoch) << ".");
                 auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpoch, true);
-                for (auto const& epoch : epochSequence) {
+                bool insufficientPrecision = false;
+                auto epochAnalyzed = [&](EpochManager::Epoch const& epoch) {
                     ++numCheckedEpochs;
-                    swEpochAnalysis.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    if (model.isNondeterministicModel()) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(
-                            epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
-                    }
-                    swEpochAnalysis.stop();
-
                     CostLimits epochAsCostLimits;
                     if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
                                                    epochAsCostLimits)) {
@@ -456,7 +470,7 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                             propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
                             if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
                                 // unclear result due to insufficient precision.
-                                swExploration.stop();
+                                insufficientPrecision = true;
                                 return false;
                             }
                         } else {
@@ -468,6 +482,14 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                             unsatCostLimits.insert(epochAsCostLimits);
                         }
                     }
+                    return true;
+                };
+                swEpochAnalysis.start();
+                rewardUnfolding.analyzeEpochs(epochSequence, numberOfThreads, analyzeEpochModel, epochAnalyzed);
+                swEpochAnalysis.stop();
+                if (insufficientPrecision) {
+                    swExploration.stop();
+                    return false;
                 }
             }
         } while (getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate));
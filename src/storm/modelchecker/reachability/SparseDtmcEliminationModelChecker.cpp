@@ -868,8 +868,11 @@ template<typename SparseDtmcModelType>
 void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedStateElimination(
     std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
     storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates,
-    bool computeResultsForInitialStatesOnly) {
+    bool computeResultsForInitialStatesOnly, std::shared_ptr<EliminationOperationCache<ValueType>> const& operationCache) {
     storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
+    if (operationCache) {
+        stateEliminator.setOperationCache(operationCache);
+    }
 
     while (priorityQueue->hasNext()) {
         storm::storage::sparse::state_type state = priorityQueue->pop();
@@ -888,13 +891,15 @@ template<typename SparseDtmcModelType>
 void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performOrdinaryStateElimination(
     storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
     storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly,
-    std::vector<ValueType>& values, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+    std::vector<ValueType>& values, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities,
+    std::shared_ptr<EliminationOperationCache<ValueType>> const& operationCache) {
     std::shared_ptr<StatePriorityQueue> statePriorities =
         createStatePriorityQueue(distanceBasedPriorities, transitionMatrix, backwardTransitions, values, subsystem);
 
     std::size_t numberOfStatesToEliminate = statePriorities->size();
     STORM_LOG_DEBUG("Eliminating " << numberOfStatesToEliminate << " states using the state elimination technique.\n");
-    performPrioritizedStateElimination(statePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+    performPrioritizedStateElimination(statePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly,
+                                       operationCache);
     STORM_LOG_DEBUG("Eliminated " << numberOfStatesToEliminate << " states.\n");
 }
 
@@ -903,20 +908,21 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performHyb
     storm::storage::SparseMatrix<ValueType> const& forwardTransitions, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
     storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, storm::storage::BitVector const& subsystem,
     storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly, std::vector<ValueType>& values,
-    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities, std::shared_ptr<EliminationOperationCache<ValueType>> const& operationCache) {
     // When using the hybrid technique, we recursively treat the SCCs up to some size.
     std::vector<storm::storage::sparse::state_type> entryStateQueue;
     STORM_LOG_DEBUG("Eliminating " << subsystem.size() << " states using the hybrid elimination technique.\n");
     uint_fast64_t maximalDepth = treatScc(transitionMatrix, values, initialStates, subsystem, initialStates, forwardTransitions, backwardTransitions, false, 0,
                                           storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize(), entryStateQueue,
-                                          computeResultsForInitialStatesOnly, distanceBasedPriorities);
+                                          computeResultsForInitialStatesOnly, distanceBasedPriorities, operationCache);
 
     // If the entry states were to be eliminated last, we need to do so now.
     if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet()) {
         STORM_LOG_DEBUG("Eliminating " << entryStateQueue.size() << " entry states as a last step.");
         std::vector<storm::storage::sparse::state_type> sortedStates(entryStateQueue.begin(), entryStateQueue.end());
         std::shared_ptr<StatePriorityQueue> queuePriorities = std::make_shared<StaticStatePriorityQueue>(sortedStates);
-        performPrioritizedStateElimination(queuePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+        performPrioritizedStateElimination(queuePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly,
+                                           operationCache);
     }
     STORM_LOG_DEBUG("Eliminated " << subsystem.size() << " states.\n");
     return maximalDepth;
@@ -945,16 +951,22 @@ SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeReachabilityValue
     // Create a bit vector that represents the subsystem of states we still have to eliminate.
     storm::storage::BitVector subsystem = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
 
+    // All eliminations share the memoized results of sums and products (which are only stored for parametric models).
+    auto operationCache = std::make_shared<EliminationOperationCache<ValueType>>(
+        storm::settings::getModule<storm::settings::modules::EliminationSettings>().getOperationCacheSize());
+
     if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationMethod() ==
         storm::settings::modules::EliminationSettings::EliminationMethod::State) {
         performOrdinaryStateElimination(flexibleMatrix, flexibleBackwardTransitions, subsystem, initialStates, computeResultsForInitialStatesOnly, values,
-                                        distanceBasedPriorities);
+                                        distanceBasedPriorities, operationCache);
     } else if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationMethod() ==
                storm::settings::modules::EliminationSettings::EliminationMethod::Hybrid) {
         uint64_t maximalDepth = performHybridStateElimination(transitionMatrix, flexibleMatrix, flexibleBackwardTransitions, subsystem, initialStates,
-                                                              computeResultsForInitialStatesOnly, values, distanceBasedPriorities);
+                                                              computeResultsForInitialStatesOnly, values, distanceBasedPriorities, operationCache);
         STORM_LOG_TRACE("Maximal depth of decomposition was " << maximalDepth << ".");
     }
+    STORM_LOG_DEBUG("Memoized elimination operations: " << operationCache->getNumberOfHits() << " hits, " << operationCache->getNumberOfMisses()
+                                                        << " misses.");
 
     STORM_LOG_ASSERT(flexibleMatrix.empty(), "Not all transitions were eliminated.");
     STORM_LOG_ASSERT(flexibleBackwardTransitions.empty(), "Not all transitions were eliminated.");
@@ -973,7 +985,7 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
     storm::storage::BitVector const& scc, storm::storage::BitVector const& initialStates, storm::storage::SparseMatrix<ValueType> const& forwardTransitions,
     storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level, uint_fast64_t maximalSccSize,
     std::vector<storm::storage::sparse::state_type>& entryStateQueue, bool computeResultsForInitialStatesOnly,
-    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities, std::shared_ptr<EliminationOperationCache<ValueType>> const& operationCache) {
     uint_fast64_t maximalDepth = level;
 
     // If the SCCs are large enough, we try to split them further.
@@ -1004,7 +1016,8 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
         std::shared_ptr<StatePriorityQueue> statePriorities =
             createStatePriorityQueue(distanceBasedPriorities, matrix, backwardTransitions, values, statesInTrivialSccs);
         STORM_LOG_TRACE("Eliminating " << statePriorities->size() << " trivial SCCs.");
-        performPrioritizedStateElimination(statePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+        performPrioritizedStateElimination(statePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly,
+                                           operationCache);
         STORM_LOG_TRACE("Eliminated all trivial SCCs.");
 
         // And then recursively treat the remaining sub-SCCs.
@@ -1029,7 +1042,7 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
             uint_fast64_t depth =
                 treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions,
                          eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet(),
-                         level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
+                         level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities, operationCache);
             maximalDepth = std::max(maximalDepth, depth);
         }
     } else {
@@ -1037,7 +1050,8 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
         STORM_LOG_TRACE("SCC of size " << scc.getNumberOfSetBits() << " is small enough to be eliminated directly.");
         std::shared_ptr<StatePriorityQueue> statePriorities =
             createStatePriorityQueue(distanceBasedPriorities, matrix, backwardTransitions, values, scc & ~entryStates);
-        performPrioritizedStateElimination(statePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+        performPrioritizedStateElimination(statePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly,
+                                           operationCache);
         STORM_LOG_TRACE("Eliminated all states of SCC.");
     }
 
@@ -1045,7 +1059,8 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
     if (eliminateEntryStates) {
         STORM_LOG_TRACE("Finally, eliminating entry states.");
         std::shared_ptr<StatePriorityQueue> naivePriorities = createStatePriorityQueue(entryStates);
-        performPrioritizedStateElimination(naivePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+        performPrioritizedStateElimination(naivePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly,
+                                           operationCache);
         STORM_LOG_TRACE("Eliminated/added entry states.");
     } else {
         STORM_LOG_TRACE("Finally, adding entry states to queue.");
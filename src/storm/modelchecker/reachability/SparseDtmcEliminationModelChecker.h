@@ -2,6 +2,7 @@
 
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/solver/stateelimination/EliminationOperationCache.h"
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 #include "storm/storage/FlexibleSparseMatrix.h"
 #include "storm/storage/sparse/StateType.h"
@@ -83,7 +84,8 @@ class SparseDtmcEliminationModelChecker : public SparsePropositionalModelChecker
     static void performPrioritizedStateElimination(std::shared_ptr<StatePriorityQueue>& priorityQueue,
                                                    storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                                    storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values,
-                                                   storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly);
+                                                   storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly,
+                                                   std::shared_ptr<EliminationOperationCache<ValueType>> const& operationCache = nullptr);
 
     static void performOrdinaryStateElimination(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                                 storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
@@ -96,14 +98,16 @@ class SparseDtmcEliminationModelChecker : public SparsePropositionalModelChecker
                                                 storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
                                                 storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates,
                                                 bool computeResultsForInitialStatesOnly, std::vector<ValueType>& values,
-                                                boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities);
+                                                boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities,
+                                                std::shared_ptr<EliminationOperationCache<ValueType>> const& operationCache = nullptr);
 
     static uint_fast64_t performHybridStateElimination(storm::storage::SparseMatrix<ValueType> const& forwardTransitions,
                                                        storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                                        storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
                                                        storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates,
                                                        bool computeResultsForInitialStatesOnly, std::vector<ValueType>& values,
-                                                       boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities);
+                                                       boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities,
+                                                       std::shared_ptr<EliminationOperationCache<ValueType>> const& operationCache = nullptr);
 
     static uint_fast64_t treatScc(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, std::vector<ValueType>& values,
                                   storm::storage::BitVector const& entryStates, storm::storage::BitVector const& scc,
@@ -111,7 +115,8 @@ class SparseDtmcEliminationModelChecker : public SparsePropositionalModelChecker
                                   storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level,
                                   uint_fast64_t maximalSccSize, std::vector<storm::storage::sparse::state_type>& entryStateQueue,
                                   bool computeResultsForInitialStatesOnly,
-                                  boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities = boost::none);
+                                  boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities = boost::none,
+                                  std::shared_ptr<EliminationOperationCache<ValueType>> const& operationCache = nullptr);
 
     static bool checkConsistent(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                 storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions);
@@ -675,6 +675,15 @@ storm::settings::modules::AbstractionSettings& mutableAbstractionSettings() {
     return dynamic_cast<storm::settings::modules::AbstractionSettings&>(mutableManager().getModule(storm::settings::modules::AbstractionSettings::moduleName));
 }
 
+storm::settings::modules::SylvanSettings& mutableSylvanSettings() {
+    return dynamic_cast<storm::settings::modules::SylvanSettings&>(mutableManager().getModule(storm::settings::modules::SylvanSettings::moduleName));
+}
+
+storm::settings::modules::EliminationSettings& mutableEliminationSettings() {
+    return dynamic_cast<storm::settings::modules::EliminationSettings&>(
+        mutableManager().getModule(storm::settings::modules::EliminationSettings::moduleName));
+}
+
 void initializeAll(std::string const& name, std::string const& executableName) {
     storm::settings::mutableManager().setName(name, executableName);
 
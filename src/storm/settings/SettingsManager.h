@@ -15,6 +15,8 @@ namespace modules {
 class BuildSettings;
 class ModuleSettings;
 class AbstractionSettings;
+class SylvanSettings;
+class EliminationSettings;
 }  // namespace modules
 class Option;
 
@@ -321,6 +323,22 @@ storm::settings::modules::BuildSettings& mutableBuildSettings();
  */
 storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
 
+/*!
+ * Retrieves the Sylvan settings in a mutable form. This is only meant to be used for debug purposes or very
+ * rare cases where it is necessary.
+ *
+ * @return An object that allows accessing and modifying the Sylvan settings.
+ */
+storm::settings::modules::SylvanSettings& mutableSylvanSettings();
+
+/*!
+ * Retrieves the elimination settings in a mutable form. This is only meant to be used for debug purposes or very
+ * rare cases where it is necessary.
+ *
+ * @return An object that allows accessing and modifying the elimination settings.
+ */
+storm::settings::modules::EliminationSettings& mutableEliminationSettings();
+
 }  // namespace settings
 }  // namespace storm
 
@@ -21,6 +21,7 @@ const std::string BuildSettings::moduleName = "build";
 const std::string explorationOrderOptionName = "explorder";
 const std::string explorationOrderOptionShortName = "eo";
 const std::string explorationChecksOptionName = "explchecks";
+const std::string symbolicReachabilityOptionName = "ddreach";
 const std::string explorationChecksOptionShortName = "ec";
 const std::string prismCompatibilityOptionName = "prismcompat";
 const std::string prismCompatibilityOptionShortName = "pc";
@@ -81,6 +82,17 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("bfs")
                                          .build())
                         .build());
+    std::vector<std::string> symbolicReachabilityStrategies = {"bfs", "chaining", "saturation"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, symbolicReachabilityOptionName, false,
+                                                   "Sets how the symbolic engines compute the reachable states of the model.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name", "bfs: breadth-first search on the whole transition relation, chaining: apply one action at a time, "
+                                                 "saturation: saturate the actions bottom-up with respect to the variable order.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(symbolicReachabilityStrategies))
+                                         .setDefaultValueString("bfs")
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false,
                                                    "If set, additional checks (if available) are performed during model exploration to debug the model.")
                         .setShortName(explorationChecksOptionShortName)
@@ -190,6 +202,18 @@ storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
 }
 
+storm::builder::SymbolicReachabilityStrategy BuildSettings::getSymbolicReachabilityStrategy() const {
+    std::string strategyAsString = this->getOption(symbolicReachabilityOptionName).getArgumentByName("name").getValueAsString();
+    if (strategyAsString == "bfs") {
+        return storm::builder::SymbolicReachabilityStrategy::Bfs;
+    } else if (strategyAsString == "chaining") {
+        return storm::builder::SymbolicReachabilityStrategy::Chaining;
+    } else if (strategyAsString == "saturation") {
+        return storm::builder::SymbolicReachabilityStrategy::Saturation;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown symbolic reachability strategy '" << strategyAsString << "'.");
+}
+
 bool BuildSettings::isExplorationChecksSet() const {
     return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
 }
@@ -2,6 +2,7 @@
 
 #include "storm-config.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/SymbolicReachabilityStrategy.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
 namespace storm {
@@ -35,6 +36,13 @@ class BuildSettings : public ModuleSettings {
      */
     storm::builder::ExplorationOrder getExplorationOrder() const;
 
+    /*!
+     * Retrieves the strategy that the symbolic (DD-based) builders use to compute the reachable states.
+     *
+     * @return The chosen strategy.
+     */
+    storm::builder::SymbolicReachabilityStrategy getSymbolicReachabilityStrategy() const;
+
     /*!
      * Retrieves whether the PRISM compatibility mode was enabled.
      *
@@ -18,9 +18,10 @@ const std::string EliminationSettings::eliminationOrderOptionName = "order";
 const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
 const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
 const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+const std::string EliminationSettings::operationCacheSizeOptionName = "opcache";
 
 EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
+    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "dcost", "regex"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, eliminationOrderOptionName, true, "The order that is to be used for the elimination techniques.")
             .setIsAdvanced()
@@ -54,6 +55,14 @@ EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether to use the dedicated model elimination checker (only DTMCs).")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, operationCacheSizeOptionName, true,
+                                                   "Sets the maximal number of memoized sums and products during the elimination of parametric models.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "size", "The maximal number of memoized results per operation. Zero disables memoization.")
+                                         .setDefaultValueUnsignedInteger(100000)
+                                         .build())
+                        .build());
 }
 
 EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -83,6 +92,8 @@ EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder()
         return EliminationOrder::StaticPenalty;
     } else if (eliminationOrderAsString == "dpen") {
         return EliminationOrder::DynamicPenalty;
+    } else if (eliminationOrderAsString == "dcost") {
+        return EliminationOrder::DynamicCost;
     } else if (eliminationOrderAsString == "regex") {
         return EliminationOrder::RegularExpression;
     } else {
@@ -90,6 +101,41 @@ EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder()
     }
 }
 
+void EliminationSettings::setEliminationOrder(EliminationOrder order) {
+    std::string orderAsString;
+    switch (order) {
+        case EliminationOrder::Forward:
+            orderAsString = "fw";
+            break;
+        case EliminationOrder::ForwardReversed:
+            orderAsString = "fwrev";
+            break;
+        case EliminationOrder::Backward:
+            orderAsString = "bw";
+            break;
+        case EliminationOrder::BackwardReversed:
+            orderAsString = "bwrev";
+            break;
+        case EliminationOrder::Random:
+            orderAsString = "rand";
+            break;
+        case EliminationOrder::StaticPenalty:
+            orderAsString = "spen";
+            break;
+        case EliminationOrder::DynamicPenalty:
+            orderAsString = "dpen";
+            break;
+        case EliminationOrder::DynamicCost:
+            orderAsString = "dcost";
+            break;
+        case EliminationOrder::RegularExpression:
+            orderAsString = "regex";
+            break;
+    }
+    STORM_LOG_THROW(this->getOption(eliminationOrderOptionName).getArgumentByName("name").setFromStringValue(orderAsString),
+                    storm::exceptions::IllegalArgumentValueException, "Illegal elimination order selected.");
+}
+
 bool EliminationSettings::isEliminateEntryStatesLastSet() const {
     return this->getOption(entryStatesLastOptionName).getHasOptionBeenSet();
 }
@@ -101,6 +147,15 @@ uint_fast64_t EliminationSettings::getMaximalSccSize() const {
 bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
     return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
 }
+
+uint_fast64_t EliminationSettings::getOperationCacheSize() const {
+    return this->getOption(operationCacheSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
+void EliminationSettings::setOperationCacheSize(uint_fast64_t size) {
+    STORM_LOG_THROW(this->getOption(operationCacheSizeOptionName).getArgumentByName("size").setFromStringValue(std::to_string(size)),
+                    storm::exceptions::IllegalArgumentValueException, "Illegal size of the operation cache.");
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -15,7 +15,17 @@ class EliminationSettings : public ModuleSettings {
     /*!
      * An enum that contains all available state elimination orders.
      */
-    enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+    enum class EliminationOrder {
+        Forward,
+        ForwardReversed,
+        Backward,
+        BackwardReversed,
+        Random,
+        StaticPenalty,
+        DynamicPenalty,
+        DynamicCost,
+        RegularExpression
+    };
 
     /*!
      * An enum that contains all available elimination methods.
@@ -41,6 +51,13 @@ class EliminationSettings : public ModuleSettings {
      */
     EliminationOrder getEliminationOrder() const;
 
+    /*!
+     * Sets the elimination order.
+     *
+     * @param order The order to select.
+     */
+    void setEliminationOrder(EliminationOrder order);
+
     /*!
      * Retrieves whether the option to eliminate entry states in the very end is set.
      *
@@ -62,6 +79,20 @@ class EliminationSettings : public ModuleSettings {
      */
     bool isUseDedicatedModelCheckerSet() const;
 
+    /*!
+     * Retrieves the maximal number of memoized results of the sums and products computed during the elimination of parametric models.
+     *
+     * @return The maximal number of memoized results per operation (zero if memoization is disabled).
+     */
+    uint_fast64_t getOperationCacheSize() const;
+
+    /*!
+     * Sets the maximal number of memoized results of the sums and products computed during the elimination of parametric models.
+     *
+     * @param size The maximal number of memoized results per operation (zero disables memoization).
+     */
+    void setOperationCacheSize(uint_fast64_t size);
+
     const static std::string moduleName;
 
    private:
@@ -70,6 +101,7 @@ class EliminationSettings : public ModuleSettings {
     const static std::string entryStatesLastOptionName;
     const static std::string maximalSccSizeOptionName;
     const static std::string useDedicatedModelCheckerOptionName;
+    const static std::string operationCacheSizeOptionName;
 };
 
 }  // namespace modules
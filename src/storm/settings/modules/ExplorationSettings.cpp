@@ -19,6 +19,7 @@ const std::string ExplorationSettings::precomputationTypeOptionName = "precomp";
 const std::string ExplorationSettings::numberOfExplorationStepsUntilPrecomputationOptionName = "stepsprecomp";
 const std::string ExplorationSettings::numberOfSampledPathsUntilPrecomputationOptionName = "pathsprecomp";
 const std::string ExplorationSettings::nextStateHeuristicOptionName = "nextstate";
+const std::string ExplorationSettings::numberOfWorkersOptionName = "workers";
 const std::string ExplorationSettings::precisionOptionName = "precision";
 const std::string ExplorationSettings::precisionOptionShortName = "eps";
 
@@ -59,6 +60,16 @@ ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
                                          .build())
                         .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfWorkersOptionName, true,
+                                                   "Sets the number of workers that concurrently sample paths. Precomputations are then performed in the "
+                                                   "background.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of workers. If zero, the number is determined based on the available cores.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision to achieve.")
                         .setShortName(precisionOptionShortName)
                         .setIsAdvanced()
@@ -117,6 +128,10 @@ ExplorationSettings::NextStateHeuristic ExplorationSettings::getNextStateHeurist
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown next-state heuristic '" << nextStateHeuristicAsString << "'.");
 }
 
+uint_fast64_t ExplorationSettings::getNumberOfWorkers() const {
+    return this->getOption(numberOfWorkersOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 double ExplorationSettings::getPrecision() const {
     return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
 }
@@ -125,7 +140,8 @@ bool ExplorationSettings::check() const {
     bool optionsSet = this->getOption(precomputationTypeOptionName).getHasOptionBeenSet() ||
                       this->getOption(numberOfExplorationStepsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
                       this->getOption(numberOfSampledPathsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
-                      this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet();
+                      this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet() ||
+                      this->getOption(numberOfWorkersOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Exploration || !optionsSet,
                         "Exploration engine is not selected, so setting options for it has no effect.");
     return true;
@@ -72,6 +72,13 @@ class ExplorationSettings : public ModuleSettings {
      */
     NextStateHeuristic getNextStateHeuristic() const;
 
+    /*!
+     * Retrieves the number of workers that concurrently sample paths.
+     *
+     * @return The number of workers. Zero means that the number is to be determined automatically.
+     */
+    uint_fast64_t getNumberOfWorkers() const;
+
     /*!
      * Retrieves the precision to use for numerical operations.
      *
@@ -90,6 +97,7 @@ class ExplorationSettings : public ModuleSettings {
     static const std::string numberOfExplorationStepsUntilPrecomputationOptionName;
     static const std::string numberOfSampledPathsUntilPrecomputationOptionName;
     static const std::string nextStateHeuristicOptionName;
+    static const std::string numberOfWorkersOptionName;
     static const std::string precisionOptionName;
     static const std::string precisionOptionShortName;
 };
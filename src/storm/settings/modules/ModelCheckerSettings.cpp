@@ -14,6 +14,9 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::hybridMatrixEntryLimitOptionName = "hybridmatrixlimit";
+const std::string ModelCheckerSettings::epochThreadsOptionName = "epochthreads";
+const std::string ModelCheckerSettings::epochMemoryLimitOptionName = "epochmemlimit";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +30,31 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, hybridMatrixEntryLimitOptionName, false,
+                                                   "If set, the hybrid engine converts matrices block by block such that at most the given number of matrix "
+                                                   "entries is stored explicitly. Blocks that do not fit are converted again in every iteration.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("entries", "The maximal number of entries.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epochThreadsOptionName, false,
+                                                   "Sets the number of threads that concurrently analyze independent epochs when checking reward-bounded "
+                                                   "properties.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number is determined based on the available cores.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epochMemoryLimitOptionName, false,
+                                                   "If set, solutions of epochs of reward-bounded properties that are not needed soon are moved to a "
+                                                   "temporary file whenever the stored solutions occupy more than the given amount of memory.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("megabytes", "The approximate memory limit in megabytes.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +69,26 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isHybridMatrixEntryLimitSet() const {
+    return this->getOption(hybridMatrixEntryLimitOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getHybridMatrixEntryLimit() const {
+    return this->getOption(hybridMatrixEntryLimitOptionName).getArgumentByName("entries").getValueAsUnsignedInteger();
+}
+
+uint64_t ModelCheckerSettings::getEpochThreads() const {
+    return this->getOption(epochThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isEpochMemoryLimitSet() const {
+    return this->getOption(epochMemoryLimitOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getEpochMemoryLimit() const {
+    return this->getOption(epochMemoryLimitOptionName).getArgumentByName("megabytes").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
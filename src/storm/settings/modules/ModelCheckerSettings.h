@@ -35,6 +35,31 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether a limit on the number of explicitly stored matrix entries in the hybrid engine has been set.
+     */
+    bool isHybridMatrixEntryLimitSet() const;
+
+    /*!
+     * Retrieves the maximal number of matrix entries that the hybrid engine stores explicitly at the same time.
+     */
+    uint64_t getHybridMatrixEntryLimit() const;
+
+    /*!
+     * Retrieves the number of threads that analyze epochs of reward-bounded properties (0 means one thread per core).
+     */
+    uint64_t getEpochThreads() const;
+
+    /*!
+     * Retrieves whether a limit on the memory occupied by epoch solutions of reward-bounded properties has been set.
+     */
+    bool isEpochMemoryLimitSet() const;
+
+    /*!
+     * Retrieves the memory limit (in megabytes) for epoch solutions of reward-bounded properties.
+     */
+    uint64_t getEpochMemoryLimit() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +67,9 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string hybridMatrixEntryLimitOptionName;
+    static const std::string epochThreadsOptionName;
+    static const std::string epochMemoryLimitOptionName;
 };
 
 }  // namespace modules
@@ -19,6 +19,7 @@ const std::string MultiObjectiveSettings::schedulerRestrictionOptionName = "pure
 const std::string MultiObjectiveSettings::printResultsOptionName = "printres";
 const std::string MultiObjectiveSettings::encodingOptionName = "encoding";
 const std::string MultiObjectiveSettings::lexicographicOptionName = "lex";
+const std::string MultiObjectiveSettings::paretoThreadsOptionName = "paretothreads";
 
 MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"pcaa", "constraintbased"};
@@ -101,6 +102,14 @@ MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, lexicographicOptionName, false,
                                                    "If set, lexicographic model checking instead of normal multi objective is performed.")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, paretoThreadsOptionName, true,
+                                                   "Sets the number of weight vectors that are checked concurrently when approximating Pareto curves.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number is determined based on the available cores.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 storm::modelchecker::multiobjective::MultiObjectiveMethod MultiObjectiveSettings::getMultiObjectiveMethod() const {
@@ -219,6 +228,10 @@ bool MultiObjectiveSettings::isLexicographicModelCheckingSet() const {
     return this->getOption(lexicographicOptionName).getHasOptionBeenSet();
 }
 
+uint64_t MultiObjectiveSettings::getParetoThreads() const {
+    return this->getOption(paretoThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool MultiObjectiveSettings::check() const {
     std::shared_ptr<storm::settings::ArgumentValidator<std::string>> validator = ArgumentValidatorFactory::createWritableFileValidator();
 
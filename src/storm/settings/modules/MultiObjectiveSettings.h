@@ -126,6 +126,11 @@ class MultiObjectiveSettings : public ModuleSettings {
      */
     bool isRedundantBsccConstraintsSet() const;
 
+    /*!
+     * Retrieves the number of weight vectors that are checked concurrently when approximating Pareto curves (0 means one per core).
+     */
+    uint64_t getParetoThreads() const;
+
     /*!
      * Checks whether the settings are consistent. If they are inconsistent, an exception is thrown.
      *
@@ -144,6 +149,7 @@ class MultiObjectiveSettings : public ModuleSettings {
     const static std::string printResultsOptionName;
     const static std::string encodingOptionName;
     const static std::string lexicographicOptionName;
+    const static std::string paretoThreadsOptionName;
 };
 
 }  // namespace modules
@@ -6,6 +6,7 @@
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/utility/threads.h"
 
 namespace storm {
@@ -15,6 +16,7 @@ namespace modules {
 const std::string SylvanSettings::moduleName = "sylvan";
 const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
 const std::string SylvanSettings::threadCountOptionName = "threads";
+const std::string SylvanSettings::keepWorkersAwakeOptionName = "keepawake";
 
 SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.")
@@ -29,6 +31,10 @@ SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                                          "value", "The number of threads available to Sylvan (0 means 'auto-detect').")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, keepWorkersAwakeOptionName, true,
+                                                   "If set, the threads of Sylvan keep (busy) waiting for work even while no DD operations are performed.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 uint_fast64_t SylvanSettings::getMaximalMemory() const {
@@ -39,6 +45,14 @@ bool SylvanSettings::isNumberOfThreadsSet() const {
     return this->getOption(threadCountOptionName).getArgumentByName("value").getHasBeenSet();
 }
 
+bool SylvanSettings::isKeepWorkersAwakeSet() const {
+    return this->getOption(keepWorkersAwakeOptionName).getHasOptionBeenSet();
+}
+
+std::unique_ptr<storm::settings::SettingMemento> SylvanSettings::overrideKeepWorkersAwakeSet(bool stateToSet) {
+    return this->overrideOption(keepWorkersAwakeOptionName, stateToSet);
+}
+
 uint_fast64_t SylvanSettings::getNumberOfThreads() const {
     if (isNumberOfThreadsSet()) {
         auto numberFromSettings = this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
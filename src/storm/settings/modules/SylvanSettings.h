@@ -37,6 +37,20 @@ class SylvanSettings : public ModuleSettings {
      */
     bool isNumberOfThreadsSet() const;
 
+    /*!
+     * Retrieves whether the worker threads of Sylvan are to be kept running even if no DD operations are performed.
+     */
+    bool isKeepWorkersAwakeSet() const;
+
+    /*!
+     * Overrides the option to keep the worker threads of Sylvan awake. As soon as the returned memento goes out of
+     * scope, the original value is restored. Note that the option only takes effect when Sylvan is (re-)initialized.
+     *
+     * @param stateToSet The value that is to be set for the option.
+     * @return The memento that will eventually restore the original value.
+     */
+    std::unique_ptr<storm::settings::SettingMemento> overrideKeepWorkersAwakeSet(bool stateToSet);
+
     bool check() const override;
 
     // The name of the module.
@@ -46,6 +60,7 @@ class SylvanSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string maximalMemoryOptionName;
     static const std::string threadCountOptionName;
+    static const std::string keepWorkersAwakeOptionName;
 };
 
 }  // namespace modules
@@ -0,0 +1,267 @@
+#include "storm/simulator/DiscreteTimeSparseModelBatchSimulator.h"
+
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace simulator {
+
+namespace detail {
+static const uint64_t noRow = std::numeric_limits<uint64_t>::max();
+}
+
+template<typename ValueType, typename RewardModelType>
+DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::DiscreteTimeSparseModelBatchSimulator(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& model, uint64_t numberOfPaths, uint64_t chunkSize)
+    : model(model), numberOfPaths(numberOfPaths), chunkSize(chunkSize), numberOfThreads(1), initialState(*model.getInitialStates().begin()) {
+    STORM_LOG_THROW(chunkSize > 0, storm::exceptions::InvalidArgumentException, "The chunk size must be positive.");
+    STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1,
+                        "The model has multiple initial states. This simulator assumes it starts from the initial state with the lowest index.");
+    initializeAliasTables();
+
+    auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+    for (auto const& rewModPair : model.getRewardModels()) {
+        rewardModelNames.push_back(rewModPair.first);
+        if (rewModPair.second.hasStateRewards()) {
+            stateRewards.push_back(rewModPair.second.getStateRewardVector());
+        } else {
+            stateRewards.emplace_back(model.getNumberOfStates(), storm::utility::zero<ValueType>());
+        }
+        // State-action rewards are stored per row such that they can be looked up directly.
+        std::vector<ValueType> actionRewards(model.getTransitionMatrix().getRowCount(), storm::utility::zero<ValueType>());
+        if (rewModPair.second.hasStateActionRewards()) {
+            actionRewards = rewModPair.second.getStateActionRewardVector();
+        }
+        STORM_LOG_ASSERT(actionRewards.size() == rowGroupIndices.back(), "Unexpected size of the state-action reward vector.");
+        stateActionRewards.push_back(std::move(actionRewards));
+    }
+
+    uint64_t numberOfChunks = (numberOfPaths + chunkSize - 1) / chunkSize;
+    engines.resize(numberOfChunks);
+    setSeed(std::random_device()());
+    resetToInitial();
+}
+
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::initializeAliasTables() {
+    // Build the alias tables using Vose's method. The tables are stored parallel to the entries of the transition matrix.
+    auto const& matrix = model.getTransitionMatrix();
+    aliasProbabilities.assign(matrix.getEntryCount(), 1.0);
+    aliasOffsets.resize(matrix.getEntryCount());
+    std::vector<double> scaled;
+    std::vector<uint64_t> small, large;
+    uint64_t entryIndex = 0;
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        uint64_t const rowStart = entryIndex;
+        uint64_t const rowLength = matrix.getRow(row).getNumberOfEntries();
+        entryIndex += rowLength;
+        for (uint64_t offset = 0; offset < rowLength; ++offset) {
+            aliasOffsets[rowStart + offset] = offset;
+        }
+        if (rowLength <= 1) {
+            continue;
+        }
+        scaled.clear();
+        double rowSum = 0.0;
+        for (auto const& entry : matrix.getRow(row)) {
+            scaled.push_back(storm::utility::convertNumber<double>(entry.getValue()));
+            rowSum += scaled.back();
+        }
+        STORM_LOG_THROW(rowSum > 0.0, storm::exceptions::InvalidArgumentException, "Row " << row << " of the transition matrix has no probability mass.");
+        small.clear();
+        large.clear();
+        for (uint64_t offset = 0; offset < rowLength; ++offset) {
+            scaled[offset] *= static_cast<double>(rowLength) / rowSum;
+            (scaled[offset] < 1.0 ? small : large).push_back(offset);
+        }
+        while (!small.empty() && !large.empty()) {
+            uint64_t lower = small.back();
+            small.pop_back();
+            uint64_t higher = large.back();
+            aliasProbabilities[rowStart + lower] = scaled[lower];
+            aliasOffsets[rowStart + lower] = higher;
+            scaled[higher] -= 1.0 - scaled[lower];
+            if (scaled[higher] < 1.0) {
+                large.pop_back();
+                small.push_back(higher);
+            }
+        }
+        // Remaining entries (only due to numerical inaccuracies in the small list) are kept with probability one.
+        for (auto offset : small) {
+            aliasProbabilities[rowStart + offset] = 1.0;
+        }
+        for (auto offset : large) {
+            aliasProbabilities[rowStart + offset] = 1.0;
+        }
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::setSeed(uint64_t seed) {
+    std::seed_seq seedSequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+    std::vector<uint64_t> chunkSeeds(engines.size());
+    seedSequence.generate(chunkSeeds.begin(), chunkSeeds.end());
+    for (uint64_t chunk = 0; chunk < engines.size(); ++chunk) {
+        engines[chunk].seed(chunkSeeds[chunk]);
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    this->numberOfThreads = numberOfThreads;
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::sampleSuccessorOffset(uint64_t row, std::mt19937_64& engine) const {
+    auto const& matrix = model.getTransitionMatrix();
+    uint64_t const rowLength = matrix.getRow(row).getNumberOfEntries();
+    STORM_LOG_THROW(rowLength > 0, storm::exceptions::InvalidArgumentException, "Row " << row << " of the transition matrix has no successors.");
+    if (rowLength == 1) {
+        // No need to draw a random number.
+        return 0;
+    }
+    // A single random number determines both the column of the alias table and the biased coin.
+    double const scaledRandom = std::generate_canonical<double, std::numeric_limits<double>::digits>(engine) * static_cast<double>(rowLength);
+    uint64_t const offset = std::min(static_cast<uint64_t>(scaledRandom), rowLength - 1);
+    uint64_t const entryIndex = (matrix.begin(row) - matrix.begin()) + offset;
+    return (scaledRandom - static_cast<double>(offset)) < aliasProbabilities[entryIndex] ? offset : aliasOffsets[entryIndex];
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::stepChunk(uint64_t chunk, std::vector<uint64_t> const* actions) {
+    auto const& matrix = model.getTransitionMatrix();
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    auto& engine = engines[chunk];
+    uint64_t const begin = chunk * chunkSize;
+    uint64_t const end = std::min(begin + chunkSize, numberOfPaths);
+
+    // First, move all paths to their successors and remember the rows that were taken.
+    std::vector<uint64_t> rows(end - begin);
+    uint64_t numberOfAdvancedPaths = 0;
+    for (uint64_t path = begin; path < end; ++path) {
+        uint64_t const state = currentStates[path];
+        uint64_t const numberOfActions = rowGroupIndices[state + 1] - rowGroupIndices[state];
+        if (numberOfActions == 0) {
+            rows[path - begin] = detail::noRow;
+            continue;
+        }
+        uint64_t action = 0;
+        if (actions != nullptr) {
+            action = (*actions)[path];
+            STORM_LOG_ASSERT(action < numberOfActions, "Action index higher than number of actions");
+        } else if (numberOfActions > 1) {
+            action = std::min(static_cast<uint64_t>(std::generate_canonical<double, std::numeric_limits<double>::digits>(engine) * numberOfActions),
+                              numberOfActions - 1);
+        }
+        uint64_t const row = rowGroupIndices[state] + action;
+        rows[path - begin] = row;
+        currentStates[path] = matrix.begin(row)[sampleSuccessorOffset(row, engine)].getColumn();
+        ++numberOfAdvancedPaths;
+    }
+
+    // Then, collect the rewards for one reward model at a time.
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelNames.size(); ++rewardModelIndex) {
+        auto const& actionRewards = stateActionRewards[rewardModelIndex];
+        auto const& successorRewards = stateRewards[rewardModelIndex];
+        auto& last = lastRewards[rewardModelIndex];
+        auto& accumulated = accumulatedRewards[rewardModelIndex];
+        for (uint64_t path = begin; path < end; ++path) {
+            uint64_t const row = rows[path - begin];
+            if (row == detail::noRow) {
+                last[path] = storm::utility::zero<ValueType>();
+                continue;
+            }
+            ValueType reward = actionRewards[row] + successorRewards[currentStates[path]];
+            accumulated[path] += reward;
+            last[path] = std::move(reward);
+        }
+    }
+    return numberOfAdvancedPaths;
+}
+
+template<typename ValueType, typename RewardModelType>
+template<typename ChunkFunction>
+uint64_t DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::forEachChunk(ChunkFunction const& function) {
+    std::vector<uint64_t> results(engines.size(), 0);
+    storm::utility::parallel::forEachTask(engines.size(), numberOfThreads, [&](uint64_t, uint64_t chunk) { results[chunk] = function(chunk); });
+    uint64_t sum = 0;
+    for (auto const& result : results) {
+        sum += result;
+    }
+    return sum;
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::step(std::vector<uint64_t> const& actions) {
+    STORM_LOG_THROW(actions.size() == numberOfPaths, storm::exceptions::InvalidArgumentException,
+                    "Expected " << numberOfPaths << " actions but got " << actions.size() << ".");
+    return forEachChunk([&](uint64_t chunk) { return stepChunk(chunk, &actions); });
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::randomStep() {
+    return forEachChunk([&](uint64_t chunk) { return stepChunk(chunk, nullptr); });
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::randomSteps(uint64_t numberOfSteps) {
+    return forEachChunk([&](uint64_t chunk) {
+        uint64_t const chunkLength = std::min(chunkSize, numberOfPaths - chunk * chunkSize);
+        uint64_t numberOfAdvancedPaths = chunkLength;
+        for (uint64_t stepIndex = 0; stepIndex < numberOfSteps; ++stepIndex) {
+            // Paths that got stuck stay stuck, so the minimum is attained in the last step.
+            numberOfAdvancedPaths = stepChunk(chunk, nullptr);
+        }
+        return numberOfSteps == 0 ? chunkLength : numberOfAdvancedPaths;
+    });
+}
+
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::resetToInitial() {
+    currentStates.assign(numberOfPaths, initialState);
+    lastRewards.resize(rewardModelNames.size());
+    accumulatedRewards.resize(rewardModelNames.size());
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelNames.size(); ++rewardModelIndex) {
+        lastRewards[rewardModelIndex].assign(numberOfPaths, stateRewards[rewardModelIndex][initialState]);
+        accumulatedRewards[rewardModelIndex].assign(numberOfPaths, stateRewards[rewardModelIndex][initialState]);
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::getNumberOfPaths() const {
+    return numberOfPaths;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<uint64_t> const& DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::getCurrentStates() const {
+    return currentStates;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<std::string> const& DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::getRewardModelNames() const {
+    return rewardModelNames;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> const& DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::getLastRewards(uint64_t rewardModelIndex) const {
+    STORM_LOG_ASSERT(rewardModelIndex < lastRewards.size(), "Reward model index out of range.");
+    return lastRewards[rewardModelIndex];
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> const& DiscreteTimeSparseModelBatchSimulator<ValueType, RewardModelType>::getAccumulatedRewards(uint64_t rewardModelIndex) const {
+    STORM_LOG_ASSERT(rewardModelIndex < accumulatedRewards.size(), "Reward model index out of range.");
+    return accumulatedRewards[rewardModelIndex];
+}
+
+template class DiscreteTimeSparseModelBatchSimulator<double>;
+template class DiscreteTimeSparseModelBatchSimulator<storm::RationalNumber>;
+
+}  // namespace simulator
+}  // namespace storm
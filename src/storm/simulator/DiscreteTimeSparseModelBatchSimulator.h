@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace simulator {
+
+/**
+ * This class samples many independent paths of a Discrete-Time Model stored explicitly as a SparseModel at once.
+ * In contrast to the DiscreteTimeSparseModelSimulator, successors are drawn in constant time using alias tables that are precomputed for every row
+ * of the transition matrix. The path states and rewards are stored as structures of arrays, i.e., there is one vector (indexed by path) for the current
+ * states and one vector for each reward model.
+ *
+ * The paths are partitioned into fixed-size chunks and each chunk has its own random number engine (seeded from the overall seed and the chunk index).
+ * The sampled paths therefore only depend on the seed and not on the number of threads used to advance the chunks.
+ *
+ * Reward models are indexed in the order given by getRewardModelNames().
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+class DiscreteTimeSparseModelBatchSimulator {
+   public:
+    /*!
+     * Creates a simulator for the given number of paths. All paths start in the initial state with the lowest index.
+     *
+     * @param model The model to simulate. The model must outlive the simulator.
+     * @param numberOfPaths The number of paths that are sampled simultaneously.
+     * @param chunkSize The number of paths that share one random number engine and are advanced by the same thread.
+     */
+    DiscreteTimeSparseModelBatchSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model, uint64_t numberOfPaths,
+                                          uint64_t chunkSize = 1024);
+
+    /*!
+     * Reseeds the random number engines of all chunks.
+     */
+    void setSeed(uint64_t seed);
+
+    /*!
+     * Sets the number of threads used to advance the paths. Zero means that the number of threads is detected automatically.
+     * By default, a single thread is used.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
+    /*!
+     * Advances every path by one step, taking the given action in the current state of the respective path.
+     *
+     * @param actions For each path, the local index of the action to take.
+     * @return The number of paths that were advanced, i.e., the number of paths whose current state has at least one action.
+     */
+    uint64_t step(std::vector<uint64_t> const& actions);
+
+    /*!
+     * Advances every path by one step, choosing the action in the current state uniformly at random.
+     *
+     * @return The number of paths that were advanced, i.e., the number of paths whose current state has at least one action.
+     */
+    uint64_t randomStep();
+
+    /*!
+     * Advances every path by the given number of steps, choosing the actions uniformly at random.
+     * The rewards collected during all steps are added to the accumulated rewards, whereas the last rewards only refer to the final step.
+     * This is considerably faster than calling randomStep repeatedly since threads only synchronize once.
+     *
+     * @return The number of paths that could be advanced in every step.
+     */
+    uint64_t randomSteps(uint64_t numberOfSteps);
+
+    /*!
+     * Resets all paths to the initial state and clears all rewards.
+     */
+    void resetToInitial();
+
+    uint64_t getNumberOfPaths() const;
+    std::vector<uint64_t> const& getCurrentStates() const;
+    std::vector<std::string> const& getRewardModelNames() const;
+
+    /*!
+     * Retrieves the rewards (per path) collected in the last step for the reward model with the given index.
+     */
+    std::vector<ValueType> const& getLastRewards(uint64_t rewardModelIndex) const;
+
+    /*!
+     * Retrieves the rewards (per path) accumulated since the last reset for the reward model with the given index.
+     * The state reward of the initial state is included.
+     */
+    std::vector<ValueType> const& getAccumulatedRewards(uint64_t rewardModelIndex) const;
+
+   private:
+    void initializeAliasTables();
+
+    /*!
+     * Samples the (local) index of the successor entry of the given row.
+     */
+    uint64_t sampleSuccessorOffset(uint64_t row, std::mt19937_64& engine) const;
+
+    /*!
+     * Advances the paths of the given chunk by one step. If actions is nullptr, actions are chosen uniformly at random.
+     * @return the number of advanced paths
+     */
+    uint64_t stepChunk(uint64_t chunk, std::vector<uint64_t> const* actions);
+
+    /*!
+     * Calls the given function for every chunk, potentially in parallel, and sums up the returned values.
+     */
+    template<typename ChunkFunction>
+    uint64_t forEachChunk(ChunkFunction const& function);
+
+    storm::models::sparse::Model<ValueType, RewardModelType> const& model;
+    uint64_t numberOfPaths;
+    uint64_t chunkSize;
+    uint64_t numberOfThreads;
+    uint64_t initialState;
+
+    // For each entry of the transition matrix, the probability to keep the entry (as opposed to taking the alias) and the alias (as an offset within the row).
+    std::vector<double> aliasProbabilities;
+    std::vector<uint64_t> aliasOffsets;
+
+    // The reward structures, stored densely for each reward model.
+    std::vector<std::string> rewardModelNames;
+    std::vector<std::vector<ValueType>> stateRewards;
+    std::vector<std::vector<ValueType>> stateActionRewards;
+
+    // The path state as structure of arrays.
+    std::vector<uint64_t> currentStates;
+    std::vector<std::vector<ValueType>> lastRewards;
+    std::vector<std::vector<ValueType>> accumulatedRewards;
+
+    std::vector<std::mt19937_64> engines;
+};
+}  // namespace simulator
+}  // namespace storm
@@ -0,0 +1,85 @@
+#include "storm/solver/stateelimination/EliminationOperationCache.h"
+
+#include <functional>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+template<typename ValueType>
+std::size_t EliminationOperandsHash<ValueType>::operator()(std::pair<ValueType, ValueType> const& operands) const {
+    std::hash<ValueType> hasher;
+    std::size_t seed = hasher(operands.first);
+    seed ^= hasher(operands.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+template<typename ValueType>
+EliminationOperationCache<ValueType>::EliminationOperationCache(uint64_t maximalSize) : maximalSize(maximalSize), numberOfHits(0), numberOfMisses(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+ValueType EliminationOperationCache<ValueType>::multiply(ValueType const& first, ValueType const& second) {
+    return getResult(products, first, second, [](ValueType const& a, ValueType const& b) { return storm::utility::simplify((ValueType)(a * b)); });
+}
+
+template<typename ValueType>
+ValueType EliminationOperationCache<ValueType>::add(ValueType const& first, ValueType const& second) {
+    return getResult(sums, first, second, [](ValueType const& a, ValueType const& b) { return storm::utility::simplify((ValueType)(a + b)); });
+}
+
+template<typename ValueType>
+template<typename OperationType>
+ValueType EliminationOperationCache<ValueType>::getResult(ResultMap& results, ValueType const& first, ValueType const& second,
+                                                          OperationType const& operation) {
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        // Constant operands are cheap to combine, so there is no need to store their results.
+        if (maximalSize == 0 || storm::utility::isConstant(first) || storm::utility::isConstant(second)) {
+            return operation(first, second);
+        }
+
+        // As both operations are commutative, we bring the operands into a canonical order.
+        std::hash<ValueType> hasher;
+        bool swapOperands = hasher(second) < hasher(first);
+        std::pair<ValueType, ValueType> operands = swapOperands ? std::make_pair(second, first) : std::make_pair(first, second);
+        auto resultIt = results.find(operands);
+        if (resultIt != results.end()) {
+            ++numberOfHits;
+            return resultIt->second;
+        }
+        ++numberOfMisses;
+        ValueType result = operation(first, second);
+        if (results.size() >= maximalSize) {
+            results.clear();
+        }
+        results.emplace(std::move(operands), result);
+        return result;
+    } else {
+        return operation(first, second);
+    }
+}
+
+template<typename ValueType>
+uint64_t EliminationOperationCache<ValueType>::getNumberOfHits() const {
+    return numberOfHits;
+}
+
+template<typename ValueType>
+uint64_t EliminationOperationCache<ValueType>::getNumberOfMisses() const {
+    return numberOfMisses;
+}
+
+template class EliminationOperationCache<double>;
+
+#ifdef STORM_HAVE_CARL
+template class EliminationOperationCache<storm::RationalNumber>;
+template class EliminationOperationCache<storm::RationalFunction>;
+#endif
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+#include "storm/adapters/RationalFunctionForward.h"
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+template<typename ValueType>
+struct EliminationOperandsHash {
+    std::size_t operator()(std::pair<ValueType, ValueType> const& operands) const;
+};
+
+/*!
+ * Computes the (simplified) sums and products that occur during state elimination.
+ * Eliminating states of parametric models frequently combines the same pairs of rational functions, whose sums and products are expensive to
+ * compute as they involve gcd computations. For rational functions, the results are therefore memoized (up to a maximal number of results).
+ * For all other value types, the results are computed directly.
+ */
+template<typename ValueType>
+class EliminationOperationCache {
+   public:
+    /*!
+     * Creates a cache.
+     * @param maximalSize The maximal number of results that are stored for each operation. If this number is exceeded, the stored results
+     * of the operation are dropped. Zero disables the memoization.
+     */
+    explicit EliminationOperationCache(uint64_t maximalSize = 0);
+
+    /*!
+     * Retrieves the simplified product of the given values.
+     */
+    ValueType multiply(ValueType const& first, ValueType const& second);
+
+    /*!
+     * Retrieves the simplified sum of the given values.
+     */
+    ValueType add(ValueType const& first, ValueType const& second);
+
+    uint64_t getNumberOfHits() const;
+    uint64_t getNumberOfMisses() const;
+
+   private:
+    typedef std::unordered_map<std::pair<ValueType, ValueType>, ValueType, EliminationOperandsHash<ValueType>> ResultMap;
+
+    template<typename OperationType>
+    ValueType getResult(ResultMap& results, ValueType const& first, ValueType const& second, OperationType const& operation);
+
+    uint64_t maximalSize;
+    ResultMap products;
+    ResultMap sums;
+    uint64_t numberOfHits;
+    uint64_t numberOfMisses;
+};
+
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
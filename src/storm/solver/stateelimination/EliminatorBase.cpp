@@ -19,6 +19,19 @@ EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMa
     // Intentionally left empty.
 }
 
+template<typename ValueType, ScalingMode Mode>
+void EliminatorBase<ValueType, Mode>::setOperationCache(std::shared_ptr<EliminationOperationCache<ValueType>> const& cache) {
+    operationCache = cache;
+}
+
+template<typename ValueType, ScalingMode Mode>
+EliminationOperationCache<ValueType>& EliminatorBase<ValueType, Mode>::getOperationCache() {
+    if (!operationCache) {
+        operationCache = std::make_shared<EliminationOperationCache<ValueType>>();
+    }
+    return *operationCache;
+}
+
 template<typename ValueType, ScalingMode Mode>
 void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, bool clearRow) {
     using MatrixEntry = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
@@ -64,7 +77,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Only scale the entries in a different column.
             if (entryIt->getColumn() != column) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(getOperationCache().multiply(entryIt->getValue(), columnValue));
             }
         }
         updateValue(row, columnValue);
@@ -145,7 +158,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
-                ValueType successorValue = storm::utility::simplify<ValueType>((first2->getValue() * multiplyFactor));
+                ValueType successorValue = getOperationCache().multiply(first2->getValue(), multiplyFactor);
                 *result = MatrixEntry(first2->getColumn(), successorValue);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorValue);
                 ++first2;
@@ -154,9 +167,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 *result = *first1;
                 ++first1;
             } else {
-                ValueType sprod = multiplyFactor * first2->getValue();
-                ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
-                auto probability = storm::utility::simplify(sum);
+                ValueType probability = getOperationCache().add(first1->getValue(), getOperationCache().multiply(multiplyFactor, first2->getValue()));
                 *result = MatrixEntry(first1->getColumn(), probability);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
                 ++first1;
@@ -166,7 +177,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
         for (; first2 != last2; ++first2) {
             if (first2->getColumn() != column) {
-                ValueType probability = storm::utility::simplify<ValueType>(first2->getValue() * multiplyFactor);
+                ValueType probability = getOperationCache().multiply(first2->getValue(), multiplyFactor);
                 *result = MatrixEntry(first2->getColumn(), probability);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
                 ++successorOffsetInNewBackwardTransitions;
@@ -293,7 +304,7 @@ void EliminatorBase<ValueType, Mode>::eliminateLoop(uint64_t state) {
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Scale the entries in a different column, set state transition probability to 0.
             if (entryIt->getColumn() != state) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(getOperationCache().multiply(entryIt->getValue(), columnValue));
             } else {
                 entryIt->setValue(storm::utility::zero<ValueType>());
             }
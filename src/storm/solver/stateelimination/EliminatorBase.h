@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+
+#include "storm/solver/stateelimination/EliminationOperationCache.h"
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/FlexibleSparseMatrix.h"
@@ -23,6 +26,11 @@ class EliminatorBase {
 
     void eliminateLoop(uint64_t row);
 
+    /*!
+     * Sets the cache that is used to compute the sums and products during elimination. The cache may be shared among several eliminators.
+     */
+    void setOperationCache(std::shared_ptr<EliminationOperationCache<ValueType>> const& cache);
+
     // Provide virtual methods that can be customized by subclasses to govern side-effect of the elimination.
     virtual void updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability);
     virtual void updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability,
@@ -32,8 +40,14 @@ class EliminatorBase {
     virtual bool isFilterPredecessor() const;
 
    protected:
+    /*!
+     * Retrieves the cache that is used to compute the sums and products. If no cache was set, a (non-memoizing) cache is created on first use.
+     */
+    EliminationOperationCache<ValueType>& getOperationCache();
+
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
     storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+    std::shared_ptr<EliminationOperationCache<ValueType>> operationCache;
 };
 
 }  // namespace stateelimination
@@ -1,11 +1,13 @@
 #include "storm/storage/dd/Add.h"
 
 #include <cstdint>
+#include <numeric>
 
 #include <boost/algorithm/string/join.hpp>
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/dd/ExecutionScope.h"
 #include "storm/storage/dd/Odd.h"
 
 #include "storm/storage/BitVector.h"
@@ -568,6 +570,8 @@ std::vector<ValueType> Add<LibraryType, ValueType>::toVector(storm::dd::Add<Libr
                                                              std::set<storm::expressions::Variable> const& columnMetaVariables,
                                                              std::set<storm::expressions::Variable> const& groupMetaVariables,
                                                              storm::dd::Odd const& rowOdd) const {
+    // The translation performs many DD operations in a row, so the workers of the DD library are kept running throughout.
+    ExecutionScope<LibraryType> executionScope;
     std::vector<uint_fast64_t> ddRowVariableIndices;
     std::vector<uint_fast64_t> ddColumnVariableIndices;
     std::vector<uint_fast64_t> ddGroupVariableIndices;
@@ -632,6 +636,7 @@ std::vector<ValueType> Add<LibraryType, ValueType>::toVector(storm::dd::Add<Libr
 
 template<DdType LibraryType, typename ValueType>
 storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix() const {
+    ExecutionScope<LibraryType> executionScope;
     std::set<storm::expressions::Variable> rowVariables;
     std::set<storm::expressions::Variable> columnVariables;
 
@@ -666,6 +671,7 @@ template<DdType LibraryType, typename ValueType>
 storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                               std::set<storm::expressions::Variable> const& columnMetaVariables,
                                                                               storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+    ExecutionScope<LibraryType> executionScope;
     std::vector<uint_fast64_t> ddRowVariableIndices;
     std::vector<uint_fast64_t> ddColumnVariableIndices;
 
@@ -725,6 +731,66 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
     return storm::storage::SparseMatrix<ValueType>(columnOdd.getTotalOffset(), std::move(rowIndications), std::move(columnsAndValues), boost::none);
 }
 
+template<DdType LibraryType, typename ValueType>
+storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                              std::set<storm::expressions::Variable> const& columnMetaVariables,
+                                                                              storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+                                                                              uint_fast64_t firstRow, uint_fast64_t endRow) const {
+    STORM_LOG_THROW(firstRow <= endRow && endRow <= rowOdd.getTotalOffset(), storm::exceptions::InvalidArgumentException,
+                    "Illegal row range [" << firstRow << ", " << endRow << ") for matrix with " << rowOdd.getTotalOffset() << " rows.");
+    ExecutionScope<LibraryType> executionScope;
+    std::vector<uint_fast64_t> ddRowVariableIndices;
+    std::vector<uint_fast64_t> ddColumnVariableIndices;
+
+    for (auto const& variable : rowMetaVariables) {
+        DdMetaVariable<LibraryType> const& metaVariable = this->getDdManager().getMetaVariable(variable);
+        for (auto const& ddVariable : metaVariable.getDdVariables()) {
+            ddRowVariableIndices.push_back(ddVariable.getIndex());
+        }
+    }
+    std::sort(ddRowVariableIndices.begin(), ddRowVariableIndices.end());
+
+    for (auto const& variable : columnMetaVariables) {
+        DdMetaVariable<LibraryType> const& metaVariable = this->getDdManager().getMetaVariable(variable);
+        for (auto const& ddVariable : metaVariable.getDdVariables()) {
+            ddColumnVariableIndices.push_back(ddVariable.getIndex());
+        }
+    }
+    std::sort(ddColumnVariableIndices.begin(), ddColumnVariableIndices.end());
+
+    // Create a trivial row grouping (relative to the first row).
+    uint_fast64_t numberOfRows = endRow - firstRow;
+    std::vector<uint_fast64_t> trivialRowGroupIndices(numberOfRows + 1);
+    std::iota(trivialRowGroupIndices.begin(), trivialRowGroupIndices.end(), 0ull);
+
+    // Count the number of elements in the rows. This only traverses the part of the DD that encodes the requested rows.
+    std::vector<uint_fast64_t> rowIndications(numberOfRows + 1, 0);
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues;
+    internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
+                                   false, firstRow, endRow);
+
+    // Now that we computed the number of entries in each row, compute the corresponding offsets in the entry vector.
+    uint_fast64_t numberOfEntries = 0;
+    for (auto& entry : rowIndications) {
+        uint_fast64_t numberOfEntriesInRow = entry;
+        entry = numberOfEntries;
+        numberOfEntries += numberOfEntriesInRow;
+    }
+
+    // Now actually fill the entry vector.
+    columnsAndValues.resize(numberOfEntries);
+    internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
+                                   true, firstRow, endRow);
+
+    // Since filling the entries modified the rowIndications, we need to restore the correct values.
+    for (uint_fast64_t i = rowIndications.size() - 1; i > 0; --i) {
+        rowIndications[i] = rowIndications[i - 1];
+    }
+    rowIndications[0] = 0;
+
+    return storm::storage::SparseMatrix<ValueType>(columnOdd.getTotalOffset(), std::move(rowIndications), std::move(columnsAndValues), boost::none);
+}
+
 template<DdType LibraryType, typename ValueType>
 storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(std::set<storm::expressions::Variable> const& groupMetaVariables,
                                                                               storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
@@ -753,6 +819,7 @@ typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueTy
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
     std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
     std::vector<std::set<storm::expressions::Variable>> const& labelMetaVariables) const {
+    ExecutionScope<LibraryType> executionScope;
     std::vector<uint_fast64_t> ddRowVariableIndices;
     std::vector<uint_fast64_t> ddColumnVariableIndices;
     std::vector<uint_fast64_t> ddGroupVariableIndices;
@@ -941,6 +1008,7 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> Add<L
     storm::dd::Add<LibraryType, ValueType> const& vector, std::set<storm::expressions::Variable> const& rowMetaVariables,
     std::set<storm::expressions::Variable> const& columnMetaVariables, std::set<storm::expressions::Variable> const& groupMetaVariables,
     storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+    ExecutionScope<LibraryType> executionScope;
     // Count how many choices each row group has.
     std::vector<uint_fast64_t> rowGroupIndices = (this->notZero().existsAbstract(columnMetaVariables) || vector.notZero())
                                                      .template toAdd<uint_fast64_t>()
@@ -962,6 +1030,7 @@ template<DdType LibraryType, typename ValueType>
 std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<ValueType>>> Add<LibraryType, ValueType>::toMatrixVectors(
     std::vector<storm::dd::Add<LibraryType, ValueType>> const& vectors, std::set<storm::expressions::Variable> const& groupMetaVariables,
     storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+    ExecutionScope<LibraryType> executionScope;
     std::set<storm::expressions::Variable> rowMetaVariables;
     std::set<storm::expressions::Variable> columnMetaVariables;
 
@@ -994,6 +1063,7 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<Value
     std::vector<uint_fast64_t>&& rowGroupIndices, std::vector<storm::dd::Add<LibraryType, ValueType>> const& vectors,
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
     std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+    ExecutionScope<LibraryType> executionScope;
     std::vector<uint_fast64_t> ddRowVariableIndices;
     std::vector<uint_fast64_t> ddColumnVariableIndices;
     std::vector<uint_fast64_t> ddGroupVariableIndices;
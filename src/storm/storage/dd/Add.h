@@ -640,6 +640,23 @@ class Add : public Dd<LibraryType> {
                                                      std::set<storm::expressions::Variable> const& columnMetaVariables, storm::dd::Odd const& rowOdd,
                                                      storm::dd::Odd const& columnOdd) const;
 
+    /*!
+     * Converts the rows [firstRow, endRow) of the ADD to a (sparse) matrix, i.e., row i of the resulting matrix corresponds to row
+     * firstRow + i with respect to the given row ODD. The columns are not restricted. Only the parts of the ADD that encode the requested
+     * rows are traversed, so large matrices can be converted piece by piece.
+     *
+     * @param rowMetaVariables The meta variables that encode the rows of the matrix.
+     * @param columnMetaVariables The meta variables that encode the columns of the matrix.
+     * @param rowOdd The ODD used for determining the correct row.
+     * @param columnOdd The ODD used for determining the correct column.
+     * @param firstRow The first row to convert.
+     * @param endRow The first row after the rows to convert.
+     * @return The matrix that is represented by the given rows of this ADD.
+     */
+    storm::storage::SparseMatrix<ValueType> toMatrix(std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                     std::set<storm::expressions::Variable> const& columnMetaVariables, storm::dd::Odd const& rowOdd,
+                                                     storm::dd::Odd const& columnOdd, uint_fast64_t firstRow, uint_fast64_t endRow) const;
+
     /*!
      * Converts the ADD to a row-grouped (sparse) matrix. The given offset-labeled DDs are used to
      * determine the correct row and column, respectively, for each entry. Note: this function assumes that
@@ -0,0 +1,47 @@
+#include "storm/storage/dd/ExecutionScope.h"
+
+#include "storm/storage/dd/cudd/InternalCuddDdManager.h"
+#include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
+
+namespace storm {
+namespace dd {
+
+template<DdType LibraryType>
+ExecutionScope<LibraryType>::ExecutionScope() {
+    InternalDdManager<LibraryType>::enterExecutionScope();
+}
+
+template<DdType LibraryType>
+ExecutionScope<LibraryType>::ExecutionScope(ExecutionScope const&) {
+    InternalDdManager<LibraryType>::enterExecutionScope();
+}
+
+template<DdType LibraryType>
+ExecutionScope<LibraryType>& ExecutionScope<LibraryType>::operator=(ExecutionScope const&) {
+    // Both scopes already hold the workers.
+    return *this;
+}
+
+template<DdType LibraryType>
+ExecutionScope<LibraryType>::~ExecutionScope() {
+    InternalDdManager<LibraryType>::leaveExecutionScope();
+}
+
+template<DdType LibraryType>
+SuspensionScope<LibraryType>::SuspensionScope() : suspendedScopes(InternalDdManager<LibraryType>::suspendExecutionScopes()) {
+    // Intentionally left empty.
+}
+
+template<DdType LibraryType>
+SuspensionScope<LibraryType>::~SuspensionScope() {
+    InternalDdManager<LibraryType>::restoreExecutionScopes(suspendedScopes);
+}
+
+template class ExecutionScope<DdType::CUDD>;
+template class ExecutionScope<DdType::Sylvan>;
+
+template class SuspensionScope<DdType::CUDD>;
+template class SuspensionScope<DdType::Sylvan>;
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/storage/dd/DdType.h"
+
+namespace storm {
+namespace dd {
+
+/*!
+ * While an execution scope exists, the worker threads of the DD library (if it has any) are kept running on behalf of the current thread. Outside of
+ * execution scopes, the workers of Sylvan are suspended and every single DD operation wakes them up and suspends them again. Code that performs many
+ * DD operations in a row should therefore do so within an execution scope (or through DdManager::execute).
+ *
+ * Scopes may be nested and copied. Only the outermost scope of a thread wakes up the workers.
+ */
+template<DdType LibraryType>
+class ExecutionScope {
+   public:
+    ExecutionScope();
+    ExecutionScope(ExecutionScope const& other);
+    ExecutionScope& operator=(ExecutionScope const& other);
+    ~ExecutionScope();
+};
+
+/*!
+ * While a suspension scope exists, the execution scopes that the current thread has entered before are suspended, i.e., the worker threads of the DD
+ * library may go to sleep. This is meant for (potentially long-running) explicit computations that are embedded in DD code, e.g., solving the
+ * sparse equation systems of the hybrid engine. DD operations remain valid within a suspension scope, but are more expensive.
+ */
+template<DdType LibraryType>
+class SuspensionScope {
+   public:
+    SuspensionScope();
+    SuspensionScope(SuspensionScope const& other) = delete;
+    SuspensionScope& operator=(SuspensionScope const& other) = delete;
+    ~SuspensionScope();
+
+   private:
+    // The number of execution scopes that were suspended by this scope.
+    uint64_t suspendedScopes;
+};
+
+}  // namespace dd
+}  // namespace storm
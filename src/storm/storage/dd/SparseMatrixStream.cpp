@@ -0,0 +1,164 @@
+#include "storm/storage/dd/SparseMatrixStream.h"
+
+#include <algorithm>
+
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/ExecutionScope.h"
+
+#include "storm-config.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace dd {
+
+template<DdType LibraryType, typename ValueType>
+SparseMatrixStream<LibraryType, ValueType>::SparseMatrixStream(Add<LibraryType, ValueType> const& matrix,
+                                                               std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                               std::set<storm::expressions::Variable> const& columnMetaVariables, Odd const& rowOdd,
+                                                               Odd const& columnOdd, uint64_t maximalBlockEntries, uint64_t maximalCachedEntries)
+    : matrix(matrix),
+      rowMetaVariables(rowMetaVariables),
+      columnMetaVariables(columnMetaVariables),
+      rowOdd(rowOdd),
+      columnOdd(columnOdd),
+      entryCount(0),
+      numberOfBlockConversions(0) {
+    initializeBlocks(maximalBlockEntries, maximalCachedEntries);
+}
+
+template<DdType LibraryType, typename ValueType>
+void SparseMatrixStream<LibraryType, ValueType>::initializeBlocks(uint64_t maximalBlockEntries, uint64_t maximalCachedEntries) {
+    STORM_LOG_THROW(maximalBlockEntries > 0, storm::exceptions::InvalidArgumentException, "Blocks need to be able to hold at least one entry.");
+
+    // Count the number of entries in each row. This vector is only needed to determine the blocks.
+    std::vector<uint_fast64_t> rowEntryCounts;
+    {
+        ExecutionScope<LibraryType> executionScope;
+        rowEntryCounts = matrix.notZero().template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).toVector(rowOdd);
+    }
+
+    // Greedily split the rows into blocks.
+    uint64_t blockEntries = 0;
+    uint64_t cachedEntries = 0;
+    blockFirstRows.push_back(0);
+    for (uint64_t row = 0; row < rowEntryCounts.size(); ++row) {
+        if (row > blockFirstRows.back() && blockEntries + rowEntryCounts[row] > maximalBlockEntries) {
+            bool cacheBlock = cachedEntries + blockEntries <= maximalCachedEntries;
+            cachedEntries += cacheBlock ? blockEntries : 0;
+            blockIsCached.push_back(cacheBlock);
+            blockFirstRows.push_back(row);
+            blockEntries = 0;
+        }
+        blockEntries += rowEntryCounts[row];
+        entryCount += rowEntryCounts[row];
+    }
+    if (!rowEntryCounts.empty()) {
+        blockIsCached.push_back(cachedEntries + blockEntries <= maximalCachedEntries);
+        blockFirstRows.push_back(rowEntryCounts.size());
+    }
+    cachedBlocks.resize(blockIsCached.size());
+
+    STORM_LOG_DEBUG("Split matrix with " << entryCount << " entries into " << getNumberOfBlocks() << " blocks of which "
+                                         << std::count(blockIsCached.begin(), blockIsCached.end(), true) << " are cached.");
+}
+
+template<DdType LibraryType, typename ValueType>
+uint64_t SparseMatrixStream<LibraryType, ValueType>::getRowCount() const {
+    return rowOdd.getTotalOffset();
+}
+
+template<DdType LibraryType, typename ValueType>
+uint64_t SparseMatrixStream<LibraryType, ValueType>::getColumnCount() const {
+    return columnOdd.getTotalOffset();
+}
+
+template<DdType LibraryType, typename ValueType>
+uint64_t SparseMatrixStream<LibraryType, ValueType>::getEntryCount() const {
+    return entryCount;
+}
+
+template<DdType LibraryType, typename ValueType>
+uint64_t SparseMatrixStream<LibraryType, ValueType>::getNumberOfBlocks() const {
+    return blockIsCached.size();
+}
+
+template<DdType LibraryType, typename ValueType>
+uint64_t SparseMatrixStream<LibraryType, ValueType>::getBlockFirstRow(uint64_t block) const {
+    return blockFirstRows[block];
+}
+
+template<DdType LibraryType, typename ValueType>
+uint64_t SparseMatrixStream<LibraryType, ValueType>::getBlockEndRow(uint64_t block) const {
+    return blockFirstRows[block + 1];
+}
+
+template<DdType LibraryType, typename ValueType>
+uint64_t SparseMatrixStream<LibraryType, ValueType>::getNumberOfBlockConversions() const {
+    return numberOfBlockConversions;
+}
+
+template<DdType LibraryType, typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& SparseMatrixStream<LibraryType, ValueType>::getBlock(uint64_t block) {
+    STORM_LOG_ASSERT(block < getNumberOfBlocks(), "Illegal block index " << block << ".");
+    if (blockIsCached[block]) {
+        if (!cachedBlocks[block]) {
+            cachedBlocks[block] = matrix.toMatrix(rowMetaVariables, columnMetaVariables, rowOdd, columnOdd, getBlockFirstRow(block), getBlockEndRow(block));
+            ++numberOfBlockConversions;
+        }
+        return cachedBlocks[block].get();
+    }
+
+    if (!scratchBlockIndex || scratchBlockIndex.get() != block) {
+        // Release the memory of the previous block before converting the new one.
+        scratchBlock = storm::storage::SparseMatrix<ValueType>();
+        scratchBlock = matrix.toMatrix(rowMetaVariables, columnMetaVariables, rowOdd, columnOdd, getBlockFirstRow(block), getBlockEndRow(block));
+        scratchBlockIndex = block;
+        ++numberOfBlockConversions;
+    }
+    return scratchBlock;
+}
+
+template<DdType LibraryType, typename ValueType>
+void SparseMatrixStream<LibraryType, ValueType>::multiply(std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                          std::vector<ValueType>& result) {
+    STORM_LOG_ASSERT(&x != &result, "The input vector must not be the target vector.");
+    STORM_LOG_ASSERT(x.size() == getColumnCount(), "Input vector has wrong size.");
+    result.resize(getRowCount());
+
+    // Start with the block that was converted last, so it is not converted twice in a row.
+    uint64_t numberOfBlocks = getNumberOfBlocks();
+    uint64_t firstBlock = scratchBlockIndex ? scratchBlockIndex.get() : 0;
+    for (uint64_t blockOffset = 0; blockOffset < numberOfBlocks; ++blockOffset) {
+        uint64_t block = (firstBlock + blockOffset) % numberOfBlocks;
+        storm::storage::SparseMatrix<ValueType> const& explicitBlock = getBlock(block);
+        uint64_t row = getBlockFirstRow(block);
+        for (uint64_t localRow = 0; localRow < explicitBlock.getRowCount(); ++localRow, ++row) {
+            result[row] = explicitBlock.multiplyRowWithVector(localRow, x);
+            if (b) {
+                result[row] += (*b)[row];
+            }
+        }
+    }
+}
+
+template<DdType LibraryType, typename ValueType>
+void SparseMatrixStream<LibraryType, ValueType>::repeatedMultiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) {
+    std::vector<ValueType> result(getRowCount());
+    for (uint64_t i = 0; i < n; ++i) {
+        multiply(x, b, result);
+        std::swap(x, result);
+    }
+}
+
+template class SparseMatrixStream<DdType::CUDD, double>;
+template class SparseMatrixStream<DdType::Sylvan, double>;
+
+#ifdef STORM_HAVE_CARL
+template class SparseMatrixStream<DdType::Sylvan, storm::RationalNumber>;
+template class SparseMatrixStream<DdType::Sylvan, storm::RationalFunction>;
+#endif
+
+}  // namespace dd
+}  // namespace storm
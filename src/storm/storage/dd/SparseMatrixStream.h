@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Odd.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace dd {
+
+/*!
+ * Provides the explicit representation of a matrix that is given as an ADD without materializing it as a whole. The rows (in the order given
+ * by the row ODD) are split into consecutive blocks with a bounded number of entries each, which are converted to sparse matrices on demand.
+ * As many blocks as fit into the given cache limit are kept after their first conversion, all other blocks are converted again whenever they
+ * are needed. Hence, the number of explicitly stored entries is bounded by the cache limit plus the size of a single block.
+ *
+ * Note that a single row with more entries than the block limit forms a block on its own.
+ */
+template<DdType LibraryType, typename ValueType>
+class SparseMatrixStream {
+   public:
+    /*!
+     * Creates a stream for the given matrix.
+     *
+     * @param matrix The matrix that is to be converted.
+     * @param rowMetaVariables The meta variables that encode the rows of the matrix.
+     * @param columnMetaVariables The meta variables that encode the columns of the matrix.
+     * @param rowOdd The ODD used for determining the correct row.
+     * @param columnOdd The ODD used for determining the correct column.
+     * @param maximalBlockEntries The maximal number of entries per block.
+     * @param maximalCachedEntries The maximal number of entries of the blocks that are kept after their conversion.
+     */
+    SparseMatrixStream(Add<LibraryType, ValueType> const& matrix, std::set<storm::expressions::Variable> const& rowMetaVariables,
+                       std::set<storm::expressions::Variable> const& columnMetaVariables, Odd const& rowOdd, Odd const& columnOdd,
+                       uint64_t maximalBlockEntries, uint64_t maximalCachedEntries = 0);
+
+    uint64_t getRowCount() const;
+    uint64_t getColumnCount() const;
+    uint64_t getEntryCount() const;
+    uint64_t getNumberOfBlocks() const;
+
+    /*!
+     * Retrieves the first row of the given block.
+     */
+    uint64_t getBlockFirstRow(uint64_t block) const;
+
+    /*!
+     * Retrieves the first row after the rows of the given block.
+     */
+    uint64_t getBlockEndRow(uint64_t block) const;
+
+    /*!
+     * Retrieves how often a block was converted from the ADD so far.
+     */
+    uint64_t getNumberOfBlockConversions() const;
+
+    /*!
+     * Retrieves the explicit representation of the given block. Row i of the block is row getBlockFirstRow(block) + i of the matrix.
+     * The returned reference is only valid until the next block is requested.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getBlock(uint64_t block);
+
+    /*!
+     * Multiplies the matrix with the given vector (and adds the given summand), one block after another.
+     *
+     * @param x The input vector.
+     * @param b If non-null, this vector is added after the multiplication.
+     * @param result The target vector. Must not be the same as the input vector.
+     */
+    void multiply(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result);
+
+    /*!
+     * Performs n repeated matrix-vector multiplications x' = A*x + b.
+     *
+     * @param x The input vector. After the call, it contains the result.
+     * @param b If non-null, this vector is added after each multiplication.
+     * @param n The number of multiplications.
+     */
+    void repeatedMultiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n);
+
+   private:
+    void initializeBlocks(uint64_t maximalBlockEntries, uint64_t maximalCachedEntries);
+
+    Add<LibraryType, ValueType> matrix;
+    std::set<storm::expressions::Variable> rowMetaVariables;
+    std::set<storm::expressions::Variable> columnMetaVariables;
+    Odd rowOdd;
+    Odd columnOdd;
+
+    uint64_t entryCount;
+
+    // The first row of each block followed by the number of rows.
+    std::vector<uint64_t> blockFirstRows;
+
+    // The blocks that are cached (once converted). Blocks without cache slot are converted into the scratch block whenever they are needed.
+    std::vector<bool> blockIsCached;
+    std::vector<boost::optional<storm::storage::SparseMatrix<ValueType>>> cachedBlocks;
+    storm::storage::SparseMatrix<ValueType> scratchBlock;
+    boost::optional<uint64_t> scratchBlockIndex;
+
+    uint64_t numberOfBlockConversions;
+};
+
+}  // namespace dd
+}  // namespace storm
@@ -1,6 +1,7 @@
 #include "storm/storage/dd/bisimulation/InternalSylvanSignatureRefiner.h"
 
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ExecutionScope.h"
 
 #include "storm/storage/dd/sylvan/InternalSylvanBdd.h"
 
@@ -50,6 +51,8 @@ InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::InternalSignatur
 template<typename ValueType>
 Partition<storm::dd::DdType::Sylvan, ValueType> InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::refine(
     Partition<storm::dd::DdType::Sylvan, ValueType> const& oldPartition, Signature<storm::dd::DdType::Sylvan, ValueType> const& signature) {
+    // Keep the workers running for the refinement itself as well as the construction of the new partition.
+    storm::dd::ExecutionScope<storm::dd::DdType::Sylvan> executionScope;
     std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, boost::optional<storm::dd::Bdd<storm::dd::DdType::Sylvan>>> newPartitionDds =
         refine(oldPartition, signature.getSignatureAdd());
     ++numberOfRefinements;
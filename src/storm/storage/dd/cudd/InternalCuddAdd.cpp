@@ -731,7 +731,18 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_f
                                                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
     return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
                                  ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
-                                 writeValues);
+                                 writeValues, 0, rowOdd.getTotalOffset());
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
+                                                              std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
+                                                              Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                              std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues,
+                                                              uint_fast64_t firstRow, uint_fast64_t endRow) const {
+    return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
+                                 ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
+                                 writeValues, firstRow, endRow);
 }
 
 template<typename ValueType>
@@ -741,19 +752,25 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
                                                                  Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
                                                                  uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                                                  uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                 uint_fast64_t firstRow, uint_fast64_t endRow) const {
     // For the empty DD, we do not need to add any entries.
     if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
         return;
     }
 
+    // Skip all rows outside of the requested range.
+    if (currentRowOffset >= endRow || currentRowOffset + rowOdd.getTotalOffset() <= firstRow) {
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
         if (generateValues) {
-            columnsAndValues[rowIndications[rowGroupOffsets[currentRowOffset]]] =
+            columnsAndValues[rowIndications[rowGroupOffsets[currentRowOffset - firstRow]]] =
                 storm::storage::MatrixEntry<uint_fast64_t, ValueType>(currentColumnOffset, storm::utility::convertNumber<ValueType>(Cudd_V(dd)));
         }
-        ++rowIndications[rowGroupOffsets[currentRowOffset]];
+        ++rowIndications[rowGroupOffsets[currentRowOffset - firstRow]];
     } else {
         DdNode const* elseElse;
         DdNode const* elseThen;
@@ -786,19 +803,19 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
         // Visit else-else.
         toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+                              ddColumnVariableIndices, generateValues, firstRow, endRow);
         // Visit else-then.
         toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(),
-                              ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              ddRowVariableIndices, ddColumnVariableIndices, generateValues, firstRow, endRow);
         // Visit then-else.
         toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset,
-                              ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              ddRowVariableIndices, ddColumnVariableIndices, generateValues, firstRow, endRow);
         // Visit then-then.
         toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(),
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues, firstRow, endRow);
     }
 }
 
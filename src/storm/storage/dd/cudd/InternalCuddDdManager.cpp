@@ -205,6 +205,22 @@ void InternalDdManager<DdType::CUDD>::execute(std::function<void()> const& f) co
     f();
 }
 
+void InternalDdManager<DdType::CUDD>::enterExecutionScope() {
+    // Intentionally left empty.
+}
+
+void InternalDdManager<DdType::CUDD>::leaveExecutionScope() {
+    // Intentionally left empty.
+}
+
+uint64_t InternalDdManager<DdType::CUDD>::suspendExecutionScopes() {
+    return 0;
+}
+
+void InternalDdManager<DdType::CUDD>::restoreExecutionScopes(uint64_t) {
+    // Intentionally left empty.
+}
+
 cudd::Cudd& InternalDdManager<DdType::CUDD>::getCuddManager() {
     return cuddManager;
 }
@@ -141,6 +141,14 @@ class InternalDdManager<DdType::CUDD> {
      */
     void execute(std::function<void()> const& f) const;
 
+    /*!
+     * Enters and leaves execution scopes (see storm::dd::ExecutionScope). As CUDD runs in the calling thread, these are no-ops.
+     */
+    static void enterExecutionScope();
+    static void leaveExecutionScope();
+    static uint64_t suspendExecutionScopes();
+    static void restoreExecutionScopes(uint64_t suspendedScopes);
+
     /*!
      * Retrieves the number of DD variables managed by this manager.
      *
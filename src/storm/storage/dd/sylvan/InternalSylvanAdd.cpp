@@ -1235,7 +1235,18 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
     return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
                                  rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues, 0, rowOdd.getTotalOffset());
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
+                                                                std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
+                                                                Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues,
+                                                                uint_fast64_t firstRow, uint_fast64_t endRow) const {
+    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
+                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
+                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues, firstRow, endRow);
 }
 
 template<typename ValueType>
@@ -1245,19 +1256,25 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
                                                                    Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
                                                                    uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                                                    uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                   uint_fast64_t firstRow, uint_fast64_t endRow) const {
     // For the empty DD, we do not need to add any entries.
     if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
         return;
     }
 
+    // Skip all rows outside of the requested range.
+    if (currentRowOffset >= endRow || currentRowOffset + rowOdd.getTotalOffset() <= firstRow) {
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
         if (generateValues) {
-            columnsAndValues[rowIndications[rowGroupOffsets[currentRowOffset]]] =
+            columnsAndValues[rowIndications[rowGroupOffsets[currentRowOffset - firstRow]]] =
                 storm::storage::MatrixEntry<uint_fast64_t, ValueType>(currentColumnOffset, negated ? -getValue(dd) : getValue(dd));
         }
-        ++rowIndications[rowGroupOffsets[currentRowOffset]];
+        ++rowIndications[rowGroupOffsets[currentRowOffset - firstRow]];
     } else {
         MTBDD elseElse;
         MTBDD elseThen;
@@ -1290,20 +1307,21 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
         // Visit else-else.
         toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues, firstRow, endRow);
         // Visit else-then.
         toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues, firstRow, endRow);
         // Visit then-else.
         toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
-                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues,
+                              firstRow, endRow);
         // Visit then-then.
         toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
                               currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+                              ddColumnVariableIndices, generateValues, firstRow, endRow);
     }
 }
 
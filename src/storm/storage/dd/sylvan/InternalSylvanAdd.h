@@ -642,6 +642,27 @@ class InternalAdd<DdType::Sylvan, ValueType> {
                             std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
                             bool writeValues) const;
 
+    /*!
+     * Translates the rows [firstRow, endRow) of the ADD into the components needed for constructing a matrix. All other rows are skipped without
+     * traversing the corresponding parts of the DD. The row group indices are relative to the first row, i.e., entry i refers to row firstRow + i.
+     *
+     * @param rowGroupIndices The row group indices (relative to the first row).
+     * @param rowIndications The vector that is to be filled with the row indications.
+     * @param columnsAndValues The vector that is to be filled with the non-zero entries of the matrix.
+     * @param rowOdd The ODD used for translating the rows.
+     * @param columnOdd The ODD used for translating the columns.
+     * @param ddRowVariableIndices The variable indices of the row variables.
+     * @param ddColumnVariableIndices The variable indices of the column variables.
+     * @param writeValues A flag that indicates whether or not to write to the entry vector. If this is not set,
+     * only the row indications are modified.
+     * @param firstRow The first row (with respect to the row ODD) that is translated.
+     * @param endRow The first row (with respect to the row ODD) after the translated rows.
+     */
+    void toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
+                            std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
+                            std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                            bool writeValues, uint_fast64_t firstRow, uint_fast64_t endRow) const;
+
     /*!
      * Creates an ADD from the given explicit vector.
      *
@@ -806,12 +827,15 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param generateValues If set to true, the vector columnsAndValues is filled with the actual entries, which
      * only works if the offsets given in rowIndications are already correct. If they need to be computed first,
      * this flag needs to be false.
+     * @param firstRow The first row that is to be considered. Row group offsets are relative to this row.
+     * @param endRow The first row after the rows that are to be considered.
      */
     void toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications,
                                std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
                                uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues, uint_fast64_t firstRow,
+                               uint_fast64_t endRow) const;
 
     /*!
      * Retrieves the sylvan representation of the given double value.
@@ -48,7 +48,18 @@ VOID_TASK_2(execute_sylvan, std::function<void()> const*, f, std::exception_ptr*
 #endif
 
 uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
-bool InternalDdManager<DdType::Sylvan>::suspended = false;
+
+namespace {
+// The execution scopes entered by the current thread.
+struct ExecutionScopeState {
+    // The number of (nested) execution scopes.
+    uint64_t depth = 0;
+
+    // Whether the thread currently holds a request to keep the lace workers awake.
+    bool holdsWorkers = false;
+};
+thread_local ExecutionScopeState executionScopeState;
+}  // namespace
 
 // It is important that the variable pairs start at an even offset, because sylvan assumes this to be true for
 // some operations.
@@ -83,9 +94,11 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
         sylvan_gc_hook_pregc(TASK(gc_start));
         sylvan_gc_hook_postgc(TASK(gc_end));
 #endif
-        // TODO: uncomment these to disable lace threads whenever they are not used. This requires that *all* DD code is run through execute
-        // lace_suspend();
-        // suspended = true;
+        // Starting lace leaves the workers running. Unless requested otherwise, we suspend them right away, so they only run while DD operations
+        // are performed, i.e., during execution scopes, calls to execute or individual operations.
+        if (!settings.isKeepWorkersAwakeSet()) {
+            lace_suspend();
+        }
     }
     ++numberOfInstances;
 }
@@ -98,6 +111,8 @@ InternalDdManager<DdType::Sylvan>::~InternalDdManager() {
         //                sylvan_stats_report(filePointer, 0);
         //                fclose(filePointer);
 
+        // Quitting sylvan may run lace tasks, so the workers need to be awake.
+        lace_resume();
         sylvan::Sylvan::quitPackage();
         lace_stop();
     }
@@ -246,23 +261,53 @@ void InternalDdManager<DdType::Sylvan>::debugCheck() const {
 }
 
 void InternalDdManager<DdType::Sylvan>::execute(std::function<void()> const& f) const {
-    // Only wake up the sylvan (i.e. lace) threads when they are suspended.
+    // Running the task from outside of lace wakes up the workers (if necessary) and lets them sleep again afterwards.
     std::exception_ptr e = nullptr;  // propagate exception
-    if (suspended) {
-        lace_resume();
-        suspended = false;
-        RUN(execute_sylvan, &f, &e);
-        lace_suspend();
-        suspended = true;
-    } else {
-        // The sylvan threads are already running, don't suspend afterwards.
-        RUN(execute_sylvan, &f, &e);
-    }
+    RUN(execute_sylvan, &f, &e);
     if (e) {
         std::rethrow_exception(e);
     }
 }
 
+void InternalDdManager<DdType::Sylvan>::enterExecutionScope() {
+    // Within lace tasks, the workers are running anyway.
+    if (executionScopeState.depth++ == 0 && numberOfInstances > 0 && !lace_is_worker()) {
+        lace_resume();
+        executionScopeState.holdsWorkers = true;
+    }
+}
+
+void InternalDdManager<DdType::Sylvan>::leaveExecutionScope() {
+    STORM_LOG_ASSERT(executionScopeState.depth > 0, "Leaving execution scope that was not entered.");
+    if (--executionScopeState.depth == 0 && executionScopeState.holdsWorkers) {
+        executionScopeState.holdsWorkers = false;
+        if (numberOfInstances > 0) {
+            lace_suspend();
+        }
+    }
+}
+
+uint64_t InternalDdManager<DdType::Sylvan>::suspendExecutionScopes() {
+    uint64_t suspendedScopes = executionScopeState.depth;
+    if (executionScopeState.holdsWorkers) {
+        executionScopeState.holdsWorkers = false;
+        if (numberOfInstances > 0) {
+            lace_suspend();
+        }
+    }
+    executionScopeState.depth = 0;
+    return suspendedScopes;
+}
+
+void InternalDdManager<DdType::Sylvan>::restoreExecutionScopes(uint64_t suspendedScopes) {
+    STORM_LOG_ASSERT(executionScopeState.depth == 0, "Restoring execution scopes while other scopes are active.");
+    executionScopeState.depth = suspendedScopes;
+    if (suspendedScopes > 0 && numberOfInstances > 0 && !lace_is_worker()) {
+        lace_resume();
+        executionScopeState.holdsWorkers = true;
+    }
+}
+
 uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const {
     return nextFreeVariableIndex;
 }
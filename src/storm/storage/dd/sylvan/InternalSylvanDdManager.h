@@ -142,6 +142,29 @@ class InternalDdManager<DdType::Sylvan> {
      */
     void execute(std::function<void()> const& f) const;
 
+    /*!
+     * Enters an execution scope of the current thread (see storm::dd::ExecutionScope). When entering the outermost scope of a thread, the lace
+     * workers are woken up and they are kept running until the thread leaves this scope again.
+     */
+    static void enterExecutionScope();
+
+    /*!
+     * Leaves the innermost execution scope of the current thread.
+     */
+    static void leaveExecutionScope();
+
+    /*!
+     * Suspends all execution scopes of the current thread, so the lace workers may go to sleep until the scopes are restored.
+     *
+     * @return The number of suspended scopes that need to be passed to restoreExecutionScopes.
+     */
+    static uint64_t suspendExecutionScopes();
+
+    /*!
+     * Restores the given number of execution scopes of the current thread that were previously suspended.
+     */
+    static void restoreExecutionScopes(uint64_t suspendedScopes);
+
     /*!
      * Retrieves the number of DD variables managed by this manager.
      *
@@ -159,8 +182,8 @@ class InternalDdManager<DdType::Sylvan> {
     static uint_fast64_t numberOfInstances;
 
     // Since the sylvan (more specifically: lace) processes do busy waiting, we suspend them as long as
-    // sylvan is not used. This flag keeps track of whether we are currently suspending.
-    static bool suspended;
+    // sylvan is not used. Lace counts the requests to keep the workers awake, so every execution scope and every
+    // operation that is called from outside of lace holds one such request while it runs.
 
     // The index of the next free variable index. This needs to be shared across all instances since the sylvan
     // manager is implicitly 'global'.
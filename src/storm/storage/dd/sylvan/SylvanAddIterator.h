@@ -4,6 +4,7 @@
 #include <unordered_map>
 
 #include "storm/storage/dd/AddIterator.h"
+#include "storm/storage/dd/ExecutionScope.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 
 #include "storm/adapters/sylvan.h"
@@ -156,6 +157,9 @@ class AddIterator<DdType::Sylvan, ValueType> {
 
     // The current valuation of meta variables.
     storm::expressions::SimpleValuation currentValuation;
+
+    // Iterating typically interleaves with other DD operations, so we keep the sylvan workers running while the iterator exists.
+    ExecutionScope<DdType::Sylvan> executionScope;
 };
 }  // namespace dd
 }  // namespace storm
@@ -8,6 +8,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ExecutionScope.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/utility/macros.h"
 
@@ -40,6 +41,8 @@ struct LabelInformation {
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::translate(
     storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    // The whole translation consists of DD operations, so the workers of the DD library are kept awake until it is done.
+    storm::dd::ExecutionScope<Type> executionScope;
     this->odd = symbolicDtmc.getReachableStates().createOdd();
     storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicDtmc.getTransitionMatrix().toMatrix(this->odd, this->odd);
     std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
@@ -87,6 +90,7 @@ storm::dd::Odd const& SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::getO
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTransformer<Type, ValueType>::translate(
     storm::models::symbolic::Mdp<Type, ValueType> const& symbolicMdp, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    storm::dd::ExecutionScope<Type> executionScope;
     storm::dd::Odd odd = symbolicMdp.getReachableStates().createOdd();
 
     // Collect action reward vectors that need translation
@@ -152,6 +156,7 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmcTransformer<Type, ValueType>::translate(
     storm::models::symbolic::Ctmc<Type, ValueType> const& symbolicCtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    storm::dd::ExecutionScope<Type> executionScope;
     storm::dd::Odd odd = symbolicCtmc.getReachableStates().createOdd();
     storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicCtmc.getTransitionMatrix().toMatrix(odd, odd);
     std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
@@ -195,6 +200,7 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmc
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToSparseMaTransformer<Type, ValueType>::translate(
     storm::models::symbolic::MarkovAutomaton<Type, ValueType> const& symbolicMa, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    storm::dd::ExecutionScope<Type> executionScope;
     storm::dd::Odd odd = symbolicMa.getReachableStates().createOdd();
     // Collect action reward vectors that need translation
     std::vector<storm::dd::Add<Type, ValueType>> symbolicActionRewardVectors;
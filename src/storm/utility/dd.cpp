@@ -1,5 +1,9 @@
 #include "storm/utility/dd.h"
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -49,6 +53,116 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
     return {reachableStates, iteration};
 }
 
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStatesChaining(storm::dd::Bdd<Type> const& initialStates,
+                                                                         std::vector<storm::dd::Bdd<Type>> const& transitionPartitions,
+                                                                         std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                         std::set<storm::expressions::Variable> const& columnMetaVariables) {
+    storm::dd::Bdd<Type> reachableStates = initialStates;
+    storm::dd::Bdd<Type> frontier = initialStates;
+    uint64_t imageComputations = 0;
+    uint_fast64_t iteration = 0;
+    while (!frontier.isZero()) {
+        // States found by a partition are immediately passed on to the subsequent partitions of the same sweep. Since they are also part of the next
+        // frontier, the preceding partitions are applied to them in the next sweep.
+        storm::dd::Bdd<Type> sweepFrontier = frontier;
+        storm::dd::Bdd<Type> newStatesOfSweep = reachableStates.getDdManager().getBddZero();
+        for (auto const& partition : transitionPartitions) {
+            storm::dd::Bdd<Type> newStates = sweepFrontier.relationalProduct(partition, rowMetaVariables, columnMetaVariables) && !reachableStates;
+            ++imageComputations;
+            if (!newStates.isZero()) {
+                reachableStates |= newStates;
+                sweepFrontier |= newStates;
+                newStatesOfSweep |= newStates;
+            }
+        }
+        frontier = newStatesOfSweep;
+
+        ++iteration;
+        STORM_LOG_TRACE("Sweep " << iteration << " of chained reachability computation completed: " << reachableStates.getNonZeroCount()
+                                 << " reachable states found.");
+    }
+    return {reachableStates, imageComputations};
+}
+
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStatesSaturation(storm::dd::Bdd<Type> const& initialStates,
+                                                                           std::vector<storm::dd::Bdd<Type>> const& transitionPartitions,
+                                                                           std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                           std::set<storm::expressions::Variable> const& columnMetaVariables) {
+    // Order the partitions bottom-up with respect to the topmost variable their guard depends on. Partitions whose guard is constant only touch the
+    // states through their updates and are treated as the lowest ones.
+    std::vector<uint64_t> guardLevels;
+    guardLevels.reserve(transitionPartitions.size());
+    for (auto const& partition : transitionPartitions) {
+        storm::dd::Bdd<Type> guard = partition.existsAbstract(columnMetaVariables);
+        guardLevels.push_back(guard.isZero() || guard.isOne() ? std::numeric_limits<uint64_t>::max() : static_cast<uint64_t>(guard.getLevel()));
+    }
+    std::vector<uint64_t> order(transitionPartitions.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&guardLevels](uint64_t const& first, uint64_t const& second) {
+        return guardLevels[first] > guardLevels[second];
+    });
+
+    // For each partition, we store the states to which it has already been applied.
+    storm::dd::Bdd<Type> reachableStates = initialStates;
+    std::vector<storm::dd::Bdd<Type>> processedStates(transitionPartitions.size(), initialStates.getDdManager().getBddZero());
+    uint64_t imageComputations = 0;
+    uint64_t position = 0;
+    while (position < order.size()) {
+        uint64_t partitionIndex = order[position];
+        storm::dd::Bdd<Type> const& partition = transitionPartitions[partitionIndex];
+
+        // Saturate the current partition, i.e. apply it until no new states are found.
+        bool changed = false;
+        storm::dd::Bdd<Type> frontier = reachableStates && !processedStates[partitionIndex];
+        while (!frontier.isZero()) {
+            frontier = frontier.relationalProduct(partition, rowMetaVariables, columnMetaVariables) && !reachableStates;
+            ++imageComputations;
+            if (!frontier.isZero()) {
+                changed = true;
+                reachableStates |= frontier;
+            }
+        }
+        processedStates[partitionIndex] = reachableStates;
+
+        // If new states were found, the partitions below the current one need to be saturated again.
+        position = changed ? 0 : position + 1;
+    }
+    STORM_LOG_TRACE("Saturation-based reachability computation completed: " << reachableStates.getNonZeroCount() << " reachable states found.");
+    return {reachableStates, imageComputations};
+}
+
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates,
+                                                                 std::vector<storm::dd::Bdd<Type>> const& transitionPartitions,
+                                                                 std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                 std::set<storm::expressions::Variable> const& columnMetaVariables,
+                                                                 storm::builder::SymbolicReachabilityStrategy const& strategy) {
+    if (strategy == storm::builder::SymbolicReachabilityStrategy::Bfs || transitionPartitions.size() <= 1) {
+        storm::dd::Bdd<Type> transitions = initialStates.getDdManager().getBddZero();
+        for (auto const& partition : transitionPartitions) {
+            transitions |= partition;
+        }
+        return computeReachableStates(initialStates, transitions, rowMetaVariables, columnMetaVariables);
+    }
+
+    STORM_LOG_TRACE("Computing reachable states (" << strategy << ") using " << transitionPartitions.size() << " transition partitions and "
+                                                   << initialStates.getNonZeroCount() << " initial states.");
+    auto start = std::chrono::high_resolution_clock::now();
+    std::pair<storm::dd::Bdd<Type>, uint64_t> result;
+    if (strategy == storm::builder::SymbolicReachabilityStrategy::Chaining) {
+        result = computeReachableStatesChaining(initialStates, transitionPartitions, rowMetaVariables, columnMetaVariables);
+    } else {
+        STORM_LOG_ASSERT(strategy == storm::builder::SymbolicReachabilityStrategy::Saturation, "Unexpected reachability strategy.");
+        result = computeReachableStatesSaturation(initialStates, transitionPartitions, rowMetaVariables, columnMetaVariables);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Reachability computation completed after " << result.second << " image computations ("
+                                                                << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms).");
+    return result;
+}
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -102,6 +216,15 @@ template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeR
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& transitionPartitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    storm::builder::SymbolicReachabilityStrategy const& strategy);
+template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& transitionPartitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    storm::builder::SymbolicReachabilityStrategy const& strategy);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& constraintStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
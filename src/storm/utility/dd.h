@@ -4,6 +4,7 @@
 #include <set>
 #include <vector>
 
+#include "storm/builder/SymbolicReachabilityStrategy.h"
 #include "storm/storage/dd/DdType.h"
 
 namespace storm {
@@ -29,6 +30,23 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
                                                                  std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                  std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * Computes the states reachable from the initial states, where the transition relation is given as a disjunction of partitions (e.g. one per action).
+ * Applying the partitions separately avoids building the monolithic relation and typically keeps the intermediate BDDs small if the model consists of
+ * loosely coupled components.
+ *
+ * @param initialStates The initial states.
+ * @param transitionPartitions The partitions whose disjunction is the transition relation (over row and column variables).
+ * @param strategy The strategy that determines in which order the partitions are applied.
+ * @return The reachable states and the number of image computations that were performed.
+ */
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates,
+                                                                 std::vector<storm::dd::Bdd<Type>> const& transitionPartitions,
+                                                                 std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                 std::set<storm::expressions::Variable> const& columnMetaVariables,
+                                                                 storm::builder::SymbolicReachabilityStrategy const& strategy);
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
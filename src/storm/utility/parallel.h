@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "storm/utility/threads.h"
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+/*!
+ * Resolves the number of threads that are to be used for a parallel computation.
+ *
+ * @param requestedThreads The number of threads requested by the caller. Zero means that the number is detected automatically.
+ * @param numberOfTasks The number of tasks that are to be processed. No more threads than tasks are used.
+ * @return The number of threads to use (at least one).
+ */
+inline uint64_t resolveNumberOfThreads(uint64_t requestedThreads, uint64_t numberOfTasks) {
+    uint64_t result = requestedThreads == 0 ? static_cast<uint64_t>(storm::utility::getNumberOfThreads()) : requestedThreads;
+    return std::max<uint64_t>(1ull, std::min<uint64_t>(result, numberOfTasks));
+}
+
+/*!
+ * Invokes the given function for every task index in [0, numberOfTasks) using (at most) the given number of threads.
+ * The tasks are handed out dynamically, so the order in which they are processed is unspecified.
+ * The function is called as function(threadIndex, taskIndex), where threadIndex is in [0, number of used threads).
+ * If only a single thread is used, everything is executed by the calling thread.
+ * If an invocation throws, no further tasks are started and the first exception is rethrown once all threads are joined.
+ *
+ * @param numberOfTasks The number of tasks.
+ * @param numberOfThreads The number of threads to use. Zero means that the number is detected automatically.
+ * @param function The function that processes a single task.
+ */
+template<typename Function>
+void forEachTask(uint64_t numberOfTasks, uint64_t numberOfThreads, Function const& function) {
+    if (numberOfTasks == 0) {
+        return;
+    }
+    numberOfThreads = resolveNumberOfThreads(numberOfThreads, numberOfTasks);
+    if (numberOfThreads == 1) {
+        for (uint64_t task = 0; task < numberOfTasks; ++task) {
+            function(0ull, task);
+        }
+        return;
+    }
+
+    std::atomic<uint64_t> nextTask(0);
+    std::atomic<bool> aborted(false);
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    auto worker = [&](uint64_t threadIndex) {
+        try {
+            for (uint64_t task = nextTask.fetch_add(1, std::memory_order_relaxed); task < numberOfTasks && !aborted.load(std::memory_order_relaxed);
+                 task = nextTask.fetch_add(1, std::memory_order_relaxed)) {
+                function(threadIndex, task);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!firstException) {
+                firstException = std::current_exception();
+            }
+            aborted.store(true);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads - 1);
+    for (uint64_t threadIndex = 1; threadIndex < numberOfThreads; ++threadIndex) {
+        threads.emplace_back(worker, threadIndex);
+    }
+    // The calling thread participates as well.
+    worker(0ull);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
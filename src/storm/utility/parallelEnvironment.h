@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/environment/Environment.h"
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+/*!
+ * Creates one copy of the given environment for each thread of a parallel computation (see forEachTask).
+ * Environments must not be shared among threads: the sub-environments of an environment are only created when they are accessed for the first
+ * time, so even reading an environment may modify it. The copies have to be created before the threads are started.
+ *
+ * @param env The environment that is to be copied.
+ * @param numberOfThreads The number of threads.
+ * @return The copies of the environment. The thread with index i uses the copy with index i.
+ */
+inline std::vector<Environment> createThreadEnvironments(Environment const& env, uint64_t numberOfThreads) {
+    return std::vector<Environment>(numberOfThreads, env);
+}
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
@@ -1,6 +1,6 @@
+#include <algorithm>
 #include <ostream>
 #include <queue>
-#include <set>
 #include <string>
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -10,6 +10,7 @@
 #include "storm/storage/sparse/StateType.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/shortestPaths.h"
 
 // FIXME: I've accidentally used k=0 *twice* now without realizing that k>=1 is required!
@@ -76,38 +77,71 @@ template<typename T>
 BitVector ShortestPathsGenerator<T>::getStates(unsigned long k) {
     computeKSP(k);
     BitVector stateSet(numStates - 1, false);  // no meta-target
+    for (state_t state : traversePath(k)) {
+        stateSet.set(state, true);
+    }
+    return stateSet;
+}
 
-    Path<T> currentPath = kShortestPaths[metaTarget][k - 1];
-    boost::optional<state_t> maybePredecessor = currentPath.predecessorNode;
-    // this omits the first node, which is actually convenient since that's the meta-target
+template<typename T>
+std::vector<state_t> ShortestPathsGenerator<T>::getPathAsList(unsigned long k) {
+    computeKSP(k);
+    return traversePath(k);
+}
 
-    while (maybePredecessor) {
-        state_t predecessor = maybePredecessor.get();
-        stateSet.set(predecessor, true);
+template<typename T>
+bool ShortestPathsGenerator<T>::hasPath(unsigned long k) {
+    return tryComputeKSP(k);
+}
 
-        currentPath = kShortestPaths[predecessor][currentPath.predecessorK - 1];  // god damn you, index
-        maybePredecessor = currentPath.predecessorNode;
+template<typename T>
+unsigned long ShortestPathsGenerator<T>::computeUntilMass(T const& mass, bool allowEqual, unsigned long maxK) {
+    for (unsigned long k = 1; k <= maxK; ++k) {
+        if (!tryComputeKSP(k)) {
+            return k - 1;
+        }
+        T const& accumulatedDistance = accumulatedDistances[k - 1];
+        if (accumulatedDistance > mass || (allowEqual && accumulatedDistance >= mass)) {
+            return k;
+        }
     }
-
-    return stateSet;
+    return maxK;
 }
 
 template<typename T>
-std::vector<state_t> ShortestPathsGenerator<T>::getPathAsList(unsigned long k) {
+T ShortestPathsGenerator<T>::getAccumulatedDistance(unsigned long k) {
     computeKSP(k);
+    return accumulatedDistances[k - 1];
+}
+
+template<typename T>
+std::vector<OrderedStateList> ShortestPathsGenerator<T>::getPathsAsLists(unsigned long firstK, unsigned long lastK, uint64_t numberOfThreads) const {
+    if (firstK == 0) {
+        throw std::invalid_argument("Index 0 is invalid, since we use 1-based indices (sorry)!");
+    }
+    if (lastK > kShortestPaths[metaTarget].size()) {
+        throw std::invalid_argument("k-SP was not yet computed for k=" + std::to_string(lastK));
+    }
+    if (lastK < firstK) {
+        return {};
+    }
+
+    std::vector<OrderedStateList> paths(lastK - firstK + 1);
+    // the path tree is only read, so each path can be traversed independently
+    storm::utility::parallel::forEachTask(paths.size(), numberOfThreads, [&](uint64_t, uint64_t index) { paths[index] = traversePath(firstK + index); });
+    return paths;
+}
 
+template<typename T>
+OrderedStateList ShortestPathsGenerator<T>::traversePath(unsigned long k) const {
     std::vector<state_t> backToFrontList;
 
-    Path<T> currentPath = kShortestPaths[metaTarget][k - 1];
-    boost::optional<state_t> maybePredecessor = currentPath.predecessorNode;
+    Path<T> const* currentPath = &kShortestPaths[metaTarget][k - 1];
     // this omits the first node, which is actually convenient since that's the meta-target
-
-    while (maybePredecessor) {
-        state_t predecessor = maybePredecessor.get();
+    while (currentPath->hasPredecessor()) {
+        state_t predecessor = currentPath->predecessorNode;
         backToFrontList.push_back(predecessor);
-
-        currentPath = kShortestPaths[predecessor][currentPath.predecessorK - 1];
-        maybePredecessor = currentPath.predecessorNode;
+        currentPath = &kShortestPaths[predecessor][currentPath->predecessorK - 1];
     }
 
     return backToFrontList;
@@ -117,24 +151,36 @@ template<typename T>
 void ShortestPathsGenerator<T>::computePredecessors() {
     assert(transitionMatrix.hasTrivialRowGrouping());
 
-    // one more for meta-target
-    graphPredecessors.resize(numStates);
-
+    // to avoid non-minimal paths, the meta-target-predecessors are
+    // *not* predecessors of any state but the meta-target.
+    // The predecessors are stored compactly: first count them, then fill them in.
+    // one more for meta-target, one more for the end of the last range
+    predecessorOffsets.assign(numStates + 1, 0);
     for (state_t i = 0; i < numStates - 1; i++) {
-        for (auto const& transition : transitionMatrix.getRowGroup(i)) {
-            // to avoid non-minimal paths, the meta-target-predecessors are
-            // *not* predecessors of any state but the meta-target
-            if (!isMetaTargetPredecessor(i)) {
-                graphPredecessors[transition.getColumn()].push_back(i);
+        if (!isMetaTargetPredecessor(i)) {
+            for (auto const& transition : transitionMatrix.getRow(i)) {
+                ++predecessorOffsets[transition.getColumn() + 1];
             }
         }
     }
-
     // meta-target has exactly the meta-target-predecessors as predecessors
-    // (duh. note that the meta-target-predecessors used to be called target,
-    // but that's not necessarily true in the matrix/value invocation case)
-    for (auto targetProbPair : targetProbMap) {
-        graphPredecessors[metaTarget].push_back(targetProbPair.first);
+    predecessorOffsets[metaTarget + 1] = targetProbMap.size();
+    for (state_t i = 0; i < numStates; i++) {
+        predecessorOffsets[i + 1] += predecessorOffsets[i];
+    }
+
+    predecessorEdges.resize(predecessorOffsets.back());
+    std::vector<uint64_t> nextPosition(predecessorOffsets.begin(), predecessorOffsets.end() - 1);
+    for (state_t i = 0; i < numStates - 1; i++) {
+        if (!isMetaTargetPredecessor(i)) {
+            for (auto const& transition : transitionMatrix.getRow(i)) {
+                state_t otherNode = transition.getColumn();
+                predecessorEdges[nextPosition[otherNode]++] = std::make_pair(i, convertDistance(i, otherNode, transition.getValue()));
+            }
+        }
+    }
+    for (auto const& targetProbPair : targetProbMap) {
+        predecessorEdges[nextPosition[metaTarget]++] = targetProbPair;
     }
 }
 
@@ -146,11 +192,11 @@ void ShortestPathsGenerator<T>::performDijkstra() {
     T inftyDistance = zero<T>();
     T zeroDistance = one<T>();
     shortestPathDistances.resize(numStates, inftyDistance);
-    shortestPathPredecessors.resize(numStates, boost::optional<state_t>());
+    shortestPathPredecessors.resize(numStates, noPredecessor);
 
-    // set serves as priority queue with unique membership
+    // the queue may contain outdated entries for a node, they are skipped when popped.
     // default comparison on pair actually works fine if distance is the first entry
-    std::set<std::pair<T, state_t>, std::greater<std::pair<T, state_t>>> dijkstraQueue;
+    std::priority_queue<std::pair<T, state_t>> dijkstraQueue;
 
     for (state_t initialState : initialStates) {
         shortestPathDistances[initialState] = zeroDistance;
@@ -158,12 +204,16 @@ void ShortestPathsGenerator<T>::performDijkstra() {
     }
 
     while (!dijkstraQueue.empty()) {
-        state_t currentNode = (*dijkstraQueue.begin()).second;
-        dijkstraQueue.erase(dijkstraQueue.begin());
+        auto [currentDistance, currentNode] = dijkstraQueue.top();
+        dijkstraQueue.pop();
+        if (currentDistance < shortestPathDistances[currentNode]) {
+            // outdated entry
+            continue;
+        }
 
         if (!isMetaTargetPredecessor(currentNode)) {
             // non-target node, treated normally
-            for (auto const& transition : transitionMatrix.getRowGroup(currentNode)) {
+            for (auto const& transition : transitionMatrix.getRow(currentNode)) {
                 state_t otherNode = transition.getColumn();
 
                 // note that distances are probabilities, thus they are multiplied and larger is better
@@ -171,7 +221,7 @@ void ShortestPathsGenerator<T>::performDijkstra() {
                 assert((zero<T>() <= alternateDistance) && (alternateDistance <= one<T>()));
                 if (alternateDistance > shortestPathDistances[otherNode]) {
                     shortestPathDistances[otherNode] = alternateDistance;
-                    shortestPathPredecessors[otherNode] = boost::optional<state_t>(currentNode);
+                    shortestPathPredecessors[otherNode] = currentNode;
                     dijkstraQueue.emplace(alternateDistance, otherNode);
                 }
             }
@@ -180,7 +230,7 @@ void ShortestPathsGenerator<T>::performDijkstra() {
             T alternateDistance = shortestPathDistances[currentNode] * targetProbMap[currentNode];
             if (alternateDistance > shortestPathDistances[metaTarget]) {
                 shortestPathDistances[metaTarget] = alternateDistance;
-                shortestPathPredecessors[metaTarget] = boost::optional<state_t>(currentNode);
+                shortestPathPredecessors[metaTarget] = currentNode;
             }
             // no need to enqueue meta-target
         }
@@ -192,9 +242,8 @@ void ShortestPathsGenerator<T>::computeSPSuccessors() {
     shortestPathSuccessors.resize(numStates);
 
     for (state_t i = 0; i < numStates; i++) {
-        if (shortestPathPredecessors[i]) {
-            state_t predecessor = shortestPathPredecessors[i].get();
-            shortestPathSuccessors[predecessor].push_back(i);
+        if (shortestPathPredecessors[i] != noPredecessor) {
+            shortestPathSuccessors[shortestPathPredecessors[i]].push_back(i);
         }
     }
 }
@@ -221,9 +270,8 @@ void ShortestPathsGenerator<T>::initializeShortestPaths() {
             bfsQueue.push(successorNode);
         }
 
-        // note that `shortestPathPredecessor` may not be present
+        // note that `shortestPathPredecessor` is `noPredecessor`
         // if current node is an initial state
-        // in this case, the boost::optional copy of an uninitialized optional is hopefully also uninitialized
         kShortestPaths[currentNode].push_back(Path<T>{shortestPathPredecessors[currentNode], 1, shortestPathDistances[currentNode]});
     }
 }
@@ -233,11 +281,11 @@ T ShortestPathsGenerator<T>::getEdgeDistance(state_t tailNode, state_t headNode)
     // just to be clear, head is where the arrow points (obviously)
     if (headNode != metaTarget) {
         // edge is "normal", not to meta-target
-
-        for (auto const& transition : transitionMatrix.getRowGroup(tailNode)) {
-            if (transition.getColumn() == headNode) {
-                return convertDistance(tailNode, headNode, transition.getValue());
-            }
+        // the entries of a row are sorted by column
+        auto row = transitionMatrix.getRow(tailNode);
+        auto it = std::lower_bound(row.begin(), row.end(), headNode, [](auto const& entry, state_t column) { return entry.getColumn() < column; });
+        if (it != row.end() && it->getColumn() == headNode) {
+            return convertDistance(tailNode, headNode, it->getValue());
         }
 
         // there is no such edge
@@ -251,93 +299,124 @@ T ShortestPathsGenerator<T>::getEdgeDistance(state_t tailNode, state_t headNode)
 }
 
 template<typename T>
-void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
-    assert(k >= 2);                                // Dijkstra is used for k=1
-    assert(kShortestPaths[node].size() == k - 1);  // if not, the previous SP must not exist
-
-    // TODO: I could extract the candidate generation to make this function more succinct
-    if (k == 2) {
-        // Step B.1 in J&M paper
-
-        Path<T> shortestPathToNode = kShortestPaths[node][1 - 1];  // never forget index shift :-|
-
-        for (state_t predecessor : graphPredecessors[node]) {
-            // add shortest paths to predecessors plus edge to current node
-            Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), 1,
-                                                 shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
-
-            // ... but not the actual shortest path
-            auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
-            if (it != candidatePaths[node].end()) {
-                candidatePaths[node].erase(it);
-            }
+void ShortestPathsGenerator<T>::initializeCandidates(state_t node) {
+    // Step B.1 in J&M paper
+    Path<T> const& shortestPathToNode = kShortestPaths[node][1 - 1];  // never forget index shift :-|
+    auto& candidates = candidatePaths[node];
+
+    for (uint64_t position = predecessorOffsets[node]; position < predecessorOffsets[node + 1]; ++position) {
+        auto const& [predecessor, edgeDistance] = predecessorEdges[position];
+        // add shortest paths to predecessors plus edge to current node
+        // ... but not the actual shortest path, and no paths via unreachable predecessors
+        if ((predecessor == shortestPathToNode.predecessorNode && shortestPathToNode.predecessorK == 1) || kShortestPaths[predecessor].empty()) {
+            continue;
         }
+        candidates.push_back(Path<T>{predecessor, 1, shortestPathDistances[predecessor] * edgeDistance});
+        std::push_heap(candidates.begin(), candidates.end(), CandidateOrder());
     }
+}
 
-    if (not(k == 2 && isInitialState(node))) {
+template<typename T>
+void ShortestPathsGenerator<T>::selectNextPath(state_t node, unsigned long k) {
+    auto& candidates = candidatePaths[node];
+
+    if (!(k == 2 && isInitialState(node))) {
         // Steps B.2-5 in J&M paper
 
         // the (k-1)th shortest path (i.e., one better than the one we want to compute)
-        Path<T> previousShortestPath = kShortestPaths[node][k - 1 - 1];  // oh god, I forgot index shift AGAIN
+        Path<T> const& previousShortestPath = kShortestPaths[node][k - 1 - 1];  // oh god, I forgot index shift AGAIN
 
         // the predecessor node on that path
-        state_t predecessor = previousShortestPath.predecessorNode.get();
+        state_t predecessor = previousShortestPath.predecessorNode;
         // the path to that predecessor was the `tailK`-shortest
         unsigned long tailK = previousShortestPath.predecessorK;
 
         // i.e. source ~~tailK-shortest path~~> predecessor --> node
-
-        // compute one-worse-shortest path to the predecessor (if it hasn't yet been computed)
-        if (kShortestPaths[predecessor].size() < tailK + 1) {
-            // TODO: investigate recursion depth and possible iterative alternative
-            computeNextPath(predecessor, tailK + 1);
-        }
-
         if (kShortestPaths[predecessor].size() >= tailK + 1) {
             // take that path, add an edge to the current node; that's a candidate
-            Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), tailK + 1,
-                                                 kShortestPaths[predecessor][tailK + 1 - 1].distance * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
+            candidates.push_back(
+                Path<T>{predecessor, tailK + 1, kShortestPaths[predecessor][tailK + 1 - 1].distance * getEdgeDistance(predecessor, node)});
+            std::push_heap(candidates.begin(), candidates.end(), CandidateOrder());
         }
-        // else there was no path; TODO: does this need handling? -- yes, but not here (because the step B.1 may have added candidates)
+        // else there was no path; the candidates added in step B.1 may still be available
     }
 
     // Step B.6 in J&M paper
-    if (!candidatePaths[node].empty()) {
-        Path<T> minDistanceCandidate = *(candidatePaths[node].begin());
-        for (auto path : candidatePaths[node]) {
-            if (path.distance > minDistanceCandidate.distance) {
-                minDistanceCandidate = path;
+    if (!candidates.empty()) {
+        std::pop_heap(candidates.begin(), candidates.end(), CandidateOrder());
+        kShortestPaths[node].push_back(candidates.back());
+        candidates.pop_back();
+    } else {
+        // kSP does not exist, this is detected by the caller
+        STORM_LOG_TRACE("KSP: no candidates for node " << node << " and k=" << k << ".");
+    }
+}
+
+template<typename T>
+void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
+    assert(k >= 2);                                // Dijkstra is used for k=1
+    assert(kShortestPaths[node].size() == k - 1);  // if not, the previous SP must not exist
+
+    // The k-th path to a node requires the (tailK+1)-th path to the predecessor on its (k-1)-th path,
+    // which in turn may require further paths. Instead of recursing, we first collect the chain of
+    // required (node, k) pairs and then complete them in reverse order.
+    std::vector<std::pair<state_t, unsigned long>> stack;
+    while (true) {
+        stack.emplace_back(node, k);
+        if (k == 2) {
+            initializeCandidates(node);
+            if (isInitialState(node)) {
+                break;
             }
         }
 
-        candidatePaths[node].erase(std::find(candidatePaths[node].begin(), candidatePaths[node].end(), minDistanceCandidate));
-        kShortestPaths[node].push_back(minDistanceCandidate);
-    } else {
-        // TODO: kSP does not exist. this is handled later, but it would be nice to catch it as early as possble, wouldn't it?
-        STORM_LOG_TRACE("KSP: no candidates, this will trigger nonexisting ksp after exiting these recursions. TODO: handle here");
+        Path<T> const& previousShortestPath = kShortestPaths[node][k - 1 - 1];
+        state_t predecessor = previousShortestPath.predecessorNode;
+        unsigned long tailK = previousShortestPath.predecessorK;
+        if (kShortestPaths[predecessor].size() >= tailK + 1) {
+            break;
+        }
+        // compute one-worse-shortest path to the predecessor first
+        node = predecessor;
+        k = tailK + 1;
+    }
+
+    while (!stack.empty()) {
+        auto [currentNode, currentK] = stack.back();
+        stack.pop_back();
+        selectNextPath(currentNode, currentK);
     }
 }
 
 template<typename T>
-void ShortestPathsGenerator<T>::computeKSP(unsigned long k) {
+bool ShortestPathsGenerator<T>::tryComputeKSP(unsigned long k) {
     if (k == 0) {
         throw std::invalid_argument("Index 0 is invalid, since we use 1-based indices (sorry)!");
     }
 
-    unsigned long alreadyComputedK = kShortestPaths[metaTarget].size();
-
-    for (unsigned long nextK = alreadyComputedK + 1; nextK <= k; nextK++) {
-        computeNextPath(metaTarget, nextK);
+    for (unsigned long nextK = kShortestPaths[metaTarget].size() + 1; nextK <= k; nextK++) {
+        if (nextK > 1) {
+            computeNextPath(metaTarget, nextK);
+        }
         if (kShortestPaths[metaTarget].size() < nextK) {
-            unsigned long lastExistingK = nextK - 1;
-            STORM_LOG_DEBUG("KSP throws (as expected) due to nonexistence -- maybe this is unhandled and causes the Python interface to segfault?");
-            STORM_LOG_DEBUG("last existing k-SP has k=" + std::to_string(lastExistingK));
-            STORM_LOG_DEBUG("maybe this is unhandled and causes the Python interface to segfault?");
-            throw std::invalid_argument("k-SP does not exist for k=" + std::to_string(k));
+            STORM_LOG_DEBUG("last existing k-SP has k=" << nextK - 1);
+            return false;
         }
     }
+
+    // update accumulated distances of the new paths
+    for (unsigned long nextK = accumulatedDistances.size() + 1; nextK <= kShortestPaths[metaTarget].size(); nextK++) {
+        T const& distance = kShortestPaths[metaTarget][nextK - 1].distance;
+        accumulatedDistances.push_back(accumulatedDistances.empty() ? distance : accumulatedDistances.back() + distance);
+    }
+    return true;
+}
+
+template<typename T>
+void ShortestPathsGenerator<T>::computeKSP(unsigned long k) {
+    if (!tryComputeKSP(k)) {
+        throw std::invalid_argument("k-SP does not exist for k=" + std::to_string(k));
+    }
 }
 
 template<typename T>
@@ -355,8 +434,8 @@ void ShortestPathsGenerator<T>::printKShortestPath(state_t targetNode, unsigned
 
     std::cout << " " << targetNode;
 
-    if (p.predecessorNode) {
-        printKShortestPath(p.predecessorNode.get(), p.predecessorK, false);
+    if (p.hasPredecessor()) {
+        printKShortestPath(p.predecessorNode, p.predecessorK, false);
     } else {
         std::cout << " ]\n";
     }
@@ -369,7 +448,7 @@ template class ShortestPathsGenerator<storm::RationalNumber>;
 // does not traverse the actual path (see printKShortestPath for that)
 template<typename T>
 std::ostream& operator<<(std::ostream& out, Path<T> const& p) {
-    out << "Path with predecessorNode: " << ((p.predecessorNode) ? std::to_string(p.predecessorNode.get()) : "None");
+    out << "Path with predecessorNode: " << (p.hasPredecessor() ? std::to_string(p.predecessorNode) : "None");
     out << " predecessorK: " << p.predecessorK << " distance: " << p.distance;
     return out;
 }
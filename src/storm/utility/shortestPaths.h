@@ -1,7 +1,8 @@
 #ifndef STORM_UTIL_SHORTESTPATHS_H_
 #define STORM_UTIL_SHORTESTPATHS_H_
 
-#include <boost/optional/optional.hpp>
+#include <limits>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -36,13 +37,22 @@ using BitVector = storage::BitVector;
 
 // -- helper structs/classes -----------------------------------------------------------------------------
 
+// marks paths without predecessor, i.e., paths consisting only of an initial state
+constexpr state_t noPredecessor = std::numeric_limits<state_t>::max();
+
+// A node of the path tree: the path is given implicitly by the predecessorK-shortest path
+// to predecessorNode followed by the edge to the node the path belongs to.
 template<typename T>
 struct Path {
-    boost::optional<state_t> predecessorNode;
+    state_t predecessorNode;
     unsigned long predecessorK;
     T distance;
 
-    // arbitrary order for std::set
+    bool hasPredecessor() const {
+        return predecessorNode != noPredecessor;
+    }
+
+    // arbitrary (but fixed) order used to break ties between candidates
     bool operator<(const Path<T>& rhs) const {
         if (predecessorNode != rhs.predecessorNode) {
             return predecessorNode < rhs.predecessorNode;
@@ -115,6 +125,35 @@ class ShortestPathsGenerator {
      */
     OrderedStateList getPathAsList(unsigned long k);
 
+    /*!
+     * Returns whether a k-shortest path exists.
+     * Computes KSP if not yet computed.
+     */
+    bool hasPath(unsigned long k);
+
+    /*!
+     * Computes the shortest paths in order of decreasing distance until the accumulated distance (i.e., probability mass)
+     * of the 1st to k-th shortest path exceeds the given mass (or reaches it if `allowEqual` is set).
+     * Already computed paths are reused, so the enumeration can be continued by further calls with larger masses.
+     * @return The smallest such k. If the mass can not be reached with at most `maxK` paths, the number of existing paths (at most `maxK`).
+     */
+    unsigned long computeUntilMass(T const& mass, bool allowEqual, unsigned long maxK);
+
+    /*!
+     * Returns the accumulated distance (i.e., probability mass) of the 1st to k-th shortest path.
+     * Computes KSP if not yet computed.
+     * @throws std::invalid_argument if no such k-shortest path exists
+     */
+    T getAccumulatedDistance(unsigned long k);
+
+    /*!
+     * Returns the states of the firstK-th to lastK-th shortest paths as back-to-front traversals.
+     * The paths must have been computed before (see `computeUntilMass`).
+     * As the path tree is not modified, the traversals are done concurrently using the given number of threads (0 means one thread per core).
+     * @throws std::invalid_argument if the paths were not yet computed
+     */
+    std::vector<OrderedStateList> getPathsAsLists(unsigned long firstK, unsigned long lastK, uint64_t numberOfThreads = 1) const;
+
    private:
     Matrix const& transitionMatrix;
     state_t numStates;  // includes meta-target, i.e. states in model + 1
@@ -124,19 +163,38 @@ class ShortestPathsGenerator {
 
     MatrixFormat matrixFormat;
 
-    std::vector<OrderedStateList> graphPredecessors;
-    std::vector<boost::optional<state_t>> shortestPathPredecessors;
+    // predecessors of node i (together with the edge distance) are stored in
+    // predecessorEdges[predecessorOffsets[i]] to predecessorEdges[predecessorOffsets[i+1]-1]
+    std::vector<uint64_t> predecessorOffsets;
+    std::vector<std::pair<state_t, T>> predecessorEdges;
+    std::vector<state_t> shortestPathPredecessors;
     std::vector<OrderedStateList> shortestPathSuccessors;
     std::vector<T> shortestPathDistances;
 
     std::vector<std::vector<Path<T>>> kShortestPaths;
-    std::vector<std::set<Path<T>>> candidatePaths;
+    // candidates for the next shortest path of each node, organized as binary heaps (see `CandidateOrder`)
+    std::vector<std::vector<Path<T>>> candidatePaths;
+    // accumulatedDistances[k-1] is the sum of the distances of the 1st to k-th shortest path to the meta-target
+    std::vector<T> accumulatedDistances;
+
+    /*!
+     * Heap order of candidates: the candidate with the largest distance is on top.
+     * Ties are broken by the order on `Path`.
+     */
+    struct CandidateOrder {
+        bool operator()(Path<T> const& lhs, Path<T> const& rhs) const {
+            if (lhs.distance != rhs.distance) {
+                return lhs.distance < rhs.distance;
+            }
+            return rhs < lhs;
+        }
+    };
 
     /*!
      * Computes list of predecessors for all nodes.
      * Reachability is not considered; a predecessor is simply any node that has an edge leading to the node in question.
      * Requires `transitionMatrix`.
-     * Modifies `graphPredecessors`.
+     * Modifies `predecessorOffsets` and `predecessorEdges`.
      */
     void computePredecessors();
 
@@ -162,16 +220,39 @@ class ShortestPathsGenerator {
     void initializeShortestPaths();
 
     /*!
-     * Main step of REA algorithm. TODO: Document further.
+     * Main step of REA algorithm: computes the k-th shortest path to the given node, assuming that the (k-1) shortest paths are known.
+     * The recursive computation of the required paths to predecessors is done iteratively using an explicit stack.
      */
     void computeNextPath(state_t node, unsigned long k);
 
+    /*!
+     * Adds the candidates of a node for its 2nd shortest path (Step B.1 in J&M paper).
+     */
+    void initializeCandidates(state_t node);
+
+    /*!
+     * Completes the computation of the k-th shortest path to the given node
+     * once the required path to the predecessor is known (Steps B.2-6 in J&M paper).
+     */
+    void selectNextPath(state_t node, unsigned long k);
+
+    /*!
+     * Computes k-shortest path if not yet computed.
+     * @return false iff no such k-shortest path exists
+     */
+    bool tryComputeKSP(unsigned long k);
+
     /*!
      * Computes k-shortest path if not yet computed.
      * @throws std::invalid_argument if no such k-shortest path exists
      */
     void computeKSP(unsigned long k);
 
+    /*!
+     * Returns the states of the (already computed) KSP as back-to-front traversal.
+     */
+    OrderedStateList traversePath(unsigned long k) const;
+
     /*!
      * Recurses over the path and prints the nodes. Intended for debugging.
      */
@@ -185,7 +266,7 @@ class ShortestPathsGenerator {
     // --- tiny helper fcts ---
 
     inline bool isInitialState(state_t node) const {
-        return std::find(initialStates.begin(), initialStates.end(), node) != initialStates.end();
+        return node < initialStates.size() && initialStates.get(node);
     }
 
     inline bool isMetaTargetPredecessor(state_t node) const {
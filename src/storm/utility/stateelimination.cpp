@@ -41,6 +41,7 @@ bool eliminationOrderNeedsReversedDistances(storm::settings::modules::Eliminatio
 bool eliminationOrderIsPenaltyBased(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
     return order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty ||
            order == storm::settings::modules::EliminationSettings::EliminationOrder::DynamicPenalty ||
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::DynamicCost ||
            order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression;
 }
 
@@ -93,6 +94,46 @@ uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& stat
     return penalty;
 }
 
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyCost(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                      storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                      std::vector<ValueType> const& oneStepProbabilities) {
+    uint_fast64_t penalty = 0;
+    bool hasParametricSelfLoop = false;
+
+    auto const& successors = transitionMatrix.getRow(state);
+    for (auto const& predecessor : backwardTransitions.getRow(state)) {
+        if (predecessor.getColumn() == state) {
+            hasParametricSelfLoop = !storm::utility::isConstant(predecessor.getValue());
+            continue;
+        }
+        uint_fast64_t predecessorComplexity = estimateComplexity(predecessor.getValue());
+
+        // Both rows are sorted by column, so we can detect the successors that the predecessor is not yet connected to in a single pass.
+        auto const& successorsOfPredecessor = transitionMatrix.getRow(predecessor.getColumn());
+        auto successorsOfPredecessorIt = successorsOfPredecessor.begin();
+        for (auto const& successor : successors) {
+            if (successor.getColumn() == state) {
+                continue;
+            }
+            while (successorsOfPredecessorIt != successorsOfPredecessor.end() && successorsOfPredecessorIt->getColumn() < successor.getColumn()) {
+                ++successorsOfPredecessorIt;
+            }
+            bool isFillIn = successorsOfPredecessorIt == successorsOfPredecessor.end() || successorsOfPredecessorIt->getColumn() != successor.getColumn();
+            uint_fast64_t productComplexity = predecessorComplexity + estimateComplexity(successor.getValue());
+            penalty += isFillIn ? 2 * productComplexity : productComplexity;
+        }
+        penalty += estimateComplexity(oneStepProbabilities[predecessor.getColumn()]) + predecessorComplexity + estimateComplexity(oneStepProbabilities[state]);
+    }
+
+    // If it is a self-loop that is parametric, all outgoing values need to be scaled with a rational function.
+    if (hasParametricSelfLoop) {
+        penalty *= 10;
+    }
+
+    return penalty;
+}
+
 template<typename ValueType>
 uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state,
                                                    storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -129,9 +170,12 @@ std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std
             return std::make_unique<StaticStatePriorityQueue>(sortedStates);
         } else if (eliminationOrderIsPenaltyBased(order)) {
             std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties(sortedStates.size());
-            typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction =
-                order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ? computeStatePenaltyRegularExpression<ValueType>
-                                                                                                            : computeStatePenalty<ValueType>;
+            typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction = computeStatePenalty<ValueType>;
+            if (order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression) {
+                penaltyFunction = computeStatePenaltyRegularExpression<ValueType>;
+            } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::DynamicCost) {
+                penaltyFunction = computeStatePenaltyCost<ValueType>;
+            }
             for (uint_fast64_t index = 0; index < sortedStates.size(); ++index) {
                 statePenalties[index] =
                     std::make_pair(sortedStates[index], penaltyFunction(sortedStates[index], transitionMatrix, backwardTransitions, oneStepProbabilities));
@@ -237,6 +281,10 @@ template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type co
                                            storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                            storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
                                            std::vector<double> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyCost(storm::storage::sparse::state_type const& state,
+                                               storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
+                                               storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
+                                               std::vector<double> const& oneStepProbabilities);
 template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state,
                                                             storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
@@ -261,6 +309,10 @@ template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type co
                                            storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                            storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                            std::vector<storm::RationalNumber> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyCost(storm::storage::sparse::state_type const& state,
+                                               storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                               storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                               std::vector<storm::RationalNumber> const& oneStepProbabilities);
 template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -283,6 +335,10 @@ template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type co
                                            storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                            storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                            std::vector<storm::RationalFunction> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyCost(storm::storage::sparse::state_type const& state,
+                                               storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                               storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                               std::vector<storm::RationalFunction> const& oneStepProbabilities);
 template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
@@ -58,6 +58,16 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
                                                    storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
                                                    std::vector<ValueType> const& oneStepProbabilities);
 
+/*!
+ * Estimates the cost of eliminating the given state. For every pair of predecessor and successor, the complexity of the resulting product is
+ * estimated by the sum of the complexities of the two factors (which behaves like the degree of a polynomial product). The estimate is counted
+ * twice if the pair is not yet connected, i.e., if the elimination creates a new entry (fill-in) that is subject to further operations.
+ */
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyCost(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                      storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                      std::vector<ValueType> const& oneStepProbabilities);
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -3,7 +3,11 @@
 
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/utility/SymmetryFinder.h"
 #include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 namespace {
 
@@ -87,4 +91,61 @@ TEST(DftModelBuildingTest, RelevantEvents) {
     EXPECT_EQ(13ul, model->getNumberOfTransitions());
 }
 
+TEST(DftModelBuildingTest, ConcurrentExploration) {
+    std::string file = STORM_TEST_RESOURCES_DIR "/dft/hecs_3_2_2_np.dft";
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(file);
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+    dft->setRelevantEvents(storm::dft::utility::RelevantEvents{}, false);
+    storm::dft::storage::DftSymmetries symmetries = storm::dft::utility::SymmetryFinder<double>::findSymmetries(*dft);
+    std::string property = "P=? [F<=100 \"failed\"]";
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::extractFormulasFromProperties(storm::api::parseProperties(property)).front();
+    auto checkModel = [&formula](std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        std::unique_ptr<storm::modelchecker::CheckResult> result =
+            storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+        result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+        return result->asExplicitQuantitativeCheckResult<double>().getValueMap().begin()->second;
+    };
+
+    // Build model sequentially
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+    builder.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+    double result = checkModel(model);
+
+    // Build model concurrently
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builder2(*dft, symmetries);
+    builder2.setNumberOfThreads(4);
+    builder2.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<double>> model2 = builder2.getModel();
+    EXPECT_EQ(model->getType(), model2->getType());
+    EXPECT_EQ(model->getNumberOfStates(), model2->getNumberOfStates());
+    EXPECT_EQ(model->getNumberOfTransitions(), model2->getNumberOfTransitions());
+    EXPECT_EQ(model->getNumberOfChoices(), model2->getNumberOfChoices());
+    EXPECT_NEAR(result, checkModel(model2), 1e-8);
+
+    // Refine approximation concurrently
+    // The order in which states of a batch are explored may differ from the sequential exploration, so only the bounds are compared
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builder3(*dft, symmetries);
+    builder3.setNumberOfThreads(4);
+    double previousLowerBound = 0.0;
+    double previousUpperBound = 1.0;
+    for (size_t iteration = 0; iteration < 3; ++iteration) {
+        builder3.buildModel(iteration, 0.1, storm::dft::builder::ApproximationHeuristic::DEPTH);
+        std::shared_ptr<storm::models::sparse::Model<double>> lowerModel = builder3.getModelApproximation(true, false);
+        std::shared_ptr<storm::models::sparse::Model<double>> upperModel = builder3.getModelApproximation(false, false);
+        EXPECT_EQ(lowerModel->getNumberOfStates(), upperModel->getNumberOfStates());
+        EXPECT_LE(lowerModel->getNumberOfStates(), model->getNumberOfStates());
+
+        // The bounds enclose the result of the sequentially built model and become tighter with each refinement
+        double lowerBound = checkModel(lowerModel);
+        double upperBound = checkModel(upperModel);
+        EXPECT_LE(lowerBound, result + 1e-8);
+        EXPECT_GE(upperBound, result - 1e-8);
+        EXPECT_GE(lowerBound, previousLowerBound - 1e-8);
+        EXPECT_LE(upperBound, previousUpperBound + 1e-8);
+        previousLowerBound = lowerBound;
+        previousUpperBound = upperBound;
+    }
+}
+
 }  // namespace
@@ -113,6 +113,22 @@ TEST_P(SftBddTest, RRW) {
     expectVectorNear(checker->getAllRRWsAtTimebound(1), param.RRW);
 }
 
+TEST_P(SftBddTest, AllImportanceMeasuresConcurrently) {
+    std::vector<double> const timepoints{0.1, 0.5, 1, 1.5, 2, 3, 4};
+    checker->setNumberOfThreads(3);
+    auto const birnbaumFactors{checker->getAllBirnbaumFactorsAtTimepoints(timepoints)};
+    auto const RAWs{checker->getAllRAWsAtTimepoints(timepoints, 2)};
+
+    // Compare with the computation for single basic events
+    auto const basicElements{checker->getDFT()->getBasicElements()};
+    ASSERT_EQ(birnbaumFactors.size(), basicElements.size());
+    ASSERT_EQ(RAWs.size(), basicElements.size());
+    for (size_t i{0}; i < basicElements.size(); ++i) {
+        expectVectorNear(birnbaumFactors[i], checker->getBirnbaumFactorsAtTimepoints(basicElements[i]->name(), timepoints));
+        expectVectorNear(RAWs[i], checker->getRAWsAtTimepoints(basicElements[i]->name(), timepoints));
+    }
+}
+
 static std::vector<SftTestData> sftTestData{
     {
         "And",
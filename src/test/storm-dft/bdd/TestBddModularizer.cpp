@@ -67,4 +67,23 @@ static std::vector<ModularizerTestData> modularizerTestData{
 };
 INSTANTIATE_TEST_SUITE_P(BddModularizer, BddModularizerTest, testing::ValuesIn(modularizerTestData), [](auto const &info) { return info.param.testname; });
 
+TEST(BddModularizerTest, IsomorphicModules) {
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/bdd/IsomorphicModulesTest.dft")};
+    storm::dft::modelchecker::DftModularizationChecker<double> checker(dft);
+    // Both spare modules are isomorphic, so only one of them is analysed
+    EXPECT_EQ(1ul, checker.getNumberOfAnalysedModules());
+    EXPECT_NEAR(checker.getProbabilityAtTimebound(1), 0.4375, 1e-6);
+    // Results are reused for further time bounds
+    auto result = checker.getProbabilitiesAtTimepoints({1, 2});
+    EXPECT_NEAR(result[0], 0.4375, 1e-6);
+    EXPECT_NEAR(result[1], 1 - std::pow(1 - std::pow(0.75, 2), 2), 1e-6);
+}
+
+TEST(BddModularizerTest, ConcurrentAnalysis) {
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/mcs.dft")};
+    storm::dft::modelchecker::DftModularizationChecker<double> checker(dft);
+    checker.setNumberOfThreads(2);
+    EXPECT_NEAR(checker.getProbabilityAtTimebound(1), 0.9984947969, 1e-6);
+}
+
 }  // namespace
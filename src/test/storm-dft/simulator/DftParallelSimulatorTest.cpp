@@ -0,0 +1,73 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/simulator/DFTParallelSimulator.h"
+#include "storm-dft/simulator/ImportanceFunction.h"
+#include "storm-dft/storage/DftSymmetries.h"
+
+namespace {
+
+class DftParallelSimulatorTest : public ::testing::Test {
+   protected:
+    void prepare(std::string const& file) {
+        // Load, build and prepare DFT
+        dft = storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(file)));
+        EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+        dft->setRelevantEvents(storm::dft::api::computeRelevantEvents({}, {}), false);
+        stateGenerationInfo =
+            std::make_unique<storm::dft::storage::DFTStateGenerationInfo>(dft->buildStateGenerationInfo(storm::dft::storage::DftSymmetries()));
+    }
+
+    storm::dft::simulator::SimulationEstimate simulate(double timebound, uint64_t threads, bool useSplitting, double relativeError = 0.01,
+                                                       uint64_t maxTraces = 1000000) {
+        storm::dft::simulator::DFTParallelSimulator<double> simulator(*dft, *stateGenerationInfo, 5u);
+        simulator.setNumberOfThreads(threads);
+        if (useSplitting) {
+            simulator.setSplitting(std::make_shared<storm::dft::simulator::BECountImportanceFunction<double>>(*dft), 2, dft->nrBasicElements() + 1);
+        }
+        return simulator.estimateProbability(timebound, relativeError, 0.95, maxTraces);
+    }
+
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft;
+    std::unique_ptr<storm::dft::storage::DFTStateGenerationInfo> stateGenerationInfo;
+};
+
+TEST_F(DftParallelSimulatorTest, AndUnreliability) {
+    prepare(STORM_TEST_RESOURCES_DIR "/dft/and.dft");
+    auto estimate = simulate(2, 4, false);
+    EXPECT_NEAR(estimate.probability, 0.3995764009, 0.01);
+    EXPECT_LE(estimate.halfWidth, 0.01 * estimate.probability);
+    EXPECT_LT(estimate.numberOfTraces, 1000000ul);
+
+    estimate = simulate(2, 4, true);
+    EXPECT_NEAR(estimate.probability, 0.3995764009, 0.01);
+    EXPECT_LE(estimate.halfWidth, 0.01 * estimate.probability);
+}
+
+TEST_F(DftParallelSimulatorTest, VotingUnreliability) {
+    prepare(STORM_TEST_RESOURCES_DIR "/dft/voting.dft");
+    auto estimate = simulate(1, 2, false);
+    EXPECT_NEAR(estimate.probability, 0.4511883639, 0.01);
+    estimate = simulate(1, 2, true);
+    EXPECT_NEAR(estimate.probability, 0.4511883639, 0.01);
+}
+
+TEST_F(DftParallelSimulatorTest, HecsUnreliability) {
+    prepare(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft");
+    auto estimate = simulate(1, 0, true, 0.1);
+    EXPECT_NEAR(estimate.probability, 0.00021997582, 0.0001);
+}
+
+TEST_F(DftParallelSimulatorTest, Reproducible) {
+    prepare(STORM_TEST_RESOURCES_DIR "/dft/or.dft");
+    // The relative error is never reached, so all traces are simulated
+    auto estimate1 = simulate(1, 1, false, 1e-9, 20000);
+    auto estimate4 = simulate(1, 4, false, 1e-9, 20000);
+    EXPECT_EQ(estimate1.numberOfTraces, 20000ul);
+    EXPECT_EQ(estimate4.numberOfTraces, 20000ul);
+    EXPECT_NEAR(estimate1.probability, estimate4.probability, 1e-12);
+    EXPECT_NEAR(estimate1.probability, 0.6321205588, 0.02);
+}
+
+}  // namespace
@@ -0,0 +1,62 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/storage/FailableElements.h"
+
+namespace {
+
+std::vector<size_t> getFailable(storm::dft::storage::FailableElements const& failableElements, bool forceBE) {
+    std::vector<size_t> result;
+    for (auto it = failableElements.begin(forceBE); it != failableElements.end(forceBE); ++it) {
+        result.push_back(*it);
+    }
+    return result;
+}
+
+TEST(FailableElementsTest, BEs) {
+    storm::dft::storage::FailableElements failableElements(10);
+    EXPECT_FALSE(failableElements.hasBEs());
+    EXPECT_FALSE(failableElements.hasDependencies());
+
+    failableElements.addBE(7);
+    failableElements.addBE(2);
+    failableElements.addBE(5);
+    EXPECT_TRUE(failableElements.hasBEs());
+    EXPECT_EQ(std::vector<size_t>({2, 5, 7}), getFailable(failableElements, false));
+
+    failableElements.removeBE(5);
+    EXPECT_EQ(std::vector<size_t>({2, 7}), getFailable(failableElements, false));
+}
+
+TEST(FailableElementsTest, Dependencies) {
+    storm::dft::storage::FailableElements failableElements(10);
+    failableElements.addBE(1);
+    failableElements.addDependency(8, true);
+    failableElements.addDependency(4, false);
+    failableElements.addDependency(3, true);
+    failableElements.addDependency(6, false);
+    // Adding a dependency twice has no effect
+    failableElements.addDependency(4, false);
+    EXPECT_TRUE(failableElements.hasDependencies());
+
+    // Non-conflicting dependencies are considered first, each group is sorted by id
+    EXPECT_EQ(std::vector<size_t>({4, 6, 3, 8}), getFailable(failableElements, false));
+    auto it = failableElements.begin();
+    EXPECT_TRUE(it.isFailureDueToDependency());
+    EXPECT_FALSE(it.isConflictingDependency());
+    ++it;
+    ++it;
+    EXPECT_TRUE(it.isConflictingDependency());
+    // BEs can still be iterated
+    EXPECT_EQ(std::vector<size_t>({1}), getFailable(failableElements, true));
+
+    failableElements.removeDependency(4);
+    failableElements.removeDependency(6);
+    EXPECT_EQ(std::vector<size_t>({3, 8}), getFailable(failableElements, false));
+    failableElements.removeDependency(3);
+    failableElements.removeDependency(8);
+    EXPECT_FALSE(failableElements.hasDependencies());
+    EXPECT_EQ(std::vector<size_t>({1}), getFailable(failableElements, false));
+}
+
+}  // namespace
@@ -0,0 +1,95 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-gspn/api/storm-gspn.h"
+#include "storm/api/storm.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace {
+
+class DftGspnModelBuildingTest : public ::testing::Test {
+   protected:
+    void transform(std::string const& file) {
+        auto dft = storm::dft::api::loadDFTGalileoFile<double>(file);
+        std::tie(gspn, toplevelFailedPlace) = storm::dft::api::transformToGSPN(*dft);
+        auto const& manager = gspn->getExpressionManager();
+        auto failedFormula = std::make_shared<storm::logic::AtomicExpressionFormula>(
+            manager->getVariable(gspn->getPlace(toplevelFailedPlace)->getName()).getExpression() == manager->integer(1));
+        mttfFormula = std::make_shared<storm::logic::TimeOperatorFormula>(
+            std::make_shared<storm::logic::EventuallyFormula>(failedFormula, storm::logic::FormulaContext::Time),
+            storm::logic::OperatorInformation(storm::solver::OptimizationDirection::Minimize));
+    }
+
+    double analyzeMTTF(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(mttfFormula, true));
+        return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+    }
+
+    std::shared_ptr<storm::gspn::GSPN> gspn;
+    uint64_t toplevelFailedPlace;
+    std::shared_ptr<storm::logic::Formula const> mttfFormula;
+};
+
+TEST_F(DftGspnModelBuildingTest, And) {
+    transform(STORM_TEST_RESOURCES_DIR "/dft/and.dft");
+    auto model = storm::api::buildSparseModelFromGspn(*gspn, {mttfFormula}, false);
+    EXPECT_NEAR(analyzeMTTF(model), 3, 1e-6);
+    model = storm::api::buildSparseModelFromGspn(*gspn, {mttfFormula}, true);
+    EXPECT_NEAR(analyzeMTTF(model), 3, 1e-6);
+}
+
+TEST_F(DftGspnModelBuildingTest, Voting) {
+    transform(STORM_TEST_RESOURCES_DIR "/dft/voting.dft");
+    auto model = storm::api::buildSparseModelFromGspn(*gspn, {mttfFormula}, true);
+    EXPECT_NEAR(analyzeMTTF(model), 5 / 3.0, 1e-6);
+}
+
+TEST_F(DftGspnModelBuildingTest, Spare) {
+    transform(STORM_TEST_RESOURCES_DIR "/dft/spare.dft");
+    auto model = storm::api::buildSparseModelFromGspn(*gspn, {mttfFormula}, false);
+    EXPECT_NEAR(analyzeMTTF(model), 46 / 13.0, 1e-6);
+
+    // Without elimination, the model coincides with the one obtained via JANI
+    auto janiModel = storm::dft::api::transformToJani(*gspn, toplevelFailedPlace);
+    auto modelFromJani = storm::api::buildSparseModel<double>(storm::storage::SymbolicModelDescription(*janiModel), storm::builder::BuilderOptions());
+    EXPECT_EQ(modelFromJani->getNumberOfStates(), model->getNumberOfStates());
+
+    // Eliminating vanishing markings yields a smaller model
+    auto reducedModel = storm::api::buildSparseModelFromGspn(*gspn, {mttfFormula}, true);
+    EXPECT_LT(reducedModel->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_NEAR(analyzeMTTF(reducedModel), 46 / 13.0, 1e-6);
+}
+
+TEST_F(DftGspnModelBuildingTest, HecsComparedToJani) {
+    transform(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft");
+
+    storm::utility::Stopwatch janiWatch(true);
+    auto janiModel = storm::dft::api::transformToJani(*gspn, toplevelFailedPlace);
+    auto modelFromJani =
+        storm::api::buildSparseModel<double>(storm::storage::SymbolicModelDescription(*janiModel), storm::builder::BuilderOptions({mttfFormula}));
+    janiWatch.stop();
+
+    storm::utility::Stopwatch explicitWatch(true);
+    auto model = storm::api::buildSparseModelFromGspn(*gspn, {mttfFormula}, false);
+    explicitWatch.stop();
+
+    storm::utility::Stopwatch reducedWatch(true);
+    auto reducedModel = storm::api::buildSparseModelFromGspn(*gspn, {mttfFormula}, true);
+    reducedWatch.stop();
+
+    // The build times are recorded in the test report, they are not compared as they depend on the machine
+    RecordProperty("janiBuildMilliseconds", std::to_string(janiWatch.getTimeInMilliseconds()));
+    RecordProperty("explicitBuildMilliseconds", std::to_string(explicitWatch.getTimeInMilliseconds()));
+    RecordProperty("reducedBuildMilliseconds", std::to_string(reducedWatch.getTimeInMilliseconds()));
+
+    EXPECT_EQ(modelFromJani->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_LT(reducedModel->getNumberOfStates(), model->getNumberOfStates());
+    double expected = analyzeMTTF(modelFromJani);
+    EXPECT_NEAR(analyzeMTTF(model), expected, 1e-6 * expected);
+    EXPECT_NEAR(analyzeMTTF(reducedModel), expected, 1e-6 * expected);
+}
+
+}  // namespace
@@ -144,6 +144,49 @@ TYPED_TEST(GradientDescentInstantiationSearcherTest, Simple) {
     ASSERT_NEAR(doubleInstantiation * 4, 1, 1e-6);
 }
 
+TYPED_TEST(GradientDescentInstantiationSearcherTest, SimpleMultiStart) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/gradient1.pm";
+    std::string formulaAsString = "P>=0.2499 [F s=2]";
+    std::string constantsAsString = "";  // e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto simplifier = storm::transformer::SparseParametricDtmcSimplifier<storm::models::sparse::Dtmc<storm::RationalFunction>>(*dtmc);
+    ASSERT_TRUE(simplifier.simplify(*formulas[0]));
+    model = simplifier.getSimplifiedModel();
+    dtmc = model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::derivative::GradientDescentInstantiationSearcher<typename TestFixture::FunctionType, typename TestFixture::ConstantType> checker(
+        *dtmc, storm::derivative::GradientDescentMethod::RMSPROP);
+    std::shared_ptr<storm::logic::Formula> formulaWithoutBounds = formulas[0]->clone();
+    std::shared_ptr<storm::logic::Formula const> formulaNoBound = formulaWithoutBounds->asSharedPointer();
+    std::shared_ptr<FeasibilitySynthesisTask> t = std::make_shared<FeasibilitySynthesisTask>(formulaNoBound);
+    t->setBound(formulas[0]->asOperatorFormula().getBound());
+    std::shared_ptr<FeasibilitySynthesisTask const> feasibilityTask = std::make_shared<FeasibilitySynthesisTask const>(std::move(*t));
+
+    // Run several trajectories concurrently. The search stops once any of them satisfies the bound.
+    checker.setup(this->env(), feasibilityTask);
+    checker.setNumberOfTrajectories(4);
+    auto instantiationAndValue = checker.gradientDescent();
+    EXPECT_TRUE(feasibilityTask->getBound().isSatisfied(instantiationAndValue.second));
+
+    // Check the returned instantiation.
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, typename TestFixture::ConstantType>
+        instantiationChecker(*dtmc);
+    storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction> checkTask(*formulaNoBound);
+    instantiationChecker.specifyFormula(checkTask);
+    auto result = instantiationChecker.check(this->env(), instantiationAndValue.first);
+    auto const& values = result->template asExplicitQuantitativeCheckResult<typename TestFixture::ConstantType>().getValueVector();
+    EXPECT_NEAR(storm::utility::convertNumber<double>(instantiationAndValue.second),
+                storm::utility::convertNumber<double>(values[*dtmc->getInitialStates().begin()]), 1e-6);
+}
+
 TYPED_TEST(GradientDescentInstantiationSearcherTest, Crowds) {
     std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/crowds3_5.pm";
     std::string formulaAsString = "P<=0.00000001 [F \"observe0Greater1\"]";
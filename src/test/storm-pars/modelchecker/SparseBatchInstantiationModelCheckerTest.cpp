@@ -0,0 +1,124 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/modelchecker/instantiation/SparseBatchInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseMdpInstantiationModelChecker.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+
+class SparseBatchInstantiationModelCheckerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        carl::VariablePool::getInstance().clear();
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    }
+
+    void TearDown() override {
+        carl::VariablePool::getInstance().clear();
+    }
+
+    template<typename ModelType>
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> getValuations(ModelType const& model) {
+        auto parameters = storm::models::sparse::getProbabilityParameters(model);
+        auto rewardParameters = storm::models::sparse::getRewardParameters(model);
+        parameters.insert(rewardParameters.begin(), rewardParameters.end());
+
+        std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+        for (uint64_t k = 0; k < 10; ++k) {
+            valuations.emplace_back();
+            uint64_t i = 0;
+            for (auto const& parameter : parameters) {
+                valuations.back()[parameter] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.3 + 0.1 * ((k + i) % 6));
+                ++i;
+            }
+        }
+        // This instantiation does not preserve the graph structure.
+        valuations.emplace_back();
+        for (auto const& parameter : parameters) {
+            valuations.back()[parameter] = storm::utility::zero<storm::RationalFunctionCoefficient>();
+        }
+        return valuations;
+    }
+
+    template<typename ModelType, typename PointCheckerType>
+    void compareWithPointChecker(ModelType const& model, std::shared_ptr<storm::logic::Formula const> const& formula) {
+        auto valuations = getValuations(model);
+        auto task = storm::api::createTask<storm::RationalFunction>(formula, true);
+        storm::modelchecker::SparseBatchInstantiationModelChecker<ModelType, double> batchChecker(model);
+        batchChecker.specifyFormula(task);
+        EXPECT_TRUE(batchChecker.isBatchCheckingSupported());
+        PointCheckerType pointChecker(model);
+        pointChecker.specifyFormula(task);
+
+        auto batchResults = batchChecker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), batchResults.size());
+        uint64_t initialState = *model.getInitialStates().begin();
+        for (uint64_t k = 0; k < valuations.size(); ++k) {
+            double expected = pointChecker.check(env, valuations[k])->template asExplicitQuantitativeCheckResult<double>()[initialState];
+            double actual = batchResults[k]->template asExplicitQuantitativeCheckResult<double>()[initialState];
+            if (storm::utility::isInfinity(expected)) {
+                EXPECT_TRUE(storm::utility::isInfinity(actual)) << "for instantiation " << k;
+            } else {
+                EXPECT_NEAR(expected, actual, 1e-6) << "for instantiation " << k;
+            }
+        }
+    }
+
+    storm::Environment env;
+};
+
+TEST_F(SparseBatchInstantiationModelCheckerTest, Brp_Prob) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F s=5]", program));
+    auto model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    compareWithPointChecker<storm::models::sparse::Dtmc<storm::RationalFunction>,
+                            storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>>(
+        *model, formulas[0]);
+}
+
+TEST_F(SparseBatchInstantiationModelCheckerTest, Brp_Rew) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp_rewards16_2.pm";
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("R=? [F \"target\"]", program));
+    auto model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    compareWithPointChecker<storm::models::sparse::Dtmc<storm::RationalFunction>,
+                            storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>>(
+        *model, formulas[0]);
+}
+
+TEST_F(SparseBatchInstantiationModelCheckerTest, TwoDice_Prob) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pmdp/two_dice.nm";
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    auto formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmin=? [F \"doubles\"];Pmax=? [F \"doubles\"]", program));
+    auto model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalFunction>>();
+
+    for (auto const& formula : formulas) {
+        compareWithPointChecker<storm::models::sparse::Mdp<storm::RationalFunction>,
+                                storm::modelchecker::SparseMdpInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double>>(
+            *model, formula);
+    }
+}
+
+}  // namespace
+
+#endif
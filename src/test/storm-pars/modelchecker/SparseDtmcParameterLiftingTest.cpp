@@ -112,6 +112,117 @@ TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob) {
                                            storm::modelchecker::RegionResult::Unknown, true));
 }
 
+TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_regionAnalysisHint) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+    std::string constantsAsString = "";  // e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+    modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+    auto createChecker = [&]() {
+        return storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(
+            this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+    };
+    auto parentRegion = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.65,0.75<=pK<=0.95", modelParameters);
+    auto subRegion = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.5,0.75<=pK<=0.85", modelParameters);
+    double const precision = 1e-6;
+    auto getBound = [&](storm::modelchecker::RegionModelChecker<storm::RationalFunction>& checker,
+                        storm::storage::ParameterRegion<storm::RationalFunction> const& region, storm::OptimizationDirection dir) {
+        return storm::utility::convertNumber<double>(checker.getBoundAtInitState(this->env(), region, dir));
+    };
+
+    // Analyzing the parent region yields a hint for both directions
+    auto parentChecker = createChecker();
+    EXPECT_EQ(nullptr, parentChecker->getRegionAnalysisHint(storm::OptimizationDirection::Minimize));
+    double parentMin = getBound(*parentChecker, parentRegion, storm::OptimizationDirection::Minimize);
+    double parentMax = getBound(*parentChecker, parentRegion, storm::OptimizationDirection::Maximize);
+    auto minHint = parentChecker->getRegionAnalysisHint(storm::OptimizationDirection::Minimize);
+    auto maxHint = parentChecker->getRegionAnalysisHint(storm::OptimizationDirection::Maximize);
+    ASSERT_NE(nullptr, minHint);
+    ASSERT_NE(nullptr, maxHint);
+    EXPECT_TRUE(minHint->isExplicitModelCheckerHint());
+    EXPECT_TRUE(maxHint->isExplicitModelCheckerHint());
+
+    // Bounds for the subregion without hints
+    auto plainChecker = createChecker();
+    double plainMin = getBound(*plainChecker, subRegion, storm::OptimizationDirection::Minimize);
+    double plainMax = getBound(*plainChecker, subRegion, storm::OptimizationDirection::Maximize);
+
+    // Bounds for the subregion when starting from the solutions of the parent region
+    auto hintedChecker = createChecker();
+    hintedChecker->setRegionAnalysisHint(storm::OptimizationDirection::Minimize, minHint);
+    hintedChecker->setRegionAnalysisHint(storm::OptimizationDirection::Maximize, maxHint);
+    double hintedMin = getBound(*hintedChecker, subRegion, storm::OptimizationDirection::Minimize);
+    double hintedMax = getBound(*hintedChecker, subRegion, storm::OptimizationDirection::Maximize);
+
+    // The hints only affect the performance, so the results coincide. They are also within the bounds of the parent region.
+    EXPECT_NEAR(plainMin, hintedMin, precision);
+    EXPECT_NEAR(plainMax, hintedMax, precision);
+    EXPECT_LE(parentMin, hintedMin + precision);
+    EXPECT_GE(parentMax, hintedMax - precision);
+    EXPECT_LT(hintedMin, hintedMax);
+
+    // The subregion analysis provides new hints for its own subregions
+    auto subMinHint = hintedChecker->getRegionAnalysisHint(storm::OptimizationDirection::Minimize);
+    ASSERT_NE(nullptr, subMinHint);
+    EXPECT_NE(minHint, subMinHint);
+}
+
+TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_parallelRefinement) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+    std::string constantsAsString = "";  // e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+    modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+    auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+    auto sequentialChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+    auto parallelChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+    std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<storm::RationalFunction>>> workers;
+    for (uint64_t worker = 1; worker < 3; ++worker) {
+        workers.push_back(storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task));
+    }
+    parallelChecker->setRefinementWorkers(workers);
+
+    // The refinement has to yield the same subregions in the same order, regardless of the number of workers.
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.65,0.75<=pK<=0.95", modelParameters);
+    auto coverageThreshold = storm::utility::convertNumber<storm::RationalFunction>(0.1);
+    auto sequentialResult = sequentialChecker->performRegionRefinement(this->env(), region, coverageThreshold, 5);
+    auto parallelResult = parallelChecker->performRegionRefinement(this->env(), region, coverageThreshold, 5);
+    auto const& sequentialRegions = sequentialResult->getRegionResults();
+    auto const& parallelRegions = parallelResult->getRegionResults();
+    ASSERT_EQ(sequentialRegions.size(), parallelRegions.size());
+    EXPECT_LT(1ul, sequentialRegions.size());
+    for (uint64_t i = 0; i < sequentialRegions.size(); ++i) {
+        EXPECT_EQ(sequentialRegions[i].first.toString(), parallelRegions[i].first.toString());
+        EXPECT_EQ(sequentialRegions[i].second, parallelRegions[i].second);
+    }
+}
+
 TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
     typedef typename TestFixture::ValueType ValueType;
 
@@ -0,0 +1,81 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include <carl/core/VariablePool.h>
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/utility/CompiledRationalFunction.h"
+#include "storm-pars/utility/parametric.h"
+
+namespace {
+
+class CompiledRationalFunctionTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        carl::VariablePool::getInstance().clear();
+        p = carl::freshRealVariable("p");
+        q = carl::freshRealVariable("q");
+        cache = std::make_shared<storm::RawPolynomialCache>();
+
+        storm::RawPolynomial rawP(p), rawQ(q);
+        storm::RationalFunctionCoefficient half = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(std::string("1/2"));
+        storm::RationalFunctionCoefficient three = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(std::string("3"));
+        polynomial = storm::RationalFunction(storm::Polynomial(rawP * rawP * rawQ - rawQ * three + half, cache));
+        fraction = storm::RationalFunction(storm::Polynomial(rawP * rawQ, cache), storm::Polynomial(rawP + rawQ * rawQ + half, cache));
+        constantDenominator = storm::RationalFunction(storm::Polynomial(rawP * three + half, cache), storm::Polynomial(storm::RawPolynomial(three), cache));
+    }
+
+    void TearDown() override {
+        carl::VariablePool::getInstance().clear();
+    }
+
+    storm::RationalFunctionVariable p, q;
+    std::shared_ptr<storm::RawPolynomialCache> cache;
+    storm::RationalFunction polynomial, fraction, constantDenominator;
+};
+
+TEST_F(CompiledRationalFunctionTest, EvaluateExact) {
+    std::vector<storm::RationalFunctionVariable> variables = {q, p};
+    auto variableIndices = storm::utility::getVariableIndices(variables);
+
+    for (auto const& function : {polynomial, fraction, constantDenominator}) {
+        storm::utility::CompiledRationalFunction<storm::RationalNumber> compiledFunction(function, variableIndices);
+        for (std::string const& pValue : {"0", "1/3", "7/10"}) {
+            for (std::string const& qValue : {"1/4", "1", "5/2"}) {
+                storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+                valuation[p] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(pValue);
+                valuation[q] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(qValue);
+                std::vector<storm::RationalNumber> variableValues = {storm::utility::convertNumber<storm::RationalNumber>(qValue),
+                                                                     storm::utility::convertNumber<storm::RationalNumber>(pValue)};
+                EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(storm::utility::parametric::evaluate(function, valuation)),
+                          compiledFunction.evaluate(variableValues));
+            }
+        }
+    }
+}
+
+TEST_F(CompiledRationalFunctionTest, EvaluateDouble) {
+    std::vector<storm::RationalFunctionVariable> variables = {p, q};
+    auto variableIndices = storm::utility::getVariableIndices(variables);
+
+    storm::utility::CompiledRationalFunction<double> compiledPolynomial(polynomial, variableIndices);
+    storm::utility::CompiledRationalFunction<double> compiledFraction(fraction, variableIndices);
+    EXPECT_EQ(std::vector<uint64_t>({0, 1}), compiledFraction.getOccurringVariables());
+    storm::utility::CompiledRationalFunction<double> compiledConstantDenominator(constantDenominator, variableIndices);
+    EXPECT_EQ(std::vector<uint64_t>({0}), compiledConstantDenominator.getOccurringVariables());
+
+    for (double pValue : {0.0, 0.25, 0.8}) {
+        for (double qValue : {0.1, 0.5, 1.0}) {
+            std::vector<double> variableValues = {pValue, qValue};
+            EXPECT_NEAR(pValue * pValue * qValue - 3 * qValue + 0.5, compiledPolynomial.evaluate(variableValues), 1e-12);
+            EXPECT_NEAR(pValue * qValue / (pValue + qValue * qValue + 0.5), compiledFraction.evaluate(variableValues), 1e-12);
+            EXPECT_NEAR((3 * pValue + 0.5) / 3, compiledConstantDenominator.evaluate(variableValues), 1e-12);
+        }
+    }
+}
+
+}  // namespace
+
+#endif
@@ -4,6 +4,8 @@
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
+#include "storm-pomdp/modelchecker/PointBasedPomdpValueBoundsModelChecker.h"
+#include "storm-pomdp/modelchecker/PreprocessingPomdpValueBoundsModelChecker.h"
 #include "storm-pomdp/transformer/GlobalPOMDPSelfLoopEliminator.h"
 #include "storm-pomdp/transformer/KnownProbabilityTransformer.h"
 #include "storm-pomdp/transformer/MakePOMDPCanonic.h"
@@ -141,6 +143,71 @@ class PreprocessedRefineDoubleVIEnvironment {
     }
 };
 
+class ParallelRefineDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.005);
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.refine = true;
+        options.refinePrecision = precision();
+        options.explorationThreads = 4;
+    }
+};
+
+class IncrementalRefineDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.005);
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.refine = true;
+        options.refinePrecision = precision();
+        options.incrementalValueComputation = true;
+    }
+};
+
+class PointBasedRefineDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.005);
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.refine = true;
+        options.refinePrecision = precision();
+        options.pointBasedIterations = 10;
+        options.pointBasedBeliefs = 50;
+        options.explorationThreads = 2;
+    }
+};
+
 class DefaultDoubleOVIEnvironment {
    public:
     typedef double ValueType;
@@ -286,6 +353,53 @@ class BeliefExplorationPomdpModelCheckerTest : public ::testing::Test {
     bool isExact() const {
         return TestType::isExactModelChecking;
     }
+    void checkPointBasedValueBounds(Input const& input, ValueType const& expected) const {
+        auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(*input.model, *input.formula);
+        auto preprocessedBounds =
+            storm::pomdp::modelchecker::PreprocessingPomdpValueBoundsModelChecker<ValueType>(*input.model).getValueBounds(env(), *input.formula, formulaInfo);
+        bool minimize = formulaInfo.minimize();
+        // The achievable bounds are improved whereas the other bounds are only used to check soundness
+        auto const& achievableBounds = minimize ? preprocessedBounds.upper : preprocessedBounds.lower;
+        auto const& optimisticBounds = minimize ? preprocessedBounds.lower : preprocessedBounds.upper;
+        ASSERT_FALSE(achievableBounds.empty());
+        ASSERT_FALSE(optimisticBounds.empty());
+        storm::pomdp::modelchecker::PointBasedPomdpValueBoundsModelChecker<ValueType> pointBasedChecker(*input.model);
+        auto pointBasedBounds = pointBasedChecker.computeValueBounds(formulaInfo, achievableBounds, 50, 20, 1);
+        ASSERT_FALSE(pointBasedBounds.empty());
+
+        auto better = [minimize](ValueType const& lhs, ValueType const& rhs) { return minimize ? lhs < rhs : lhs > rhs; };
+        auto const precision = modelcheckingPrecision();
+        auto const tolerance = minimize ? precision : -precision;
+        for (auto const& bound : pointBasedBounds) {
+            ASSERT_EQ(input.model->getNumberOfStates(), bound.size());
+            // Each vector is achievable, so it can not be better than the optimal value nor the optimistic bound of any state.
+            for (uint64_t state = 0; state < bound.size(); ++state) {
+                for (auto const& optimisticBound : optimisticBounds) {
+                    EXPECT_FALSE(better(bound[state] + tolerance, optimisticBound[state]))
+                        << "Point-based bound " << bound[state] << " of state " << state << " exceeds the optimistic bound " << optimisticBound[state] << ".";
+                }
+            }
+        }
+
+        // The best point-based bound at the initial state is sound and at least as tight as the best bound from preprocessing.
+        ASSERT_EQ(1ull, input.model->getInitialStates().getNumberOfSetBits());
+        uint64_t initialState = input.model->getInitialStates().getNextSetIndex(0);
+        ValueType bestPreprocessed = achievableBounds.front()[initialState];
+        for (auto const& bound : achievableBounds) {
+            if (better(bound[initialState], bestPreprocessed)) {
+                bestPreprocessed = bound[initialState];
+            }
+        }
+        ValueType bestPointBased = pointBasedBounds.front()[initialState];
+        for (auto const& bound : pointBasedBounds) {
+            if (better(bound[initialState], bestPointBased)) {
+                bestPointBased = bound[initialState];
+            }
+        }
+        EXPECT_FALSE(better(bestPointBased + tolerance, expected)) << "Point-based bound " << bestPointBased << " is not sound for value " << expected << ".";
+        EXPECT_FALSE(better(bestPreprocessed, bestPointBased - tolerance))
+            << "Point-based bound " << bestPointBased << " is less tight than the preprocessed bound " << bestPreprocessed << ".";
+    }
 
    private:
     storm::Environment _environment;
@@ -293,6 +407,7 @@ class BeliefExplorationPomdpModelCheckerTest : public ::testing::Test {
 
 typedef ::testing::Types<DefaultDoubleVIEnvironment, SelfloopReductionDefaultDoubleVIEnvironment, QualitativeReductionDefaultDoubleVIEnvironment,
                          PreprocessedDefaultDoubleVIEnvironment, FineDoubleVIEnvironment, RefineDoubleVIEnvironment, PreprocessedRefineDoubleVIEnvironment,
+                         ParallelRefineDoubleVIEnvironment, IncrementalRefineDoubleVIEnvironment, PointBasedRefineDoubleVIEnvironment,
                          DefaultDoubleOVIEnvironment, DefaultRationalPIEnvironment, PreprocessedDefaultRationalPIEnvironment>
     TestingTypes;
 
@@ -595,6 +710,21 @@ TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, maze2_Rmin_SE) {
         << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
 }
 
+TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, simple_Pmax_PointBasedBounds) {
+    auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0.4");
+    this->checkPointBasedValueBounds(data, this->parseNumber("7/10"));
+}
+
+TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, simple_Pmin_PointBasedBounds) {
+    auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmin=? [F \"goal\" ]", "slippery=0.4");
+    this->checkPointBasedValueBounds(data, this->parseNumber("3/10"));
+}
+
+TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, maze2_Rmin_PointBasedBounds) {
+    auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "Rmin=? [F \"goal\"]", "sl=0");
+    this->checkPointBasedValueBounds(data, this->parseNumber("74/91"));
+}
+
 TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, maze2_Rmax) {
     typedef typename TestFixture::ValueType ValueType;
 
@@ -740,6 +870,32 @@ TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, refuel_Pmin_SE) {
         << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
 }
 
+TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, maze2_slippery_Rmin_incremental_values) {
+    typedef typename TestFixture::ValueType ValueType;
+    if (!this->options().refine) {
+        GTEST_SKIP() << "Values are only re-used when refining.";
+    }
+
+    auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "Rmin=? [F \"goal\"]", "sl=0.075");
+    auto options = this->options();
+    options.incrementalValueComputation = false;
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, options);
+    auto result = checker.check(this->env(), *data.formula);
+    options.incrementalValueComputation = true;
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> incrementalChecker(data.model, options);
+    auto incrementalResult = incrementalChecker.check(this->env(), *data.formula);
+
+    ValueType expected = this->parseNumber("80/91");
+    EXPECT_LE(incrementalResult.lowerBound, expected + this->modelcheckingPrecision());
+    EXPECT_GE(incrementalResult.upperBound, expected - this->modelcheckingPrecision());
+    // Re-using values may lead to slightly different refinement decisions, but both results need to be similarly precise
+    EXPECT_LE(storm::utility::abs<ValueType>(incrementalResult.lowerBound - result.lowerBound), this->precision());
+    EXPECT_LE(storm::utility::abs<ValueType>(incrementalResult.upperBound - result.upperBound), this->precision());
+    EXPECT_LE(incrementalResult.diff(), this->precision())
+        << "Result [" << incrementalResult.lowerBound << ", " << incrementalResult.upperBound
+        << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
+}
+
 #if defined STORM_HAVE_Z3_OPTIMIZE
 
 TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, simple_Pmax_Clip) {
@@ -0,0 +1,90 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <map>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-pomdp/storage/BeliefManager.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+
+namespace {
+
+class BeliefManagerTest : public ::testing::Test {
+   protected:
+    typedef storm::storage::BeliefManager<storm::models::sparse::Pomdp<double>> BeliefManagerType;
+
+    void SetUp() override {
+#ifndef STORM_HAVE_Z3
+        GTEST_SKIP() << "Z3 not available.";
+#endif
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+        program = storm::utility::prism::preprocess(program, "sl=0");
+        std::shared_ptr<storm::logic::Formula const> formula =
+            storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+        pomdp = storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+        storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+        pomdp = makeCanonic.transform();
+
+        // Find two states with the same observation. Beliefs over these states only differ in their values.
+        std::map<uint32_t, uint64_t> firstStateWithObservation;
+        for (uint64_t state = 0; state < pomdp->getNumberOfStates(); ++state) {
+            auto insertionRes = firstStateWithObservation.emplace(pomdp->getObservation(state), state);
+            if (!insertionRes.second) {
+                firstState = insertionRes.first->second;
+                secondState = state;
+                return;
+            }
+        }
+        FAIL() << "No two states with the same observation.";
+    }
+
+    BeliefManagerType::BeliefType createBelief(double firstValue) const {
+        BeliefManagerType::BeliefType belief;
+        belief[firstState] = firstValue;
+        belief[secondState] = 1.0 - firstValue;
+        return belief;
+    }
+
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp;
+    uint64_t firstState;
+    uint64_t secondState;
+};
+
+TEST_F(BeliefManagerTest, BeliefIndexGrowth) {
+    BeliefManagerType manager(*pomdp, 1e-9, BeliefManagerType::TriangulationMode::Static);
+    uint64_t const initialNumberOfIds = manager.getNumberOfBeliefIds();
+
+    // Enough beliefs to grow the index several times
+    uint64_t const numberOfBeliefs = 999;
+    std::vector<BeliefManagerType::BeliefId> ids;
+    for (uint64_t i = 1; i <= numberOfBeliefs; ++i) {
+        ids.push_back(manager.getOrAddBeliefId(createBelief(i / 1000.0)));
+        EXPECT_EQ(initialNumberOfIds + i - 1, ids.back());
+    }
+    ASSERT_EQ(initialNumberOfIds + numberOfBeliefs, manager.getNumberOfBeliefIds());
+
+    // All ids refer to different beliefs
+    for (uint64_t i = 0; i < ids.size(); ++i) {
+        EXPECT_FALSE(manager.isEqual(manager.getInitialBelief(), ids[i]));
+        for (uint64_t j = i + 1; j < ids.size(); ++j) {
+            EXPECT_FALSE(manager.isEqual(ids[i], ids[j])) << "Beliefs " << ids[i] << " and " << ids[j] << " coincide.";
+        }
+    }
+
+    // Stored beliefs are found again, also if their values only differ by rounding errors
+    for (uint64_t i = 1; i <= numberOfBeliefs; ++i) {
+        EXPECT_EQ(ids[i - 1], manager.getOrAddBeliefId(createBelief(i / 1000.0)));
+        EXPECT_EQ(ids[i - 1], manager.getOrAddBeliefId(createBelief(i * 0.001)));
+    }
+    EXPECT_EQ(ids[299], manager.getOrAddBeliefId(createBelief(0.1 + 0.2)));
+    EXPECT_EQ(ids[699], manager.getOrAddBeliefId(createBelief(1.0 - (0.1 + 0.2))));
+    EXPECT_EQ(initialNumberOfIds + numberOfBeliefs, manager.getNumberOfBeliefIds());
+
+    // The initial belief is still found
+    BeliefManagerType::BeliefType initialBelief;
+    initialBelief[*pomdp->getInitialStates().begin()] = 1.0;
+    EXPECT_EQ(manager.getInitialBelief(), manager.getOrAddBeliefId(initialBelief));
+}
+
+}  // namespace
@@ -178,6 +178,29 @@ TYPED_TEST(DdJaniModelBuilderTest, Mdp) {
     EXPECT_EQ(12ul, mdp->getNumberOfChoices());
 }
 
+TYPED_TEST(DdJaniModelBuilderTest, ReachabilityStrategies) {
+    const storm::dd::DdType DdType = TestFixture::DdType;
+    auto dtmcModel = this->getJaniModelFromPrism("/dtmc/crowds-5-5.pm");
+    auto mdpModel = this->getJaniModelFromPrism("/mdp/leader3.nm");
+
+    for (auto strategy : {storm::builder::SymbolicReachabilityStrategy::Bfs, storm::builder::SymbolicReachabilityStrategy::Chaining,
+                          storm::builder::SymbolicReachabilityStrategy::Saturation}) {
+        typename storm::builder::DdJaniModelBuilder<DdType, double>::Options options;
+        options.reachabilityStrategy = strategy;
+        storm::builder::DdJaniModelBuilder<DdType, double> builder;
+
+        std::shared_ptr<storm::models::symbolic::Model<DdType>> model = builder.build(dtmcModel, options);
+        EXPECT_EQ(8607ul, model->getNumberOfStates()) << "Strategy: " << strategy;
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions()) << "Strategy: " << strategy;
+
+        model = builder.build(mdpModel, options);
+        std::shared_ptr<storm::models::symbolic::Mdp<DdType>> mdp = model->template as<storm::models::symbolic::Mdp<DdType>>();
+        EXPECT_EQ(364ul, mdp->getNumberOfStates()) << "Strategy: " << strategy;
+        EXPECT_EQ(654ul, mdp->getNumberOfTransitions()) << "Strategy: " << strategy;
+        EXPECT_EQ(573ul, mdp->getNumberOfChoices()) << "Strategy: " << strategy;
+    }
+}
+
 TYPED_TEST(DdJaniModelBuilderTest, SynchronizationVectors) {
     const storm::dd::DdType DdType = TestFixture::DdType;
     auto janiModel = this->getJaniModelFromPrism("/mdp/SmallPrismTest.nm");
@@ -174,6 +174,29 @@ TYPED_TEST(DdPrismModelBuilderTest, Mdp) {
     EXPECT_EQ(12ul, mdp->getNumberOfChoices());
 }
 
+TYPED_TEST(DdPrismModelBuilderTest, ReachabilityStrategies) {
+    const storm::dd::DdType DdType = TestFixture::DdType;
+    storm::prism::Program dtmcProgram =
+        storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm").preprocess().asPrismProgram();
+    storm::prism::Program mdpProgram = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm").preprocess().asPrismProgram();
+
+    for (auto strategy : {storm::builder::SymbolicReachabilityStrategy::Bfs, storm::builder::SymbolicReachabilityStrategy::Chaining,
+                          storm::builder::SymbolicReachabilityStrategy::Saturation}) {
+        typename storm::builder::DdPrismModelBuilder<DdType>::Options options;
+        options.reachabilityStrategy = strategy;
+
+        std::shared_ptr<storm::models::symbolic::Model<DdType>> model = storm::builder::DdPrismModelBuilder<DdType>().build(dtmcProgram, options);
+        EXPECT_EQ(8607ul, model->getNumberOfStates()) << "Strategy: " << strategy;
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions()) << "Strategy: " << strategy;
+
+        model = storm::builder::DdPrismModelBuilder<DdType>().build(mdpProgram, options);
+        std::shared_ptr<storm::models::symbolic::Mdp<DdType>> mdp = model->template as<storm::models::symbolic::Mdp<DdType>>();
+        EXPECT_EQ(364ul, mdp->getNumberOfStates()) << "Strategy: " << strategy;
+        EXPECT_EQ(654ul, mdp->getNumberOfTransitions()) << "Strategy: " << strategy;
+        EXPECT_EQ(573ul, mdp->getNumberOfChoices()) << "Strategy: " << strategy;
+    }
+}
+
 TYPED_TEST(DdPrismModelBuilderTest, Composition) {
     const storm::dd::DdType DdType = TestFixture::DdType;
 
@@ -4,10 +4,13 @@
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/solver/LinearEquationSolver.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/utility/constants.h"
 
@@ -127,3 +130,94 @@ TEST_F(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds) {
     EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("620529/1364000")),
               result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
+
+TEST_F(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds_concurrent_epochs) {
+    storm::Environment env;
+    env.modelchecker().setEpochThreads(2);
+    env.modelchecker().setEpochMemoryLimit(1);
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm";
+    std::string formulasAsString = "P=? [F{\"num_runs\"}<=3,{\"observe0\"}>1 true]";
+    formulasAsString += "; R{\"observe0\"}=? [C{\"num_runs\"}<=3]";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "CrowdSize=4");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalNumber>> dtmc =
+        storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalNumber>>();
+    uint_fast64_t const initState = *dtmc->getInitialStates().begin();
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+    result = storm::api::verifyWithSparseEngine(env, dtmc, storm::api::createTask<storm::RationalNumber>(formulas[0], true));
+    ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("78686542099694893/1268858272000000000")),
+              result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+
+    result = storm::api::verifyWithSparseEngine(env, dtmc, storm::api::createTask<storm::RationalNumber>(formulas[1], true));
+    ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("620529/1364000")),
+              result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+}
+
+template<typename ValueType>
+ValueType analyzeEpochsWithSolutionMemoryLimit(storm::models::sparse::Dtmc<ValueType> const& dtmc, std::shared_ptr<storm::logic::Formula const> const& formula,
+                                               uint64_t numberOfThreads, boost::optional<uint64_t> solutionMemoryLimit) {
+    storm::Environment env;
+    storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(
+        dtmc, std::static_pointer_cast<storm::logic::OperatorFormula const>(formula->asSharedPointer()));
+    if (solutionMemoryLimit) {
+        rewardUnfolding.setSolutionMemoryLimit(solutionMemoryLimit.get());
+    }
+    auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
+    auto upperBound = rewardUnfolding.getUpperObjectiveBound();
+    auto initEpoch = rewardUnfolding.getStartEpoch();
+    auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+    rewardUnfolding.setEquationSystemFormatForEpochModel(storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getEquationProblemFormat(env));
+
+    std::vector<storm::Environment> threadEnvs(numberOfThreads, env);
+    std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numberOfThreads);
+    rewardUnfolding.analyzeEpochs(
+        epochOrder, numberOfThreads,
+        [&](uint64_t threadIndex, auto const&, auto& epochModel) {
+            return epochModel.analyzeSingleObjective(threadEnvs[threadIndex], x[threadIndex], b[threadIndex], linEqSolvers[threadIndex], lowerBound,
+                                                     upperBound);
+        },
+        [](auto const&) { return true; });
+    if (solutionMemoryLimit) {
+        EXPECT_GT(rewardUnfolding.getNumberOfSpilledSolutions(), 0ull);
+    } else {
+        EXPECT_EQ(0ull, rewardUnfolding.getNumberOfSpilledSolutions());
+    }
+    return rewardUnfolding.getInitialStateResult(initEpoch);
+}
+
+template<typename ValueType>
+void checkCrowdsWithSolutionMemoryLimit() {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm";
+    std::string formulasAsString = "P=? [F{\"num_runs\"}<=3,{\"observe0\"}>1 true]";
+    formulasAsString += "; R{\"observe0\"}=? [C{\"num_runs\"}<=3]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "CrowdSize=4");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    auto dtmc = storm::api::buildSparseModel<ValueType>(program, formulas)->template as<storm::models::sparse::Dtmc<ValueType>>();
+
+    for (auto const& formula : formulas) {
+        for (uint64_t numberOfThreads : {1ull, 2ull}) {
+            ValueType expected = analyzeEpochsWithSolutionMemoryLimit(*dtmc, formula, numberOfThreads, boost::none);
+            // A limit of a single byte spills every solution that is not needed right away
+            EXPECT_EQ(expected, analyzeEpochsWithSolutionMemoryLimit(*dtmc, formula, numberOfThreads, boost::optional<uint64_t>(1)));
+        }
+    }
+}
+
+TEST_F(SparseDtmcMultiDimensionalRewardUnfoldingTest, spilled_solutions_double) {
+    checkCrowdsWithSolutionMemoryLimit<double>();
+}
+
+TEST_F(SparseDtmcMultiDimensionalRewardUnfoldingTest, spilled_solutions_rational) {
+    checkCrowdsWithSolutionMemoryLimit<storm::RationalNumber>();
+}
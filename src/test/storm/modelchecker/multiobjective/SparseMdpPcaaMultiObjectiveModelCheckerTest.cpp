@@ -231,12 +231,10 @@ std::vector<std::vector<ValueType>> convertPointset(std::vector<std::vector<std:
     return out;
 }
 
-TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, simple_lra) {
-    if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
-        GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
-    }
+void checkSimpleLra(uint64_t paretoThreads) {
     storm::Environment env;
     env.modelchecker().multi().setMethod(storm::modelchecker::multiobjective::MultiObjectiveMethod::Pcaa);
+    env.modelchecker().multi().setParetoThreads(paretoThreads);
 
     std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_simple_lra.nm";
     std::string formulasAsString = "multi(R{\"first\"}max=? [ LRA ], R{\"second\"}max=? [ LRA ]);\n";                // pareto
@@ -358,6 +356,20 @@ TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, simple_lra) {
     }
 }
 
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, simple_lra) {
+    if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
+        GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
+    }
+    checkSimpleLra(1);
+}
+
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, simple_lra_concurrent_weight_vectors) {
+    if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
+        GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
+    }
+    checkSimpleLra(3);
+}
+
 TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, resource_gathering) {
     if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
         GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
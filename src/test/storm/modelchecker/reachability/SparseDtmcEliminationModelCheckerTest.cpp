@@ -1,7 +1,12 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include "storm-parsers/api/storm-parsers.h"
 #include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -10,8 +15,30 @@
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 
+namespace {
+// Restores the elimination settings that are changed by a test.
+class EliminationSettingsGuard {
+   public:
+    EliminationSettingsGuard()
+        : order(storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationOrder()),
+          operationCacheSize(storm::settings::getModule<storm::settings::modules::EliminationSettings>().getOperationCacheSize()) {
+        // Intentionally left empty
+    }
+
+    ~EliminationSettingsGuard() {
+        storm::settings::mutableEliminationSettings().setEliminationOrder(order);
+        storm::settings::mutableEliminationSettings().setOperationCacheSize(operationCacheSize);
+    }
+
+   private:
+    storm::settings::modules::EliminationSettings::EliminationOrder order;
+    uint_fast64_t operationCacheSize;
+};
+}  // namespace
+
 TEST(SparseDtmcEliminationModelCheckerTest, Die) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
         STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", STORM_TEST_RESOURCES_DIR "/rew/die.coin_flips.trans.rew");
@@ -139,3 +166,58 @@ TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
+
+TEST(SparseDtmcEliminationModelCheckerTest, CrowdsDynamicCostOrder) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+
+    // Eliminate the states in the order given by their estimated cost.
+    EliminationSettingsGuard guard;
+    storm::settings::mutableEliminationSettings().setEliminationOrder(storm::settings::modules::EliminationSettings::EliminationOrder::DynamicCost);
+    EXPECT_EQ(storm::settings::modules::EliminationSettings::EliminationOrder::DynamicCost,
+              storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationOrder());
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formula);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double>& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(0.3328800375801578281, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observeOnlyTrueSender\"]");
+
+    result = checker.check(*formula);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double>& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(0.32153724292835045, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+}
+
+TEST(SparseDtmcEliminationModelCheckerTest, BrpOperationCache) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F s=5]", program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+
+    EliminationSettingsGuard guard;
+    auto computeWithOperationCacheSize = [&](uint64_t size) {
+        storm::settings::mutableEliminationSettings().setOperationCacheSize(size);
+        storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>> checker(*dtmc);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formulas.front());
+        return result->asExplicitQuantitativeCheckResult<storm::RationalFunction>()[initialState];
+    };
+
+    // Memoizing the sums and products (also if the stored results are dropped repeatedly) must not change the result.
+    storm::RationalFunction resultWithoutCache = computeWithOperationCacheSize(0);
+    EXPECT_EQ(resultWithoutCache, computeWithOperationCacheSize(100000));
+    EXPECT_EQ(resultWithoutCache, computeWithOperationCacheSize(10));
+}
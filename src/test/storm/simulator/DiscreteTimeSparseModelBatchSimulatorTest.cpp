@@ -0,0 +1,76 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/builder.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/simulator/DiscreteTimeSparseModelBatchSimulator.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Model<double>> buildDieModel() {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::builder::BuilderOptions options;
+    options.setBuildAllRewardModels();
+    options.setBuildAllLabels();
+    return storm::api::buildSparseModel<double>(program, options);
+}
+}  // namespace
+
+TEST(DiscreteTimeSparseModelBatchSimulatorTest, KnuthYaoDieTest) {
+    auto model = buildDieModel();
+    uint64_t const numberOfPaths = 20000;
+    storm::simulator::DiscreteTimeSparseModelBatchSimulator<double> sim(*model, numberOfPaths, 512);
+    sim.setSeed(42);
+    ASSERT_EQ(1ul, sim.getRewardModelNames().size());
+    EXPECT_EQ("coin_flips", sim.getRewardModelNames()[0]);
+    EXPECT_EQ(numberOfPaths, sim.getNumberOfPaths());
+
+    EXPECT_EQ(numberOfPaths, sim.randomStep());
+    for (auto const& reward : sim.getLastRewards(0)) {
+        EXPECT_EQ(1.0, reward);
+    }
+    EXPECT_EQ(numberOfPaths, sim.randomSteps(100));
+
+    // After 101 steps, virtually every path has reached a done state.
+    auto done = model->getStates("done");
+    auto one = model->getStates("one");
+    uint64_t numberOfDonePaths = 0;
+    uint64_t numberOfOnePaths = 0;
+    double totalCoinFlips = 0.0;
+    for (uint64_t path = 0; path < numberOfPaths; ++path) {
+        uint64_t state = sim.getCurrentStates()[path];
+        numberOfDonePaths += done.get(state) ? 1 : 0;
+        numberOfOnePaths += one.get(state) ? 1 : 0;
+        totalCoinFlips += sim.getAccumulatedRewards(0)[path];
+    }
+    EXPECT_EQ(numberOfPaths, numberOfDonePaths);
+    EXPECT_NEAR(1.0 / 6.0, static_cast<double>(numberOfOnePaths) / numberOfPaths, 0.02);
+    EXPECT_NEAR(11.0 / 3.0, totalCoinFlips / numberOfPaths, 0.1);
+
+    sim.resetToInitial();
+    for (auto const& state : sim.getCurrentStates()) {
+        EXPECT_EQ(*model->getInitialStates().begin(), state);
+    }
+    for (auto const& reward : sim.getAccumulatedRewards(0)) {
+        EXPECT_EQ(0.0, reward);
+    }
+}
+
+TEST(DiscreteTimeSparseModelBatchSimulatorTest, ThreadIndependenceTest) {
+    auto model = buildDieModel();
+    uint64_t const numberOfPaths = 5000;
+    storm::simulator::DiscreteTimeSparseModelBatchSimulator<double> sequential(*model, numberOfPaths, 256);
+    storm::simulator::DiscreteTimeSparseModelBatchSimulator<double> parallel(*model, numberOfPaths, 256);
+    sequential.setSeed(1234);
+    parallel.setSeed(1234);
+    parallel.setNumberOfThreads(4);
+    for (uint64_t step = 0; step < 5; ++step) {
+        sequential.randomStep();
+        parallel.randomStep();
+        EXPECT_EQ(sequential.getCurrentStates(), parallel.getCurrentStates());
+    }
+    sequential.randomSteps(10);
+    parallel.randomSteps(10);
+    EXPECT_EQ(sequential.getCurrentStates(), parallel.getCurrentStates());
+    EXPECT_EQ(sequential.getAccumulatedRewards(0), parallel.getAccumulatedRewards(0));
+}
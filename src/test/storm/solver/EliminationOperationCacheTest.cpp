@@ -0,0 +1,62 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <carl/core/VariablePool.h>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/solver/stateelimination/EliminationOperationCache.h"
+#include "storm/utility/constants.h"
+
+namespace {
+
+TEST(EliminationOperationCacheTest, RationalFunction) {
+    carl::VariablePool::getInstance().clear();
+    auto cache = std::make_shared<storm::RawPolynomialCache>();
+    storm::RationalFunctionVariable p = carl::freshRealVariable("p");
+    storm::RationalFunctionVariable q = carl::freshRealVariable("q");
+    storm::RationalFunction functionP(storm::Polynomial(storm::RawPolynomial(p), cache));
+    storm::RationalFunction functionQ(storm::Polynomial(storm::RawPolynomial(q), cache));
+    storm::RationalFunction oneMinusP = storm::utility::one<storm::RationalFunction>() - functionP;
+
+    storm::solver::stateelimination::EliminationOperationCache<storm::RationalFunction> operationCache(2);
+    EXPECT_EQ(storm::utility::simplify(storm::RationalFunction(functionP * oneMinusP)), operationCache.multiply(functionP, oneMinusP));
+    EXPECT_EQ(0ull, operationCache.getNumberOfHits());
+    EXPECT_EQ(1ull, operationCache.getNumberOfMisses());
+
+    // The product is commutative, so the stored result is also used for the swapped operands.
+    EXPECT_EQ(storm::utility::simplify(storm::RationalFunction(functionP * oneMinusP)), operationCache.multiply(oneMinusP, functionP));
+    EXPECT_EQ(1ull, operationCache.getNumberOfHits());
+
+    // Sums are stored separately.
+    EXPECT_EQ(storm::utility::one<storm::RationalFunction>(), operationCache.add(functionP, oneMinusP));
+    EXPECT_EQ(1ull, operationCache.getNumberOfHits());
+    EXPECT_EQ(2ull, operationCache.getNumberOfMisses());
+    EXPECT_EQ(storm::utility::one<storm::RationalFunction>(), operationCache.add(oneMinusP, functionP));
+    EXPECT_EQ(2ull, operationCache.getNumberOfHits());
+
+    // Results with constant operands are not stored.
+    storm::RationalFunction half = storm::utility::convertNumber<storm::RationalFunction>(std::string("1/2"));
+    EXPECT_EQ(storm::utility::simplify(storm::RationalFunction(functionQ * half)), operationCache.multiply(functionQ, half));
+    EXPECT_EQ(storm::utility::simplify(storm::RationalFunction(functionQ * half)), operationCache.multiply(functionQ, half));
+    EXPECT_EQ(2ull, operationCache.getNumberOfHits());
+    EXPECT_EQ(2ull, operationCache.getNumberOfMisses());
+
+    // If the cache is full, the stored results are dropped.
+    EXPECT_EQ(storm::utility::simplify(storm::RationalFunction(functionP * functionQ)), operationCache.multiply(functionP, functionQ));
+    EXPECT_EQ(storm::utility::simplify(storm::RationalFunction(functionQ * oneMinusP)), operationCache.multiply(functionQ, oneMinusP));
+    EXPECT_EQ(storm::utility::simplify(storm::RationalFunction(functionP * oneMinusP)), operationCache.multiply(functionP, oneMinusP));
+    EXPECT_EQ(2ull, operationCache.getNumberOfHits());
+    EXPECT_EQ(5ull, operationCache.getNumberOfMisses());
+}
+
+TEST(EliminationOperationCacheTest, Double) {
+    storm::solver::stateelimination::EliminationOperationCache<double> operationCache(10);
+    EXPECT_EQ(0.25, operationCache.multiply(0.5, 0.5));
+    EXPECT_EQ(0.75, operationCache.add(0.5, 0.25));
+    EXPECT_EQ(0.25, operationCache.multiply(0.5, 0.5));
+    // Results are only memoized for rational functions.
+    EXPECT_EQ(0ull, operationCache.getNumberOfHits());
+    EXPECT_EQ(0ull, operationCache.getNumberOfMisses());
+}
+
+}  // namespace
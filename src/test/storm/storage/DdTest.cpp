@@ -8,6 +8,7 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/SparseMatrixStream.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
@@ -841,6 +842,62 @@ TYPED_TEST(Dd, BddOddTest) {
     });
 }
 
+TYPED_TEST(Dd, SparseMatrixStreamTest) {
+    const storm::dd::DdType DdType = TestFixture::DdType;
+    std::shared_ptr<storm::dd::DdManager<DdType>> manager(new storm::dd::DdManager<DdType>());
+    manager->execute([&]() {
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+
+        // Create a non-trivial matrix.
+        storm::dd::Add<DdType, double> dd =
+            manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() *
+            manager->getRange(x.first).template toAdd<double>();
+        dd += manager->getEncoding(x.first, 1).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() +
+              manager->getEncoding(x.second, 1).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+        dd *= manager->template getIdentity<double>(x.second);
+
+        storm::dd::Odd rowOdd = manager->getRange(x.first).createOdd();
+        storm::dd::Odd columnOdd = manager->getRange(x.second).createOdd();
+        storm::storage::SparseMatrix<double> matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+
+        // Converting a range of rows yields the corresponding rows of the full matrix.
+        storm::storage::SparseMatrix<double> rows;
+        ASSERT_NO_THROW(rows = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd, 3, 7));
+        EXPECT_EQ(4ul, rows.getRowCount());
+        EXPECT_EQ(9ul, rows.getColumnCount());
+        EXPECT_EQ(8ul, rows.getNonzeroEntryCount());
+        for (uint64_t row = 0; row < rows.getRowCount(); ++row) {
+            EXPECT_TRUE(std::equal(rows.getRow(row).begin(), rows.getRow(row).end(), matrix.getRow(row + 3).begin(), matrix.getRow(row + 3).end()));
+        }
+        STORM_SILENT_EXPECT_THROW(dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd, 5, 10), storm::exceptions::InvalidArgumentException);
+
+        // The first row has nine entries, all others have two entries.
+        for (uint64_t cachedEntries : {0ull, 10ull, 100ull}) {
+            storm::dd::SparseMatrixStream<DdType, double> stream(dd, {x.first}, {x.second}, rowOdd, columnOdd, 5, cachedEntries);
+            EXPECT_EQ(9ul, stream.getRowCount());
+            EXPECT_EQ(25ul, stream.getEntryCount());
+            ASSERT_EQ(5ul, stream.getNumberOfBlocks());
+            EXPECT_EQ(0ul, stream.getBlockFirstRow(0));
+            EXPECT_EQ(1ul, stream.getBlockEndRow(0));
+            EXPECT_EQ(9ul, stream.getBlockEndRow(4));
+
+            std::vector<double> x(9), b(9, 1.0), expected(9), result(9);
+            for (uint64_t i = 0; i < x.size(); ++i) {
+                x[i] = static_cast<double>(i) / 2.0;
+            }
+            matrix.multiplyWithVector(x, expected, &b);
+            stream.multiply(x, &b, result);
+            EXPECT_EQ(expected, result);
+            stream.multiply(x, &b, result);
+            EXPECT_EQ(expected, result);
+
+            // Blocks that fit into the cache are only converted once. The last block of the first multiplication is reused by the second one.
+            uint64_t expectedConversions = cachedEntries == 0 ? 9 : (cachedEntries == 10 ? 8 : 5);
+            EXPECT_EQ(expectedConversions, stream.getNumberOfBlockConversions());
+        }
+    });
+}
+
 TYPED_TEST(Dd, BddToExpressionTest) {
     const storm::dd::DdType DdType = TestFixture::DdType;
     std::shared_ptr<storm::dd::DdManager<DdType>> manager(new storm::dd::DdManager<DdType>());
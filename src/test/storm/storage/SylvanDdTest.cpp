@@ -4,11 +4,14 @@
 #include "carl/util/stringparser.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SylvanSettings.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/dd/ExecutionScope.h"
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -27,6 +30,109 @@ class SylvanDd : public ::testing::Test {
 typedef ::testing::Types<Sylvan> TestingTypes;
 TYPED_TEST_SUITE(SylvanDd, TestingTypes, );
 
+namespace {
+// Performs a couple of DD operations (including a conversion to an explicit vector) and checks their results.
+template<storm::dd::DdType DdType>
+void checkDdOperations(storm::dd::DdManager<DdType> const& manager, storm::expressions::Variable const& x) {
+    storm::dd::Add<DdType, double> identity = manager.template getIdentity<double>(x);
+    storm::dd::Add<DdType, double> twice = identity + identity;
+    EXPECT_EQ(90.0, twice.sumAbstract({x}).getValue());
+    EXPECT_EQ(5ul, identity.greater(4.0).getNonZeroCount());
+
+    storm::dd::Odd odd = manager.getRange(x).createOdd();
+    std::vector<double> values = twice.toVector(odd);
+    ASSERT_EQ(9ul, values.size());
+    for (uint64_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(2.0 * (i + 1), values[i]);
+    }
+}
+}  // namespace
+
+TYPED_TEST(SylvanDd, NestedScopesTest) {
+    const storm::dd::DdType DdType = TestFixture::DdType;
+    std::shared_ptr<storm::dd::DdManager<DdType>> manager(new storm::dd::DdManager<DdType>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+
+    // Operations outside of any scope wake up the workers individually.
+    checkDdOperations(*manager, x.first);
+    {
+        storm::dd::ExecutionScope<DdType> outerScope;
+        checkDdOperations(*manager, x.first);
+        {
+            storm::dd::ExecutionScope<DdType> innerScope;
+            storm::dd::ExecutionScope<DdType> copiedScope(innerScope);
+            checkDdOperations(*manager, x.first);
+            {
+                // DD operations remain valid while the scopes are suspended.
+                storm::dd::SuspensionScope<DdType> suspensionScope;
+                checkDdOperations(*manager, x.first);
+                {
+                    storm::dd::ExecutionScope<DdType> scopeWithinSuspension;
+                    checkDdOperations(*manager, x.first);
+                    {
+                        storm::dd::SuspensionScope<DdType> nestedSuspensionScope;
+                        checkDdOperations(*manager, x.first);
+                    }
+                    checkDdOperations(*manager, x.first);
+                }
+                checkDdOperations(*manager, x.first);
+            }
+            // Leaving the suspension scope restores the enclosing scopes.
+            checkDdOperations(*manager, x.first);
+        }
+        checkDdOperations(*manager, x.first);
+    }
+    checkDdOperations(*manager, x.first);
+}
+
+TYPED_TEST(SylvanDd, ScopesWithinExecuteTest) {
+    const storm::dd::DdType DdType = TestFixture::DdType;
+    std::shared_ptr<storm::dd::DdManager<DdType>> manager(new storm::dd::DdManager<DdType>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+
+    storm::dd::ExecutionScope<DdType> executionScope;
+    manager->execute([&]() {
+        checkDdOperations(*manager, x.first);
+        {
+            // Within a task of the DD library, scopes must neither wake up nor suspend the workers.
+            storm::dd::ExecutionScope<DdType> innerScope;
+            checkDdOperations(*manager, x.first);
+            storm::dd::SuspensionScope<DdType> suspensionScope;
+            checkDdOperations(*manager, x.first);
+            manager->execute([&]() { checkDdOperations(*manager, x.first); });
+        }
+        checkDdOperations(*manager, x.first);
+    });
+    {
+        storm::dd::SuspensionScope<DdType> suspensionScope;
+        manager->execute([&]() { checkDdOperations(*manager, x.first); });
+    }
+    checkDdOperations(*manager, x.first);
+}
+
+TYPED_TEST(SylvanDd, KeepWorkersAwakeTest) {
+    const storm::dd::DdType DdType = TestFixture::DdType;
+    // The option is only considered when Sylvan is initialized, i.e., when the first manager is created.
+    std::unique_ptr<storm::settings::SettingMemento> keepAwake = storm::settings::mutableSylvanSettings().overrideKeepWorkersAwakeSet(true);
+    std::shared_ptr<storm::dd::DdManager<DdType>> manager(new storm::dd::DdManager<DdType>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+
+    checkDdOperations(*manager, x.first);
+    {
+        storm::dd::ExecutionScope<DdType> executionScope;
+        checkDdOperations(*manager, x.first);
+        {
+            storm::dd::SuspensionScope<DdType> suspensionScope;
+            checkDdOperations(*manager, x.first);
+        }
+        manager->execute([&]() { checkDdOperations(*manager, x.first); });
+    }
+    checkDdOperations(*manager, x.first);
+
+    // Destroy the manager before the original value of the option is restored.
+    manager.reset();
+}
+
 TYPED_TEST(SylvanDd, AddSharpenTest) {
     const storm::dd::DdType DdType = TestFixture::DdType;
     std::shared_ptr<storm::dd::DdManager<DdType>> manager(new storm::dd::DdManager<DdType>());
@@ -114,3 +114,35 @@ TEST_F(KSPTest, kspPathAsList) {
     //    161, 154, 146, 140, 134, 127, 119, 112, 104, 98, 92, 85, 77, 70, 81, 74, 65, 58, 52, 45, 37, 30, 22, 17, 12, 9, 6, 4, 2, 1, 0}; EXPECT_EQ(reference,
     //    list);
 }
+
+TEST_F(KSPTest, kspUntilMass) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, testState);
+
+    double mass = 0.05;
+    auto k = spg.computeUntilMass(mass, false, 1000);
+    ASSERT_GT(k, 1ul);
+    EXPECT_GT(spg.getAccumulatedDistance(k), mass);
+    EXPECT_LE(spg.getAccumulatedDistance(k - 1), mass);
+
+    double sum = 0;
+    for (unsigned long i = 1; i <= k; ++i) {
+        sum += spg.getDistance(i);
+    }
+    EXPECT_NEAR(sum, spg.getAccumulatedDistance(k), 1e-12);
+
+    auto paths = spg.getPathsAsLists(1, k, 4);
+    ASSERT_EQ(k, paths.size());
+    for (unsigned long i = 1; i <= k; ++i) {
+        EXPECT_EQ(spg.getPathAsList(i), paths[i - 1]);
+    }
+    STORM_SILENT_ASSERT_THROW(spg.getPathsAsLists(1, k + 1), std::invalid_argument);
+}
+
+TEST_F(KSPTest, kspUntilMassNoFurtherPaths) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, stateWithOnlyOnePath);
+
+    EXPECT_EQ(1ul, spg.computeUntilMass(2.0, false, 10));
+    EXPECT_FALSE(spg.hasPath(2));
+}